@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the throughput of client-side SQL formatting, comparing
+// format strings parsed on every call with compiled format strings and query templates.
+// Doesn't require a server.
+// Usage: boost_mysql_bench_format_sql_compiled [iterations]
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/compiled_format.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/query_template.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+
+using std::chrono::steady_clock;
+namespace mysql = boost::mysql;
+
+namespace {
+
+constexpr mysql::format_options opts{mysql::utf8mb4_charset, true};
+
+// A typical query, with several long literal segments and a few arguments
+#define BENCH_QUERY                                                                                      \
+    "SELECT employee.id, employee.first_name, employee.last_name, company.name "                         \
+    "FROM employee JOIN company ON employee.company_id = company.id "                                    \
+    "WHERE employee.salary > {} AND company.name = {} AND employee.last_name LIKE {} "                   \
+    "ORDER BY employee.salary DESC LIMIT {}"
+
+std::size_t format_runtime(std::size_t iterations)
+{
+    // Re-use the output string's memory, so we mostly measure formatting
+    std::string storage;
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        mysql::format_context ctx(opts, std::move(storage));
+        mysql::format_sql_to(ctx, BENCH_QUERY, 50000, "Award Winning Company, Inc.", "S%", 10);
+        storage = std::move(ctx).get().value();
+        res += storage.size();
+    }
+    return res;
+}
+
+std::size_t format_compiled(std::size_t iterations)
+{
+    static constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT(BENCH_QUERY);
+
+    // Re-use the output string's memory, so we mostly measure formatting
+    std::string storage;
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        mysql::format_context ctx(opts, std::move(storage));
+        mysql::format_sql_to(ctx, query, 50000, "Award Winning Company, Inc.", "S%", 10);
+        storage = std::move(ctx).get().value();
+        res += storage.size();
+    }
+    return res;
+}
+
+std::size_t format_template(std::size_t iterations)
+{
+    const mysql::query_template query(BENCH_QUERY);
+
+    // Re-use the output string's memory, so we mostly measure formatting
+    std::string storage;
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        mysql::format_context ctx(opts, std::move(storage));
+        mysql::format_sql_to(ctx, query, 50000, "Award Winning Company, Inc.", "S%", 10);
+        storage = std::move(ctx).get().value();
+        res += storage.size();
+    }
+    return res;
+}
+
+template <class Fn>
+void run(const char* name, std::size_t iterations, Fn fn)
+{
+    auto tp_start = steady_clock::now();
+    auto checksum = fn(iterations);
+    auto tp_finish = steady_clock::now();
+    auto ellapsed = std::chrono::duration<double>(tp_finish - tp_start).count();
+    std::cout << name << ',' << static_cast<std::uint64_t>(iterations / ellapsed) << ',' << checksum
+              << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t iterations = argc >= 2 ? static_cast<std::size_t>(std::atoll(argv[1])) : 1000000u;
+
+    std::cout << "path,queries_per_second,checksum\n";
+    run("runtime", iterations, format_runtime);
+    run("compiled", iterations, format_compiled);
+    run("template", iterations, format_template);
+}
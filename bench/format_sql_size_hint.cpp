@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the effect of reserving the output string using format_sql_size_hint
+// when composing a big batch insert with sequence. Doesn't require a server.
+// Usage: boost_mysql_bench_format_sql_size_hint [num_rows] [iterations]
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/sequence.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::chrono::steady_clock;
+namespace mysql = boost::mysql;
+
+namespace {
+
+constexpr mysql::format_options opts{mysql::utf8mb4_charset, true};
+
+struct employee
+{
+    std::int64_t id;
+    std::string first_name;
+    std::string last_name;
+    double salary;
+};
+
+std::vector<employee> make_rows(std::size_t num_rows)
+{
+    std::vector<employee> res;
+    res.reserve(num_rows);
+    for (std::size_t i = 0; i < num_rows; ++i)
+    {
+        res.push_back({static_cast<std::int64_t>(i), "Some first name", "Some 'quoted' last name", 4200.5});
+    }
+    return res;
+}
+
+void format_employee(const employee& e, mysql::format_context_base& ctx)
+{
+    mysql::format_sql_to(ctx, "({}, {}, {}, {})", e.id, e.first_name, e.last_name, e.salary);
+}
+
+// No reservation: the output string grows while formatting
+std::size_t format_no_hint(const std::vector<employee>& rows, std::size_t iterations)
+{
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        mysql::format_context ctx(opts);
+        mysql::format_sql_to(ctx, "INSERT INTO employee VALUES {}", mysql::sequence(rows, format_employee));
+        res += std::move(ctx).get().value().size();
+    }
+    return res;
+}
+
+// The output string is allocated once, using the size hint
+std::size_t format_hint(const std::vector<employee>& rows, std::size_t iterations)
+{
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto seq = mysql::sequence(rows, format_employee);
+        std::string storage;
+        storage.reserve(mysql::format_sql_size_hint(opts, "INSERT INTO employee VALUES {}", seq));
+        mysql::format_context ctx(opts, std::move(storage));
+        mysql::format_sql_to(ctx, "INSERT INTO employee VALUES {}", seq);
+        res += std::move(ctx).get().value().size();
+    }
+    return res;
+}
+
+// Re-using the output string's memory. This is the best case, with no allocations
+std::size_t format_reuse(const std::vector<employee>& rows, std::size_t iterations)
+{
+    std::string storage;
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        mysql::format_context ctx(opts, std::move(storage));
+        mysql::format_sql_to(ctx, "INSERT INTO employee VALUES {}", mysql::sequence(rows, format_employee));
+        storage = std::move(ctx).get().value();
+        res += storage.size();
+    }
+    return res;
+}
+
+// Only the sizing pass
+std::size_t size_hint_only(const std::vector<employee>& rows, std::size_t iterations)
+{
+    std::size_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        res += mysql::format_sql_size_hint(
+            opts,
+            "INSERT INTO employee VALUES {}",
+            mysql::sequence(rows, format_employee)
+        );
+    }
+    return res;
+}
+
+template <class Fn>
+void run(const char* name, const std::vector<employee>& rows, std::size_t iterations, Fn fn)
+{
+    auto tp_start = steady_clock::now();
+    auto checksum = fn(rows, iterations);
+    auto tp_finish = steady_clock::now();
+    auto ellapsed = std::chrono::duration<double>(tp_finish - tp_start).count();
+    std::cout << name << ',' << ellapsed * 1000.0 / iterations << ',' << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t num_rows = argc >= 2 ? static_cast<std::size_t>(std::atoll(argv[1])) : 500000u;
+    std::size_t iterations = argc >= 3 ? static_cast<std::size_t>(std::atoll(argv[2])) : 20u;
+    auto rows = make_rows(num_rows);
+
+    std::cout << "path,ms_per_query,checksum\n";
+    run("no_hint", rows, iterations, format_no_hint);
+    run("hint", rows, iterations, format_hint);
+    run("reuse", rows, iterations, format_reuse);
+    run("size_hint_only", rows, iterations, size_hint_only);
+}
@@ -0,0 +1,395 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the round-trip cost of sync and async operations against a fake server
+// running in a separate thread, over loopback TCP or UNIX sockets. Doesn't require a server.
+// Sync operations can be run with and without busy-polling (any_connection_params::busy_poll_duration).
+// The fake server performs a minimal handshake and replies to every command with an OK packet,
+// so the results measure the client and the I/O backend, rather than the server.
+// The boost_mysql_bench_loopback_io_uring target builds it using Asio's io_uring backend (requires liburing).
+// Usage: boost_mysql_bench_loopback <benchmark-type> [num_ops]
+
+#include <boost/mysql/any_address.hpp>
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/connect_params.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/ssl_mode.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using boost::mysql::error_code;
+using std::chrono::steady_clock;
+namespace mysql = boost::mysql;
+namespace asio = boost::asio;
+
+namespace {
+
+static constexpr const char* socket_path = "/tmp/boost_mysql_bench_loopback.sock";
+
+// clang-format off
+// Capabilities: CLIENT_PROTOCOL_41, CLIENT_SECURE_CONNECTION, CLIENT_PLUGIN_AUTH,
+// CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA and CLIENT_DEPRECATE_EOF. The implicit NULL terminator
+// of the array is the one required by the auth plugin name
+static constexpr char server_hello[] =
+    "\x0a"                                      // protocol version
+    "8.0.0\0"                                   // server version
+    "\x01\x00\x00\x00"                          // connection id
+    "\x01\x02\x03\x04\x05\x06\x07\x08"          // auth plugin data, 1st part
+    "\x00"                                      // filler
+    "\x00\x82"                                  // capabilities, low bytes
+    "\x2d"                                      // character set: utf8mb4_general_ci
+    "\x02\x00"                                  // status flags: autocommit
+    "\x28\x01"                                  // capabilities, high bytes
+    "\x15"                                      // auth plugin data length
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"  // reserved
+    "\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10\x11\x12\x13\x14\x00"  // auth plugin data, 2nd part
+    "mysql_native_password";                    // auth plugin name
+
+// affected rows, last insert ID, status flags (autocommit), warnings
+static constexpr std::uint8_t ok_packet[] = {0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+// clang-format on
+
+static constexpr std::uint8_t com_quit = 0x01;
+
+// Writes a message in a single write, returning an error code
+template <class Socket>
+error_code write_message(Socket& sock, std::uint8_t seqnum, asio::const_buffer body)
+{
+    const auto size = body.size();
+    const std::uint8_t header[] = {
+        static_cast<std::uint8_t>(size),
+        static_cast<std::uint8_t>(size >> 8),
+        static_cast<std::uint8_t>(size >> 16),
+        seqnum,
+    };
+    const std::array<asio::const_buffer, 2> buffs{
+        {asio::buffer(header, sizeof(header)), body}
+    };
+    error_code ec;
+    asio::write(sock, buffs, ec);
+    return ec;
+}
+
+// Reads a message into buff, returning its sequence number. Messages are never split by this client
+template <class Socket>
+std::uint8_t read_message(Socket& sock, std::vector<std::uint8_t>& buff, error_code& ec)
+{
+    std::uint8_t header[4]{};
+    asio::read(sock, asio::buffer(header), ec);
+    if (ec)
+        return 0;
+    buff.resize(header[0] | (header[1] << 8) | (header[2] << 16));
+    asio::read(sock, asio::buffer(buff), ec);
+    return header[3];
+}
+
+// Runs the fake server for a single client, using sync I/O.
+// Credentials are not checked. Every command gets an OK packet as response
+template <class Socket>
+void serve(Socket& sock)
+{
+    std::vector<std::uint8_t> buff;
+    error_code ec;
+
+    // Server hello
+    ec = write_message(sock, 0, asio::buffer(server_hello, sizeof(server_hello)));
+    if (ec)
+        return;
+
+    // Handshake response and commands
+    while (true)
+    {
+        std::uint8_t seqnum = read_message(sock, buff, ec);
+        if (ec || (seqnum == 0 && !buff.empty() && buff[0] == com_quit))
+            return;
+        ec = write_message(sock, static_cast<std::uint8_t>(seqnum + 1), asio::buffer(ok_packet));
+        if (ec)
+            return;
+    }
+}
+
+// Accepts a single connection and serves it in a separate thread.
+// The acceptor is created before the thread is launched, so clients can connect immediately
+template <class Protocol>
+class fake_server
+{
+    asio::io_context ctx_;
+    typename Protocol::acceptor acceptor_;
+    std::thread thread_;
+
+public:
+    fake_server(const typename Protocol::endpoint& ep) : acceptor_(ctx_, ep)
+    {
+        thread_ = std::thread([this] {
+            typename Protocol::socket sock(ctx_);
+            acceptor_.accept(sock);
+            serve(sock);
+        });
+    }
+    fake_server(const fake_server&) = delete;
+    fake_server& operator=(const fake_server&) = delete;
+    ~fake_server() { thread_.join(); }
+
+    typename Protocol::endpoint local_endpoint() const { return acceptor_.local_endpoint(); }
+};
+
+enum class op_type
+{
+    ping,
+    execute,
+};
+
+void check_ec(error_code ec, const mysql::diagnostics& diag)
+{
+    if (ec)
+    {
+        std::cerr << ec << ", " << diag.client_message() << std::endl;
+        exit(1);
+    }
+}
+
+// Connects, runs the given operation num_ops times and closes the connection
+class async_task
+{
+    mysql::any_connection conn_;
+    const mysql::connect_params* params_;
+    op_type op_;
+    std::size_t remaining_;
+    mysql::results r_;
+    mysql::diagnostics diag_;
+    asio::coroutine coro_;
+    steady_clock::time_point tp_start_;
+    steady_clock::time_point tp_finish_;
+
+    void start_op()
+    {
+        if (op_ == op_type::ping)
+            conn_.async_ping(diag_, [this](error_code ec) { resume(ec); });
+        else
+            conn_.async_execute("SET @v = 1", r_, diag_, [this](error_code ec) { resume(ec); });
+    }
+
+public:
+    async_task(
+        asio::any_io_executor ex,
+        const mysql::connect_params& params,
+        op_type op,
+        std::size_t num_ops
+    )
+        : conn_(std::move(ex)), params_(&params), op_(op), remaining_(num_ops)
+    {
+    }
+
+    std::chrono::milliseconds ellapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish_ - tp_start_);
+    }
+
+    void resume(error_code ec = {})
+    {
+        check_ec(ec, diag_);
+
+        BOOST_ASIO_CORO_REENTER(coro_)
+        {
+            BOOST_ASIO_CORO_YIELD
+            conn_.async_connect(*params_, diag_, [this](error_code ec) { resume(ec); });
+
+            tp_start_ = steady_clock::now();
+            for (; remaining_ != 0u; --remaining_)
+            {
+                BOOST_ASIO_CORO_YIELD start_op();
+            }
+            tp_finish_ = steady_clock::now();
+
+            BOOST_ASIO_CORO_YIELD
+            conn_.async_close(diag_, [this](error_code ec) { resume(ec); });
+        }
+    }
+};
+
+mysql::connect_params make_params(mysql::any_address addr)
+{
+    mysql::connect_params res;
+    res.server_address = std::move(addr);
+    res.username = "example_user";
+    res.password = "example_password";
+    res.ssl = mysql::ssl_mode::disable;
+    return res;
+}
+
+enum class mode_type
+{
+    async,
+    sync,
+    sync_busy_poll,
+};
+
+enum class transport_type
+{
+    tcp,
+    unix_socket,
+};
+
+struct bench_option
+{
+    const char* name;
+    mode_type mode;
+    op_type op;
+    transport_type transport;
+};
+
+void run_async(const mysql::connect_params& params, op_type op, std::size_t num_ops)
+{
+    asio::io_context ctx;
+    async_task task(ctx.get_executor(), params, op, num_ops);
+    task.resume();
+    ctx.run();
+    std::cout << task.ellapsed().count() << std::flush;
+}
+
+// Same as async_task, but using sync functions
+void run_sync(
+    const mysql::connect_params& params,
+    op_type op,
+    std::size_t num_ops,
+    std::chrono::microseconds busy_poll_duration
+)
+{
+    asio::io_context ctx;
+    mysql::any_connection_params conn_params;
+    conn_params.busy_poll_duration = busy_poll_duration;
+    mysql::any_connection conn(ctx, conn_params);
+    mysql::results r;
+    mysql::diagnostics diag;
+    error_code ec;
+
+    conn.connect(params, ec, diag);
+    check_ec(ec, diag);
+
+    auto tp_start = steady_clock::now();
+    for (std::size_t i = 0; i < num_ops; ++i)
+    {
+        if (op == op_type::ping)
+            conn.ping(ec, diag);
+        else
+            conn.execute("SET @v = 1", r, ec, diag);
+        check_ec(ec, diag);
+    }
+    auto tp_finish = steady_clock::now();
+
+    conn.close(ec, diag);
+    check_ec(ec, diag);
+
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(tp_finish - tp_start).count()
+              << std::flush;
+}
+
+void run_client(const bench_option& opt, const mysql::connect_params& params, std::size_t num_ops)
+{
+    switch (opt.mode)
+    {
+    case mode_type::async: run_async(params, opt.op, num_ops); break;
+    case mode_type::sync: run_sync(params, opt.op, num_ops, std::chrono::microseconds(0)); break;
+    case mode_type::sync_busy_poll: run_sync(params, opt.op, num_ops, std::chrono::milliseconds(1)); break;
+    }
+}
+
+void run(const bench_option& opt, std::size_t num_ops)
+{
+    if (opt.transport == transport_type::tcp)
+    {
+        fake_server<asio::ip::tcp> server(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+        mysql::host_and_port addr;
+        addr.host = "127.0.0.1";
+        addr.port = server.local_endpoint().port();
+        run_client(opt, make_params(std::move(addr)), num_ops);
+    }
+    else
+    {
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+        std::remove(socket_path);
+        {
+            const asio::local::stream_protocol::endpoint ep(socket_path);
+            fake_server<asio::local::stream_protocol> server(ep);
+            run_client(opt, make_params(mysql::unix_path{socket_path}), num_ops);
+        }
+        std::remove(socket_path);
+#else
+        std::cerr << "UNIX sockets are not supported in this system" << std::endl;
+        exit(1);
+#endif
+    }
+}
+
+// clang-format off
+static constexpr bench_option options[] = {
+    {"async-ping-tcp",              mode_type::async,          op_type::ping,    transport_type::tcp        },
+    {"async-ping-unix",             mode_type::async,          op_type::ping,    transport_type::unix_socket},
+    {"async-execute-tcp",           mode_type::async,          op_type::execute, transport_type::tcp        },
+    {"async-execute-unix",          mode_type::async,          op_type::execute, transport_type::unix_socket},
+    {"sync-ping-tcp",               mode_type::sync,           op_type::ping,    transport_type::tcp        },
+    {"sync-ping-unix",              mode_type::sync,           op_type::ping,    transport_type::unix_socket},
+    {"sync-execute-tcp",            mode_type::sync,           op_type::execute, transport_type::tcp        },
+    {"sync-execute-unix",           mode_type::sync,           op_type::execute, transport_type::unix_socket},
+    {"sync-busypoll-ping-tcp",      mode_type::sync_busy_poll, op_type::ping,    transport_type::tcp        },
+    {"sync-busypoll-ping-unix",     mode_type::sync_busy_poll, op_type::ping,    transport_type::unix_socket},
+    {"sync-busypoll-execute-tcp",   mode_type::sync_busy_poll, op_type::execute, transport_type::tcp        },
+    {"sync-busypoll-execute-unix",  mode_type::sync_busy_poll, op_type::execute, transport_type::unix_socket},
+};
+// clang-format on
+
+void usage(const char* progname)
+{
+    std::cerr << "Usage: " << progname << " <benchmark-type> [num_ops]\nAvailable options:\n";
+    for (const auto& opt : options)
+        std::cerr << "    " << opt.name << "\n";
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2 && argc != 3)
+    {
+        usage(argv[0]);
+    }
+
+    mysql::string_view opt_name = argv[1];
+    std::size_t num_ops = argc == 3 ? std::strtoul(argv[2], nullptr, 10) : 100000u;
+
+    for (const auto& opt : options)
+    {
+        if (opt_name == opt.name)
+        {
+            run(opt, num_ops);
+            return 0;
+        }
+    }
+
+    usage(argv[0]);
+}
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the throughput of parsing binary protocol rows into static rows,
+// comparing the field_view-based path with direct parsing.
+// Doesn't require a server: rows are generated in memory.
+// Usage: boost_mysql_bench_static_row_decode [iterations]
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/mysql_collations.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+
+#include <boost/mp11/algorithm.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using std::chrono::steady_clock;
+namespace mysql = boost::mysql;
+namespace detail = boost::mysql::detail;
+
+namespace {
+
+// Rows with N columns, alternating BIGINTs and VARCHARs
+template <std::size_t N>
+using row_t = boost::mp11::mp_repeat_c<std::tuple<std::int64_t, std::string>, N / 2>;
+
+template <std::size_t N>
+class bench_data
+{
+    std::vector<mysql::metadata> meta_;
+    std::vector<std::uint8_t> msg_;
+    std::array<std::size_t, N> pos_map_{};
+
+    static mysql::metadata make_meta(mysql::column_type type)
+    {
+        detail::coldef_view coldef{};
+        coldef.collation_id = mysql::mysql_collations::utf8mb4_general_ci;
+        coldef.type = type;
+        return detail::access::construct<mysql::metadata>(coldef, true);
+    }
+
+public:
+    bench_data()
+    {
+        // Header and NULL bitmap (no NULLs)
+        msg_.resize(1 + (N + 9) / 8, 0);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                meta_.push_back(make_meta(mysql::column_type::bigint));
+                auto value = static_cast<std::uint64_t>(i * 1000);
+                for (std::size_t j = 0; j < 8; ++j)
+                    msg_.push_back(static_cast<std::uint8_t>(value >> (8 * j)));
+            }
+            else
+            {
+                meta_.push_back(make_meta(mysql::column_type::varchar));
+                std::string value = "value_" + std::to_string(i);
+                msg_.push_back(static_cast<std::uint8_t>(value.size()));
+                msg_.insert(msg_.end(), value.begin(), value.end());
+            }
+        }
+
+        // Positional mapping
+        std::iota(pos_map_.begin(), pos_map_.end(), std::size_t(0));
+    }
+
+    mysql::metadata_collection_view meta() const { return meta_; }
+    boost::span<const std::uint8_t> msg() const { return msg_; }
+    boost::span<const std::size_t> pos_map() const { return pos_map_; }
+};
+
+// Parses the row into field_views, then into the row type
+template <std::size_t N>
+std::int64_t parse_field_views(const bench_data<N>& data, std::size_t iterations)
+{
+    std::vector<mysql::field_view> fields(N);
+    row_t<N> row;
+    std::int64_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto err = detail::deserialize_row(
+            detail::resultset_encoding::binary,
+            data.msg(),
+            data.meta(),
+            fields
+        );
+        if (!err)
+            err = detail::parse<row_t<N>>(data.pos_map(), fields, row);
+        if (err)
+            std::exit(1);
+        res += std::get<N - 2>(row);
+    }
+    return res;
+}
+
+// Parses the row without intermediate field_views
+template <std::size_t N>
+std::int64_t parse_cells(const bench_data<N>& data, std::size_t iterations)
+{
+    std::vector<detail::binary_cell> cells(N);
+    row_t<N> row;
+    std::int64_t res = 0;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        auto err = detail::split_binary_row(data.msg(), data.meta(), cells.data());
+        if (!err)
+            err = detail::parse_direct<row_t<N>>(data.pos_map(), cells, data.meta(), row);
+        if (err)
+            std::exit(1);
+        res += std::get<N - 2>(row);
+    }
+    return res;
+}
+
+template <std::size_t N, class Fn>
+void run(const char* name, std::size_t iterations, Fn fn)
+{
+    bench_data<N> data;
+    auto tp_start = steady_clock::now();
+    auto checksum = fn(data, iterations);
+    auto tp_finish = steady_clock::now();
+    auto ellapsed = std::chrono::duration<double>(tp_finish - tp_start).count();
+    std::cout << N << ',' << name << ',' << static_cast<std::uint64_t>(iterations / ellapsed) << ','
+              << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t iterations = argc >= 2 ? static_cast<std::size_t>(std::atoll(argv[1])) : 1000000u;
+
+    std::cout << "columns,path,rows_per_second,checksum\n";
+    run<10>("field_view", iterations, parse_field_views<10>);
+    run<10>("direct", iterations, parse_cells<10>);
+    run<50>("field_view", iterations, parse_field_views<50>);
+    run<50>("direct", iterations, parse_cells<50>);
+}
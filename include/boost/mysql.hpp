@@ -11,13 +11,19 @@
 #include <boost/mysql/any_address.hpp>
 #include <boost/mysql/any_connection.hpp>
 #include <boost/mysql/bad_field_access.hpp>
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/binlog_stream.hpp>
 #include <boost/mysql/blob.hpp>
 #include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/buffer_params.hpp>
+#include <boost/mysql/bulk_insert.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_buffers.hpp>
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/compact_rows.hpp>
+#include <boost/mysql/compiled_format.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/connection.hpp>
 #include <boost/mysql/connection_pool.hpp>
@@ -36,8 +42,10 @@
 #include <boost/mysql/field_kind.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/gtid_set.hpp>
 #include <boost/mysql/handshake_params.hpp>
 #include <boost/mysql/is_fatal_error.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
 #include <boost/mysql/mariadb_collations.hpp>
 #include <boost/mysql/mariadb_server_errc.hpp>
 #include <boost/mysql/metadata.hpp>
@@ -45,16 +53,23 @@
 #include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/mysql_collations.hpp>
 #include <boost/mysql/mysql_server_errc.hpp>
+#include <boost/mysql/param_column.hpp>
 #include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/pipeline_batcher.hpp>
 #include <boost/mysql/pool_params.hpp>
+#include <boost/mysql/query_template.hpp>
+#include <boost/mysql/quoted_identifier.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/resultset.hpp>
+#include <boost/mysql/resultset_summary.hpp>
 #include <boost/mysql/resultset_view.hpp>
 #include <boost/mysql/row.hpp>
+#include <boost/mysql/row_batch.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/sequence.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/ssl_mode.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/static_execution_state.hpp>
@@ -9,13 +9,20 @@
 #define BOOST_MYSQL_ANY_CONNECTION_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/binlog_stream.hpp>
 #include <boost/mysql/character_set.hpp>
+#include <boost/mysql/column_buffers.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/defaults.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/execution_state.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/resultset_summary.hpp>
+#include <boost/mysql/row_batch.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -36,6 +43,7 @@
 #include <boost/assert.hpp>
 #include <boost/system/result.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
@@ -103,6 +111,27 @@ struct any_connection_params
      * system variable, too.
      */
     std::size_t max_buffer_size{0x4000000};
+
+    /**
+     * \brief (EXPERIMENTAL) For how long sync operations should busy-poll the socket when reading.
+     * \details
+     * If set to a non-zero value, sync operations (like \ref any_connection::execute) wait for
+     * the server's response by repeatedly attempting non-blocking reads, instead of sleeping
+     * until data is available. If no data arrives within this time, a regular, blocking read
+     * is performed. This can reduce latency for fast queries, especially over UNIX sockets,
+     * at the cost of keeping a CPU core busy while waiting.
+     * \n
+     * Busy-polling only pays off if the server (or the network stack) can run on a different
+     * core than the polling thread. Otherwise, it will slow down operations.
+     * \n
+     * Async operations and connections using TLS are not affected.
+     * This option is ignored on Windows. By default, busy-polling is disabled.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    std::chrono::microseconds busy_poll_duration{};
 };
 
 /**
@@ -150,7 +179,10 @@ class any_connection
 #endif
 
     BOOST_MYSQL_DECL
-    static std::unique_ptr<detail::engine> create_engine(asio::any_io_executor ex, asio::ssl::context* ctx);
+    static std::unique_ptr<detail::engine> create_engine(
+        asio::any_io_executor ex,
+        const any_connection_params& params
+    );
 
     // Used by tests
     any_connection(std::unique_ptr<detail::engine> eng, any_connection_params params)
@@ -169,7 +201,7 @@ public:
      * an \ref any_connection_params object to this constructor.
      */
     any_connection(boost::asio::any_io_executor ex, any_connection_params params = {})
-        : any_connection(create_engine(std::move(ex), params.ssl_context), params)
+        : any_connection(create_engine(std::move(ex), params), params)
     {
     }
 
@@ -535,6 +567,114 @@ public:
         );
     }
 
+    /**
+     * \brief Executes a text query or prepared statement, passing resultsets to a visitor as they arrive.
+     * \details
+     * Sends `req` to the server for execution and reads the response, like \ref execute.
+     * Instead of storing the response in a \ref results object, resultsets and rows
+     * are passed to `visitor` as they are read from the network. This is useful for
+     * multi-statement queries and stored procedures generating big resultsets,
+     * since only a single batch of rows needs to be held in memory at any point in time.
+     * \n
+     * `visitor` should be an object with the following member functions:
+     * \n
+     * \li `on_resultset_head(metadata_collection_view meta)`: called once per resultset,
+     *     after its metadata has been read. Resultsets without rows (e.g. the ones generated by
+     *     `UPDATE` statements) get an empty collection.
+     * \li `on_rows(rows_view rows)`: called zero or more times per resultset, once for every
+     *     batch of rows read from the server.
+     * \li `on_resultset_end(const resultset_summary& summary)`: called once per resultset, after all its
+     *     rows have been passed to `on_rows`.
+     * \n
+     * Metadata will be populated according to `this->meta_mode()`.
+     * `req` follows the same rules as in \ref execute.
+     *
+     * \par Object lifetimes
+     * The views passed to `visitor` point into the connection's internal buffers, and are only
+     * valid until the visitor function they are passed to returns. Copy them into owning types
+     * (like \ref rows) if you need to keep them.
+     * \n
+     * Visitor functions are called from within the operation, and shouldn't throw.
+     * If they do, the exception is propagated to the caller and the connection
+     * should be closed.
+     */
+    template <BOOST_MYSQL_EXECUTION_REQUEST ExecutionRequest, class ResultsetVisitor>
+    void execute_each(ExecutionRequest&& req, ResultsetVisitor& visitor, error_code& err, diagnostics& diag)
+    {
+        impl_.execute_each(std::forward<ExecutionRequest>(req), visitor, err, diag);
+    }
+
+    /// \copydoc execute_each
+    template <BOOST_MYSQL_EXECUTION_REQUEST ExecutionRequest, class ResultsetVisitor>
+    void execute_each(ExecutionRequest&& req, ResultsetVisitor& visitor)
+    {
+        error_code err;
+        diagnostics diag;
+        execute_each(std::forward<ExecutionRequest>(req), visitor, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc execute_each
+     * \par Object lifetimes
+     * `visitor` must be kept alive until the operation completes, as no copies will be made by
+     * the library. `req` follows the same rules as in \ref async_execute.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor. Visitor functions are called from within intermediate handlers.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     */
+    template <
+        BOOST_MYSQL_EXECUTION_REQUEST ExecutionRequest,
+        class ResultsetVisitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_execute_each(ExecutionRequest&& req, ResultsetVisitor& visitor, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(
+            detail::async_execute_each_t<ExecutionRequest&&, ResultsetVisitor, CompletionToken&&>
+        )
+    {
+        return async_execute_each(
+            std::forward<ExecutionRequest>(req),
+            visitor,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_execute_each
+    template <
+        BOOST_MYSQL_EXECUTION_REQUEST ExecutionRequest,
+        class ResultsetVisitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_execute_each(
+        ExecutionRequest&& req,
+        ResultsetVisitor& visitor,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    )
+        BOOST_MYSQL_RETURN_TYPE(
+            detail::async_execute_each_t<ExecutionRequest&&, ResultsetVisitor, CompletionToken&&>
+        )
+    {
+        return impl_.async_execute_each(
+            std::forward<ExecutionRequest>(req),
+            visitor,
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
     /**
      * \brief Starts a SQL execution as a multi-function operation.
      * \details
@@ -845,6 +985,156 @@ public:
             .async_run(impl_.make_params_read_some_rows(st), diag, std::forward<CompletionToken>(token));
     }
 
+    /**
+     * \brief Reads a batch of rows, without copying strings and blobs.
+     * \details
+     * Like \ref read_some_rows(execution_state&,error_code&,diagnostics&), but rows are placed in `output`,
+     * rather than in memory owned by `*this`. The region of the connection's read buffer
+     * containing the rows is handed to `output`, so string and blob fields point
+     * directly into the messages received from the server, and are never copied.
+     * Rows are valid until `output` is cleared, destroyed or used for another read,
+     * even if `*this` performs other network operations or is destroyed.
+     * \n
+     * Any rows previously stored in `output` are discarded, and its memory is reused
+     * by the connection. See \ref row_batch for more info.
+     * \n
+     * If the operation represented by `st` has still rows to read, at least one will be read.
+     * If there are no more rows, or `st.should_read_rows() == false`, `output` will be empty.
+     */
+    void read_some_rows(execution_state& st, row_batch& output, error_code& err, diagnostics& diag)
+    {
+        impl_.run(impl_.make_params_read_some_rows(st, output), err, diag);
+    }
+
+    /// \copydoc read_some_rows(execution_state&,row_batch&,error_code&,diagnostics&)
+    void read_some_rows(execution_state& st, row_batch& output)
+    {
+        error_code err;
+        diagnostics diag;
+        read_some_rows(st, output, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc read_some_rows(execution_state&,row_batch&,error_code&,diagnostics&)
+     * \details
+     * \par Object lifetimes
+     * `st` and `output` must be kept alive until the operation completes.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(execution_state& st, row_batch& output, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_batch_t<CompletionToken&&>)
+    {
+        return async_read_some_rows(st, output, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_some_rows(execution_state&,row_batch&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(
+        execution_state& st,
+        row_batch& output,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_batch_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows(st, output),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief Reads a batch of rows, deferring field decoding until fields are accessed.
+     * \details
+     * Like \ref read_some_rows(execution_state&,row_batch&,error_code&,diagnostics&), but fields
+     * are not decoded when reading. Rows are scanned to record where each field is, and fields
+     * are decoded the first time they're accessed through `output`. Use this when only some of the
+     * columns in a resultset are used.
+     * \n
+     * Any rows previously stored in `output` are discarded, and its memory is reused
+     * by the connection. See \ref lazy_row_batch for more info.
+     * \n
+     * If the operation represented by `st` has still rows to read, at least one will be read.
+     * If there are no more rows, or `st.should_read_rows() == false`, `output` will be empty.
+     */
+    void read_some_rows(execution_state& st, lazy_row_batch& output, error_code& err, diagnostics& diag)
+    {
+        impl_.run(impl_.make_params_read_some_rows(st, output), err, diag);
+    }
+
+    /// \copydoc read_some_rows(execution_state&,lazy_row_batch&,error_code&,diagnostics&)
+    void read_some_rows(execution_state& st, lazy_row_batch& output)
+    {
+        error_code err;
+        diagnostics diag;
+        read_some_rows(st, output, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc read_some_rows(execution_state&,lazy_row_batch&,error_code&,diagnostics&)
+     * \details
+     * \par Object lifetimes
+     * `st` and `output` must be kept alive until the operation completes.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(execution_state& st, lazy_row_batch& output, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_lazy_t<CompletionToken&&>)
+    {
+        return async_read_some_rows(st, output, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_some_rows(execution_state&,lazy_row_batch&,CompletionToken&&)
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(
+        execution_state& st,
+        lazy_row_batch& output,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_read_some_rows_lazy_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows(st, output),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
 #ifdef BOOST_MYSQL_CXX14
 
     /**
@@ -1042,6 +1332,181 @@ public:
             std::forward<CompletionToken>(token)
         );
     }
+
+    /**
+     * \brief Reads a batch of rows into column buffers.
+     * \details
+     * Reads a batch of rows of unspecified size into the columns referenced by `output`.
+     * Each member of `ColumnsRow` is written into its own array, rather than into a `ColumnsRow`
+     * object. Row `i` of the batch is written to element `i` of each column, and NULL values
+     * are reported in the NULL bitmap. See \ref column_buffers for more info.
+     * At most `output.capacity()` rows will be read. If the operation represented by `st`
+     * has still rows to read, and `output.capacity() > 0`, at least one row will be read.
+     * \n
+     * Returns the number of read rows.
+     * \n
+     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
+     * zero.
+     * \n
+     * The type `ColumnsRow` must be one of the types in the `StaticRow` parameter pack, and must match
+     * the resultset that is currently being processed by `st`. If this is not the case, a runtime error
+     * will be issued.
+     * \n
+     * This function can report schema mismatches.
+     */
+    template <class ColumnsRow, class... StaticRow>
+    std::size_t read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        const column_buffers<ColumnsRow>& output,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        return impl_.run(impl_.make_params_read_some_rows_static(st, output), err, diag);
+    }
+
+    /**
+     * \brief Reads a batch of rows into column buffers.
+     * \details
+     * Reads a batch of rows of unspecified size into the columns referenced by `output`.
+     * Each member of `ColumnsRow` is written into its own array, rather than into a `ColumnsRow`
+     * object. Row `i` of the batch is written to element `i` of each column, and NULL values
+     * are reported in the NULL bitmap. See \ref column_buffers for more info.
+     * At most `output.capacity()` rows will be read. If the operation represented by `st`
+     * has still rows to read, and `output.capacity() > 0`, at least one row will be read.
+     * \n
+     * Returns the number of read rows.
+     * \n
+     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
+     * zero.
+     * \n
+     * The type `ColumnsRow` must be one of the types in the `StaticRow` parameter pack, and must match
+     * the resultset that is currently being processed by `st`. If this is not the case, a runtime error
+     * will be issued.
+     * \n
+     * This function can report schema mismatches.
+     */
+    template <class ColumnsRow, class... StaticRow>
+    std::size_t read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        const column_buffers<ColumnsRow>& output
+    )
+    {
+        error_code err;
+        diagnostics diag;
+        std::size_t res = read_some_rows(st, output, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \brief Reads a batch of rows into column buffers.
+     * \details
+     * Reads a batch of rows of unspecified size into the columns referenced by `output`.
+     * Each member of `ColumnsRow` is written into its own array, rather than into a `ColumnsRow`
+     * object. Row `i` of the batch is written to element `i` of each column, and NULL values
+     * are reported in the NULL bitmap. See \ref column_buffers for more info.
+     * At most `output.capacity()` rows will be read. If the operation represented by `st`
+     * has still rows to read, and `output.capacity() > 0`, at least one row will be read.
+     * \n
+     * Returns the number of read rows.
+     * \n
+     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
+     * zero.
+     * \n
+     * The type `ColumnsRow` must be one of the types in the `StaticRow` parameter pack, and must match
+     * the resultset that is currently being processed by `st`. If this is not the case, a runtime error
+     * will be issued.
+     * \n
+     * This function can report schema mismatches.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     *
+     * \par Object lifetimes
+     * `output` and the storage it references must be kept alive until the operation completes.
+     */
+    template <
+        class ColumnsRow,
+        class... StaticRow,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        const column_buffers<ColumnsRow>& output,
+        CompletionToken&& token = {}
+    )
+    {
+        return async_read_some_rows(st, output, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * \brief Reads a batch of rows into column buffers.
+     * \details
+     * Reads a batch of rows of unspecified size into the columns referenced by `output`.
+     * Each member of `ColumnsRow` is written into its own array, rather than into a `ColumnsRow`
+     * object. Row `i` of the batch is written to element `i` of each column, and NULL values
+     * are reported in the NULL bitmap. See \ref column_buffers for more info.
+     * At most `output.capacity()` rows will be read. If the operation represented by `st`
+     * has still rows to read, and `output.capacity() > 0`, at least one row will be read.
+     * \n
+     * Returns the number of read rows.
+     * \n
+     * If there are no more rows, or `st.should_read_rows() == false`, this function is a no-op and returns
+     * zero.
+     * \n
+     * The type `ColumnsRow` must be one of the types in the `StaticRow` parameter pack, and must match
+     * the resultset that is currently being processed by `st`. If this is not the case, a runtime error
+     * will be issued.
+     * \n
+     * This function can report schema mismatches.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, std::size_t)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     *
+     * \par Object lifetimes
+     * `output` and the storage it references must be kept alive until the operation completes.
+     */
+    template <
+        class ColumnsRow,
+        class... StaticRow,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::size_t))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_some_rows(
+        static_execution_state<StaticRow...>& st,
+        const column_buffers<ColumnsRow>& output,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    )
+    {
+        return impl_.async_run(
+            impl_.make_params_read_some_rows_static(st, output),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
 #endif
 
     /**
@@ -1495,6 +1960,275 @@ public:
         return this->impl_
             .async_run(impl_.make_params_pipeline(req, res), diag, std::forward<CompletionToken>(token));
     }
+
+    /**
+     * \brief Runs a set of pipelined requests, passing stage responses to a visitor as they arrive.
+     * \details
+     * Runs the pipeline described by `req`, like \ref run_pipeline. Instead of storing
+     * the response of every stage in a vector, responses are passed to `visitor`
+     * as soon as they are read from the network. Rows generated by execution stages are
+     * passed to the visitor batch by batch. This avoids holding the entire response
+     * in memory, and makes the first results available before the pipeline completes.
+     * \n
+     * `visitor` should be an object with the following member functions:
+     * \n
+     * \li `on_resultset_head`, `on_rows` and `on_resultset_end`, which are called for resultsets
+     *     generated by execution stages, as described in \ref execute_each.
+     * \li `on_stage_finished(std::size_t stage_index, stage_response&& response)`: called once per stage,
+     *     in order, after the stage's resultsets (if any) have been passed to the visitor.
+     *     For failed stages, `response` contains the stage's error code and diagnostics.
+     *     For successful prepare statement stages, it contains the prepared statement.
+     *     Successful execution stages get an empty response, since their resultsets
+     *     have already been passed to the visitor.
+     * \n
+     * Visitor functions are called synchronously while reading the response. The next
+     * batch of messages is not read until they return, so a slow visitor slows down
+     * reading instead of causing data to accumulate in memory.
+     * \n
+     * Stages are run and errors are reported as in \ref run_pipeline.
+     *
+     * \par Object lifetimes
+     * Views passed to `visitor` are only valid until the visitor function they are passed to returns.
+     * Visitor functions shouldn't throw. If they do, the exception is propagated to the caller
+     * and the connection should be closed.
+     */
+    template <class PipelineVisitor>
+    void run_pipeline_each(
+        const pipeline_request& req,
+        PipelineVisitor& visitor,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        impl_.run(impl_.make_params_pipeline_each(req, detail::pipeline_visitor_ref(visitor)), err, diag);
+    }
+
+    /// \copydoc run_pipeline_each
+    template <class PipelineVisitor>
+    void run_pipeline_each(const pipeline_request& req, PipelineVisitor& visitor)
+    {
+        error_code err;
+        diagnostics diag;
+        run_pipeline_each(req, visitor, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc run_pipeline_each
+     * \details
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor. Visitor functions are called from within intermediate handlers.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     *
+     * \par Object lifetimes
+     * The request and visitor objects must be kept alive and should not be modified
+     * until the operation completes.
+     */
+    template <
+        class PipelineVisitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_run_pipeline_each(
+        const pipeline_request& req,
+        PipelineVisitor& visitor,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_run_pipeline_each_t<CompletionToken&&>)
+    {
+        return async_run_pipeline_each(
+            req,
+            visitor,
+            impl_.shared_diag(),
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /// \copydoc async_run_pipeline_each
+    template <
+        class PipelineVisitor,
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_run_pipeline_each(
+        const pipeline_request& req,
+        PipelineVisitor& visitor,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_run_pipeline_each_t<CompletionToken&&>)
+    {
+        return this->impl_.async_run(
+            impl_.make_params_pipeline_each(req, detail::pipeline_visitor_ref(visitor)),
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief (EXPERIMENTAL) Starts streaming the server's binary log.
+     * \details
+     * Registers this connection as a replica with ID `params.server_id` and requests the server to
+     * start sending binary log events, from the position described by `params`. Events should then be
+     * read using \ref read_binlog_event, passing the same `st` object. `st` is reset by this function.
+     * \n
+     * After this function is called, the connection can't be used for any other operation,
+     * even if it fails. Close the connection to stop receiving events.
+     * \n
+     * The user must have the `REPLICATION SLAVE` privilege, and the server must have
+     * `binlog_format=ROW` for row events to be generated. MariaDB is not supported.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    void start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_stream& st,
+        error_code& err,
+        diagnostics& diag
+    )
+    {
+        impl_.run(detail::binlog_dump_algo_params{&params, &detail::access::get_impl(st)}, err, diag);
+    }
+
+    /// \copydoc start_binlog_dump
+    void start_binlog_dump(const binlog_dump_params& params, binlog_stream& st)
+    {
+        error_code err;
+        diagnostics diag;
+        start_binlog_dump(params, st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    }
+
+    /**
+     * \copydoc start_binlog_dump
+     * \details
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     *
+     * \par Object lifetimes
+     * `params` and `st` must be kept alive and should not be modified until the operation completes.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_stream& st,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_start_binlog_dump_t<CompletionToken&&>)
+    {
+        return async_start_binlog_dump(params, st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_start_binlog_dump
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_start_binlog_dump(
+        const binlog_dump_params& params,
+        binlog_stream& st,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    ) BOOST_MYSQL_RETURN_TYPE(detail::async_start_binlog_dump_t<CompletionToken&&>)
+    {
+        return this->impl_.async_run(
+            detail::binlog_dump_algo_params{&params, &detail::access::get_impl(st)},
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
+
+    /**
+     * \brief (EXPERIMENTAL) Reads a single binary log event.
+     * \details
+     * `st` should have been passed to a successful \ref start_binlog_dump operation.
+     * The returned event points into the connection's internal buffers and into `st`, and
+     * is valid until the next operation is started on this connection.
+     * \n
+     * Events are only read when this function is called. If the client processes events
+     * slower than the server generates them, the server will wait for the client.
+     * \n
+     * If `st.complete() == true`, returns a default-constructed event without performing any I/O.
+     * If `st.started() == false`, fails with \ref client_errc::binlog_stream_not_started.
+     *
+     * \par Experimental
+     * This part of the API is experimental, and may change in successive
+     * releases without previous notice.
+     */
+    binlog_event read_binlog_event(binlog_stream& st, error_code& err, diagnostics& diag)
+    {
+        return impl_.run(detail::read_binlog_event_algo_params{&detail::access::get_impl(st)}, err, diag);
+    }
+
+    /// \copydoc read_binlog_event
+    binlog_event read_binlog_event(binlog_stream& st)
+    {
+        error_code err;
+        diagnostics diag;
+        binlog_event res = read_binlog_event(st, err, diag);
+        detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+        return res;
+    }
+
+    /**
+     * \copydoc read_binlog_event
+     * \details
+     * \par Handler signature
+     * The handler signature for this operation is
+     * `void(boost::mysql::error_code, boost::mysql::binlog_event)`.
+     *
+     * \par Executor
+     * Intermediate completion handlers, as well as the final handler, are executed using
+     * `token`'s associated executor, or `this->get_executor()` if the token doesn't have an associated
+     * executor.
+     *
+     * If the final handler has an associated immediate executor, and the operation
+     * completes immediately, the final handler is dispatched to it.
+     * Otherwise, the final handler is called as if it was submitted using `asio::post`,
+     * and is never be called inline from within this function.
+     *
+     * \par Object lifetimes
+     * `st` must be kept alive and should not be modified until the operation completes.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::binlog_event))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_binlog_event(binlog_stream& st, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_binlog_event_t<CompletionToken&&>)
+    {
+        return async_read_binlog_event(st, impl_.shared_diag(), std::forward<CompletionToken>(token));
+    }
+
+    /// \copydoc async_read_binlog_event
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, ::boost::mysql::binlog_event))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_read_binlog_event(binlog_stream& st, diagnostics& diag, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(detail::async_read_binlog_event_t<CompletionToken&&>)
+    {
+        return impl_.async_run(
+            detail::read_binlog_event_algo_params{&detail::access::get_impl(st)},
+            diag,
+            std::forward<CompletionToken>(token)
+        );
+    }
 };
 
 }  // namespace mysql
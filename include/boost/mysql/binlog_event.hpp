@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_BINLOG_EVENT_HPP
+#define BOOST_MYSQL_BINLOG_EVENT_HPP
+
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The type of a binary log event.
+ * \details
+ * Only the event types that are decoded by this library have a named enumerator.
+ * Other event types are still reported by \ref binlog_stream, and their raw contents
+ * can be accessed using \ref binlog_event::data.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+enum class binlog_event_type : std::uint8_t
+{
+    /// Not a real event type. Used for default-constructed events and unknown event types.
+    unknown = 0,
+
+    /// A statement was executed. Emitted for `BEGIN` and DDL statements in row-based replication.
+    query = 2,
+
+    /// The server switched to a new binary log file.
+    rotate = 4,
+
+    /// Describes the format of the binary log. Sent at the beginning of every file.
+    format_description = 15,
+
+    /// A transaction was committed.
+    xid = 16,
+
+    /// Maps a table ID to a table definition. Precedes row events.
+    table_map = 19,
+
+    /// Rows were inserted (version 1 row events, as sent by old servers).
+    write_rows_v1 = 23,
+
+    /// Rows were updated (version 1 row events, as sent by old servers).
+    update_rows_v1 = 24,
+
+    /// Rows were deleted (version 1 row events, as sent by old servers).
+    delete_rows_v1 = 25,
+
+    /// Sent by the server when no events happen within the heartbeat period.
+    heartbeat = 27,
+
+    /// Rows were inserted.
+    write_rows = 30,
+
+    /// Rows were updated.
+    update_rows = 31,
+
+    /// Rows were deleted.
+    delete_rows = 32,
+
+    /// A transaction identified by a GTID is about to start.
+    gtid = 33,
+
+    /// A transaction without a GTID is about to start.
+    anonymous_gtid = 34,
+
+    /// The set of GTIDs contained in previous binary log files.
+    previous_gtids = 35,
+};
+
+/**
+ * \brief (EXPERIMENTAL) A binary log event, as read by \ref any_connection::read_binlog_event.
+ * \details
+ * This is a non-owning type. It points into the connection's internal buffers and into
+ * the \ref binlog_stream object that was used to read the event. It becomes invalid
+ * once the next operation is started on the connection, or once the stream is destroyed.
+ * \n
+ * Row images are decoded into \ref field_view objects without copying strings and blobs.
+ * Columns not included in an image (as happens with `binlog_row_image=MINIMAL`) are reported as `NULL`.
+ * Since the binary log doesn't convey column collations, `CHAR` and `VARCHAR` columns
+ * are reported as strings, while `BLOB`, `TEXT`, `JSON` and `GEOMETRY` columns are reported as blobs.
+ * `JSON` columns are reported in MySQL's internal binary format. `DECIMAL` columns
+ * are reported as strings, as in the rest of the library.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class binlog_event
+{
+#ifndef BOOST_MYSQL_DOXYGEN
+    struct impl_t
+    {
+        binlog_event_type type{binlog_event_type::unknown};
+        std::uint8_t raw_type{};
+        std::uint32_t timestamp{};
+        std::uint32_t server_id{};
+        std::uint32_t log_position{};
+        span<const std::uint8_t> data;
+        string_view database;
+        string_view table;
+        string_view query;
+        string_view next_log_file;
+        std::uint64_t next_log_position{};
+        gtid_source_id gtid_source{};
+        std::uint64_t gtid_transaction_id{};
+        rows_view rows_before;
+        rows_view rows_after;
+    } impl_;
+
+    friend struct detail::access;
+#endif
+
+public:
+    /**
+     * \brief Default constructor.
+     * \details Constructs an event with \ref binlog_event_type::unknown type and no data.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    binlog_event() = default;
+
+    /**
+     * \brief Returns the event type.
+     * \details
+     * If the event type is not known by this library, returns \ref binlog_event_type::unknown.
+     * Use \ref raw_type to retrieve the actual type code in this case.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    binlog_event_type type() const noexcept { return impl_.type; }
+
+    /**
+     * \brief Returns the event type code, as sent by the server.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint8_t raw_type() const noexcept { return impl_.raw_type; }
+
+    /**
+     * \brief Returns the time when the event was created, as seconds since the UNIX epoch.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint32_t timestamp() const noexcept { return impl_.timestamp; }
+
+    /**
+     * \brief Returns the ID of the server where the event originated.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint32_t server_id() const noexcept { return impl_.server_id; }
+
+    /**
+     * \brief Returns the position of the next event in the current binary log file.
+     * \details Artificial events generated by the server have a zero position.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint32_t log_position() const noexcept { return impl_.log_position; }
+
+    /**
+     * \brief Returns the raw event contents.
+     * \details
+     * Contains the event data following the common event header,
+     * excluding the checksum, if any.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<const std::uint8_t> data() const noexcept { return impl_.data; }
+
+    /**
+     * \brief Returns the database affected by the event.
+     * \details
+     * Only meaningful for query, table map and row events. Otherwise, returns an empty string.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view database() const noexcept { return impl_.database; }
+
+    /**
+     * \brief Returns the table affected by the event.
+     * \details
+     * Only meaningful for table map and row events. Otherwise, returns an empty string.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view table() const noexcept { return impl_.table; }
+
+    /**
+     * \brief Returns the SQL text of a query event.
+     * \details Only meaningful for query events. Otherwise, returns an empty string.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view query() const noexcept { return impl_.query; }
+
+    /**
+     * \brief Returns the file name contained in a rotate event.
+     * \details Only meaningful for rotate events. Otherwise, returns an empty string.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view next_log_file() const noexcept { return impl_.next_log_file; }
+
+    /**
+     * \brief Returns the position contained in a rotate event.
+     * \details Only meaningful for rotate events. Otherwise, returns zero.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t next_log_position() const noexcept { return impl_.next_log_position; }
+
+    /**
+     * \brief Returns the source ID of the GTID contained in a GTID event.
+     * \details Only meaningful for \ref binlog_event_type::gtid events. Otherwise, returns all zeros.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    const gtid_source_id& gtid_source() const noexcept { return impl_.gtid_source; }
+
+    /**
+     * \brief Returns the transaction ID of the GTID contained in a GTID event.
+     * \details Only meaningful for \ref binlog_event_type::gtid events. Otherwise, returns zero.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t gtid_transaction_id() const noexcept { return impl_.gtid_transaction_id; }
+
+    /**
+     * \brief Returns the row images before the change.
+     * \details
+     * Only meaningful for update and delete row events. Otherwise, returns an empty collection.
+     * For update events, `rows_before()[i]` and `rows_after()[i]` correspond to the same row.
+     * Each row has as many fields as columns has the table.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    rows_view rows_before() const noexcept { return impl_.rows_before; }
+
+    /**
+     * \brief Returns the row images after the change.
+     * \details
+     * Only meaningful for write and update row events. Otherwise, returns an empty collection.
+     * For update events, `rows_before()[i]` and `rows_after()[i]` correspond to the same row.
+     * Each row has as many fields as columns has the table.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    rows_view rows_after() const noexcept { return impl_.rows_after; }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
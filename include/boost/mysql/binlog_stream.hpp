@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_BINLOG_STREAM_HPP
+#define BOOST_MYSQL_BINLOG_STREAM_HPP
+
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/binlog_stream_impl.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) Parameters for \ref any_connection::start_binlog_dump.
+ * \details
+ * Determines where replication starts from. If \ref gtids is not empty, the server
+ * will send all transactions not contained in it (GTID-based replication).
+ * Otherwise, if \ref log_file is not empty, the server will send events starting at
+ * \ref log_position in that file (position-based replication). Otherwise, the server
+ * sends all the events contained in its binary logs.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+struct binlog_dump_params
+{
+    /**
+     * \brief The server ID to register as.
+     * \details
+     * Must be non-zero and different from the IDs of the source server
+     * and any other replicas connected to it.
+     */
+    std::uint32_t server_id{};
+
+    /// The set of GTIDs already processed by the client.
+    gtid_set gtids;
+
+    /// The binary log file to start from. Only used if \ref gtids is empty.
+    std::string log_file;
+
+    /// The position within \ref log_file to start from. Only used if \ref gtids is empty.
+    std::uint64_t log_position{4};
+
+    /**
+     * \brief Whether to end the stream once the server has sent all its events.
+     * \details
+     * If `false` (the default), the server keeps the stream open and sends new events as they happen.
+     * If `true`, the stream completes once there are no more events to send.
+     */
+    bool non_blocking{false};
+};
+
+/**
+ * \brief (EXPERIMENTAL) Holds the state of a binary log stream.
+ * \details
+ * A binlog stream is started by \ref any_connection::start_binlog_dump. Events are then read
+ * one by one using \ref any_connection::read_binlog_event. This object holds the state required
+ * to decode events (like table definitions and checksum configuration) and tracks the replication
+ * position, which can be used to resume replication on a new connection.
+ * \n
+ * The server only sends events as fast as the client reads them (subject to TCP flow control),
+ * so a slow consumer naturally applies backpressure.
+ * \n
+ * Once a binlog dump has been started, the connection can't be used for any other operation.
+ * To stop replicating, close the connection.
+ * \n
+ * This feature requires MySQL. MariaDB is not supported.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class binlog_stream
+{
+public:
+    /**
+     * \brief Default constructor.
+     * \details The constructed object has \ref started `== false`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    binlog_stream() = default;
+
+    /**
+     * \brief Returns whether a binlog dump has been started using this object.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool started() const noexcept { return impl_.started; }
+
+    /**
+     * \brief Returns whether the server has finished sending events.
+     * \details
+     * Can only become `true` if the dump was started with \ref binlog_dump_params::non_blocking
+     * set to `true`. Once the stream is complete, \ref any_connection::read_binlog_event returns
+     * default-constructed events.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool complete() const noexcept { return impl_.complete; }
+
+    /**
+     * \brief Returns the set of GTIDs whose transactions have been completely read.
+     * \details
+     * A GTID is added once its transaction has been committed (i.e. when the transaction's
+     * `XID` event or the corresponding DDL query event has been read). Initialized to
+     * \ref binlog_dump_params::gtids when the dump starts. Pass it to a new dump to resume replication.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    const gtid_set& executed_gtids() const noexcept { return impl_.executed_gtids; }
+
+    /**
+     * \brief Returns the binary log file being read.
+     * \details Updated by rotate events.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view log_file() const noexcept { return impl_.log_file; }
+
+    /**
+     * \brief Returns the position of the next event to read within \ref log_file.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t log_position() const noexcept { return impl_.log_position; }
+
+private:
+    detail::binlog_stream_impl impl_;
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,289 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_BULK_INSERT_HPP
+#define BOOST_MYSQL_BULK_INSERT_HPP
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/constant_string_view.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/with_diagnostics.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/bulk_insert.hpp>
+#include <boost/mysql/detail/initiation_base.hpp>
+#include <boost/mysql/detail/throw_on_error_loc.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/deferred.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) Configuration parameters for \ref bulk_insert and \ref async_bulk_insert.
+ */
+struct bulk_insert_params
+{
+    /**
+     * \brief The maximum size of each `INSERT` statement, in bytes.
+     * \details
+     * Rows are added to a statement until the next one would make it exceed this size.
+     * The statement is then sent, and a new one is started.
+     * This value should not be greater than the server's `max_allowed_packet` system variable.
+     * \n
+     * Statements are limited to a single protocol frame, so values greater than
+     * 16MB (`0xfffffe` bytes) behave as if `0xfffffe` had been specified.
+     */
+    std::size_t max_statement_size{0x400000};
+
+    /**
+     * \brief The approximate maximum amount of memory to use for statements, in bytes.
+     * \details
+     * Statements are pipelined: they are sent to the server together, and their responses
+     * are read together, saving round-trips. Statements are added to a pipeline until
+     * its size reaches this value, so memory usage is bounded by
+     * `max_pipeline_size + max_statement_size` bytes.
+     * If smaller than `max_statement_size`, statements are sent one by one.
+     */
+    std::size_t max_pipeline_size{0x1000000};
+};
+
+namespace detail {
+
+BOOST_MYSQL_DECL
+std::uint64_t bulk_insert_erased(
+    any_connection& conn,
+    string_view insert_prefix,
+    bulk_insert_row_source& rows,
+    const bulk_insert_params& params,
+    error_code& err,
+    diagnostics& diag
+);
+
+BOOST_MYSQL_DECL
+void async_bulk_insert_erased(
+    any_connection& conn,
+    string_view insert_prefix,
+    std::unique_ptr<bulk_insert_row_source> rows,
+    const bulk_insert_params& params,
+    diagnostics& diag,
+    asio::any_completion_handler<void(error_code, std::uint64_t)> handler
+);
+
+struct initiate_bulk_insert : initiation_base
+{
+    using initiation_base::initiation_base;
+
+    // Having diagnostics* here makes async_bulk_insert compatible with with_diagnostics
+    template <class Handler>
+    void operator()(
+        Handler&& handler,
+        diagnostics* diag,
+        any_connection* conn,
+        string_view insert_prefix,
+        std::unique_ptr<bulk_insert_row_source> rows,
+        bulk_insert_params params
+    )
+    {
+        async_bulk_insert_erased(
+            *conn,
+            insert_prefix,
+            std::move(rows),
+            params,
+            *diag,
+            std::forward<Handler>(handler)
+        );
+    }
+};
+
+}  // namespace detail
+
+/**
+ * \brief (EXPERIMENTAL) Inserts many rows into a table, splitting them into several statements.
+ * \details
+ * Composes `INSERT` statements with the form `insert_prefix (value1, value2...), (value1, value2...)...`
+ * and executes them using `conn`. Each statement contains as many rows as fit
+ * into `params.max_statement_size` bytes, so statements don't exceed
+ * the server's `max_allowed_packet` limit. Several statements are sent
+ * together, as a pipeline (see \ref any_connection::run_pipeline).
+ * \n
+ * `rows` is an input range, with elements of type `std::tuple` or Boost.Describe structs.
+ * Each tuple element or described member is formatted as if passed to \ref format_sql
+ * (built-in types, types with a custom \ref formatter specialization and ranges are supported),
+ * in the order they appear in the tuple or the struct. For example, if `rows` contains
+ * `std::tuple<int, std::string>` elements, `insert_prefix` might be
+ * `"INSERT INTO employee (id, name) VALUES "`. Rows are formatted
+ * incrementally, directly into the pipeline request, so memory usage doesn't
+ * depend on the number of rows (see \ref bulk_insert_params::max_pipeline_size).
+ * \n
+ * Formatting uses the connection's current format options. If the character set
+ * used by the connection is unknown, fails with \ref client_errc::unknown_character_set.
+ * \n
+ * Returns the total number of affected rows, as reported by the server.
+ * The number includes rows inserted before an error was encountered.
+ *
+ * \par Errors
+ * \li \ref client_errc::unknown_character_set if the connection's character set is unknown.
+ * \li \ref client_errc::bulk_insert_row_too_large if a single row doesn't fit into an `INSERT` statement.
+ * \li Any error generated while formatting rows (see \ref format_sql_to).
+ * \li Any error returned by the server when executing the statements.
+ *
+ * Statements are independent from each other. If a statement fails, previously executed ones
+ * are not rolled back, and statements that were sent in the same pipeline are executed.
+ * No statements are sent after the pipeline containing the failed one.
+ * Run this function in a transaction to get all-or-nothing semantics.
+ *
+ * \par Object lifetimes
+ * `insert_prefix` is copied and doesn't need to be kept alive.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+template <class InputRange>
+std::uint64_t bulk_insert(
+    any_connection& conn,
+    constant_string_view insert_prefix,
+    InputRange&& rows,
+    const bulk_insert_params& params,
+    error_code& err,
+    diagnostics& diag
+)
+{
+    auto source = detail::make_bulk_insert_range_source(rows);
+    return detail::bulk_insert_erased(conn, insert_prefix.get(), source, params, err, diag);
+}
+
+/// \copydoc bulk_insert
+template <class InputRange>
+std::uint64_t bulk_insert(
+    any_connection& conn,
+    constant_string_view insert_prefix,
+    InputRange&& rows,
+    const bulk_insert_params& params = {}
+)
+{
+    error_code err;
+    diagnostics diag;
+    auto res = bulk_insert(conn, insert_prefix, rows, params, err, diag);
+    detail::throw_on_error_loc(err, diag, BOOST_CURRENT_LOCATION);
+    return res;
+}
+
+/**
+ * \copydoc bulk_insert
+ * \details
+ * \par Object lifetimes
+ * `rows` and `diag` must be kept alive until the operation completes.
+ * `rows` must be an lvalue: the operation only stores iterators into it,
+ * so passing a temporary range is a compile-time error.
+ *
+ * \par Handler signature
+ * The handler signature for this operation is `void(boost::mysql::error_code, std::uint64_t)`.
+ *
+ * \par Per-operation cancellation
+ * This operation supports the same cancellation types as \ref any_connection::async_run_pipeline.
+ */
+template <
+    class InputRange,
+    BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::uint64_t))
+        CompletionToken = with_diagnostics_t<asio::deferred_t>>
+auto async_bulk_insert(
+    any_connection& conn,
+    constant_string_view insert_prefix,
+    InputRange&& rows,
+    const bulk_insert_params& params,
+    diagnostics& diag,
+    CompletionToken&& token = {}
+)
+    BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code, std::uint64_t)>(
+        std::declval<detail::initiate_bulk_insert>(),
+        token,
+        &diag,
+        &conn,
+        insert_prefix.get(),
+        std::unique_ptr<detail::bulk_insert_row_source>(),
+        params
+    )))
+{
+    // With deferred tokens, the operation may be started after the full expression ends
+    static_assert(
+        std::is_lvalue_reference<InputRange>::value,
+        "async_bulk_insert: rows must be an lvalue, and must be kept alive until the operation completes"
+    );
+
+    // Iterators must outlive the initiating function
+    using source_t = decltype(detail::make_bulk_insert_range_source(rows));
+    std::unique_ptr<detail::bulk_insert_row_source> source(new source_t(detail::make_bulk_insert_range_source(rows)
+    ));
+    return asio::async_initiate<CompletionToken, void(error_code, std::uint64_t)>(
+        detail::initiate_bulk_insert{conn.get_executor()},
+        token,
+        &diag,
+        &conn,
+        insert_prefix.get(),
+        std::move(source),
+        params
+    );
+}
+
+/// \copydoc async_bulk_insert
+template <
+    class InputRange,
+    BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code, std::uint64_t))
+        CompletionToken = with_diagnostics_t<asio::deferred_t>>
+auto async_bulk_insert(
+    any_connection& conn,
+    constant_string_view insert_prefix,
+    InputRange&& rows,
+    const bulk_insert_params& params,
+    CompletionToken&& token = {}
+)
+    BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code, std::uint64_t)>(
+        std::declval<detail::initiate_bulk_insert>(),
+        token,
+        static_cast<diagnostics*>(nullptr),
+        &conn,
+        insert_prefix.get(),
+        std::unique_ptr<detail::bulk_insert_row_source>(),
+        params
+    )))
+{
+    return async_bulk_insert(
+        conn,
+        insert_prefix,
+        std::forward<InputRange>(rows),
+        params,
+        detail::access::get_impl(conn).shared_diag(),
+        std::forward<CompletionToken>(token)
+    );
+}
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/bulk_insert.ipp>
+#endif
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -138,6 +138,21 @@ enum class client_errc : int
      * size. Try increasing \ref any_connection_params::max_buffer_size.
      */
     max_buffer_size_exceeded,
+
+    /// A string passed to \ref gtid_set::parse does not contain a valid GTID set.
+    invalid_gtid_set,
+
+    /**
+     * \brief A row passed to \ref bulk_insert or \ref async_bulk_insert is too large to fit
+     * into a single `INSERT` statement. Try increasing \ref bulk_insert_params::max_statement_size.
+     */
+    bulk_insert_row_too_large,
+
+    /**
+     * \brief \ref any_connection::read_binlog_event was called with a \ref binlog_stream
+     * that hasn't been started. Call \ref any_connection::start_binlog_dump first.
+     */
+    binlog_stream_not_started,
 };
 
 BOOST_MYSQL_DECL
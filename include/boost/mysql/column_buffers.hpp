@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COLUMN_BUFFERS_HPP
+#define BOOST_MYSQL_COLUMN_BUFFERS_HPP
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/typing/column_parser.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/utility.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+template <std::size_t N>
+struct column_buffers_impl
+{
+    std::array<void*, N> columns{};
+    unsigned char* null_bitmap{};  // nullptr if not supplied
+    std::size_t capacity{};
+};
+
+}  // namespace detail
+
+/**
+ * \brief User-supplied storage to read rows column by column (structure of arrays).
+ * \details
+ * Passed to the `read_some_rows` overloads taking a `static_execution_state`. Instead of
+ * reading each row into a `StaticRow` object, each member of `StaticRow` is written into
+ * its own array, supplied by the user as a `span`. This is useful when the values are
+ * to be handed to code that operates on columns (e.g. compression or vectorized algorithms).
+ * Values are parsed directly from the messages received from the server, without
+ * creating intermediate \ref field_view objects.
+ * \n
+ * `StaticRow` must be one of the row types of the `static_execution_state` being read.
+ * The row's members determine the columns' element types, in the order in which they
+ * appear in the row. For a member of type `T`, the column must be a `span<T>`.
+ * For optional members (like `std::optional<T>` or `boost::optional<T>`),
+ * the column must be a `span<T>`, and NULL values are reported in the NULL bitmap.
+ * \n
+ * The NULL bitmap contains a bit per field, in row-major order: for the field in row `r`
+ * and column `c`, the bit `r * num_columns + c` is set if the field is NULL, and cleared
+ * otherwise. Bits are numbered starting from the least significant bit of the first byte.
+ * Column elements corresponding to NULL values are value-initialized.
+ * The bitmap is only used if any of the columns is optional. If it's not supplied and
+ * a NULL value is read into an optional member, the operation fails with
+ * \ref client_errc::static_row_parsing_error.
+ * \n
+ * Objects of this type don't own the memory for the columns, and must be kept alive
+ * (together with the memory they reference) until the operation they're used in completes.
+ */
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+class column_buffers
+{
+    template <class T>
+    using span_t = span<T>;
+
+public:
+#ifdef BOOST_MYSQL_DOXYGEN
+    /**
+     * \brief A `std::tuple` with a `span` type for each member of `StaticRow`.
+     * \details
+     * For a `StaticRow` with members of type `std::int64_t`, `std::optional<double>`
+     * and \ref datetime, this is `std::tuple<span<std::int64_t>, span<double>, span<datetime>>`.
+     */
+    using spans_type = __see_below__;
+#else
+    using spans_type = mp11::mp_rename<
+        mp11::mp_transform<
+            span_t,
+            mp11::mp_transform<detail::column_value_t, detail::row_field_types_t<StaticRow>>>,
+        std::tuple>;
+#endif
+
+    /// The number of columns.
+    static constexpr std::size_t num_columns = detail::get_row_size<StaticRow>();
+
+    /**
+     * \brief Constructor.
+     * \details
+     * `null_bitmap` should have space for a bit per field. If it's empty, reading a NULL
+     * value into an optional member fails with \ref client_errc::static_row_parsing_error.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The memory referenced by `columns` and `null_bitmap` must be kept alive while `*this`
+     * is used.
+     */
+    explicit column_buffers(const spans_type& columns, span<unsigned char> null_bitmap = {}) noexcept
+        : columns_(columns), null_bitmap_(null_bitmap)
+    {
+        void** it = impl_.columns.data();
+        std::size_t capacity = (std::numeric_limits<std::size_t>::max)();
+        mp11::tuple_for_each(columns_, column_visitor{it, capacity});
+        if (detail::has_nullable_columns<StaticRow>() && !null_bitmap_.empty())
+        {
+            std::size_t bitmap_rows = null_bitmap_.size() * 8u / num_columns;
+            capacity = bitmap_rows < capacity ? bitmap_rows : capacity;
+            impl_.null_bitmap = null_bitmap_.data();
+        }
+        impl_.capacity = capacity;
+    }
+
+    /**
+     * \brief Returns the columns passed to the constructor.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    const spans_type& columns() const noexcept { return columns_; }
+
+    /**
+     * \brief Returns the NULL bitmap passed to the constructor.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    span<unsigned char> null_bitmap() const noexcept { return null_bitmap_; }
+
+    /**
+     * \brief Returns the maximum number of rows that can be stored.
+     * \details
+     * This is the size of the smallest column. If any column is optional and
+     * a NULL bitmap was supplied, the bitmap size is also taken into account.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t capacity() const noexcept { return impl_.capacity; }
+
+    /**
+     * \brief Returns whether the field at the given row and column is NULL.
+     * \details
+     * Reads the NULL bitmap. The result is unspecified if the given row hasn't been
+     * read by a `read_some_rows` operation.
+     *
+     * \par Preconditions
+     * `row < this->capacity() && column < num_columns && !this->null_bitmap().empty()`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_null(std::size_t row, std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(column < num_columns);
+        std::size_t bit = row * num_columns + column;
+        BOOST_ASSERT(bit / 8u < null_bitmap_.size());
+        return (null_bitmap_[bit / 8u] >> (bit % 8u)) & 1u;
+    }
+
+private:
+    spans_type columns_;
+    span<unsigned char> null_bitmap_;
+    detail::column_buffers_impl<num_columns> impl_;
+
+    // Stores a type-erased pointer to each column, and computes the capacity
+    struct column_visitor
+    {
+        void**& it;
+        std::size_t& capacity;
+
+        template <class T>
+        void operator()(span<T> col) const noexcept
+        {
+            *it++ = col.data();
+            capacity = col.size() < capacity ? col.size() : capacity;
+        }
+    };
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+constexpr std::size_t column_buffers<StaticRow>::num_columns;
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -0,0 +1,347 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COMPACT_ROWS_HPP
+#define BOOST_MYSQL_COMPACT_ROWS_HPP
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+// Each cell in a compact_rows is a 8 byte payload plus a 1 byte kind.
+// The first values match field_kind. The rest represent values that don't fit
+// in a payload, and are stored in side tables (the payload is an index into them).
+enum class compact_kind : std::uint8_t
+{
+    null = 0,
+    int64,
+    uint64,
+    string,    // payload: offset (32 bits) and size (32 bits) into the string buffer
+    blob,      // same as string
+    float_,    // payload: the float's bits, in the lower 32 bits
+    double_,   // payload: the double's bits
+    date,      // payload: year (16 bits), month (8 bits), day (8 bits)
+    datetime,  // payload: packed, see compact_datetime
+    time,      // payload: number of microseconds
+    wide_string,
+    wide_blob,
+    wide_datetime,
+};
+
+// Offset and size into the string buffer, for strings too big to fit in a payload
+struct compact_wide_string
+{
+    std::size_t offset;
+    std::size_t size;
+};
+
+// Bit layout for datetimes. Values returned by the server always fit.
+// Values with out-of-range components (like a year bigger than 16383) go into a side table.
+struct compact_datetime
+{
+    static constexpr unsigned year_bits = 14u;
+    static constexpr unsigned month_bits = 4u;
+    static constexpr unsigned day_bits = 5u;
+    static constexpr unsigned hour_bits = 5u;
+    static constexpr unsigned minute_bits = 6u;
+    static constexpr unsigned second_bits = 6u;
+    static constexpr unsigned microsecond_bits = 20u;
+
+    static constexpr unsigned microsecond_shift = 0u;
+    static constexpr unsigned second_shift = microsecond_shift + microsecond_bits;
+    static constexpr unsigned minute_shift = second_shift + second_bits;
+    static constexpr unsigned hour_shift = minute_shift + minute_bits;
+    static constexpr unsigned day_shift = hour_shift + hour_bits;
+    static constexpr unsigned month_shift = day_shift + day_bits;
+    static constexpr unsigned year_shift = month_shift + month_bits;
+
+    static constexpr std::uint64_t get(std::uint64_t payload, unsigned shift, unsigned bits) noexcept
+    {
+        return (payload >> shift) & ((std::uint64_t(1) << bits) - 1u);
+    }
+
+    static datetime unpack(std::uint64_t payload) noexcept
+    {
+        return datetime(
+            static_cast<std::uint16_t>(get(payload, year_shift, year_bits)),
+            static_cast<std::uint8_t>(get(payload, month_shift, month_bits)),
+            static_cast<std::uint8_t>(get(payload, day_shift, day_bits)),
+            static_cast<std::uint8_t>(get(payload, hour_shift, hour_bits)),
+            static_cast<std::uint8_t>(get(payload, minute_shift, minute_bits)),
+            static_cast<std::uint8_t>(get(payload, second_shift, second_bits)),
+            static_cast<std::uint32_t>(get(payload, microsecond_shift, microsecond_bits))
+        );
+    }
+};
+
+}  // namespace detail
+
+/**
+ * \brief An owning, read-only sequence of rows, optimized for memory usage.
+ * \details
+ * Holds the same values as \ref rows, but uses about a third of the memory when
+ * storing numeric, date/time or NULL values. Each field is stored as an 8 byte cell
+ * plus a one byte tag, instead of as a \ref field_view (24 bytes on most systems).
+ * Strings and blobs are copied into a single buffer owned by this object, and cells
+ * store their offset and size within it. Dates and datetimes are bit-packed.
+ * \n
+ * This makes iterating large resultsets more cache-friendly, at the cost of a small
+ * decoding step on access. Elements are accessed by row and column index, and are
+ * returned as \ref field_view objects, constructed on demand. Since fields aren't stored
+ * contiguously as `field_view`s, this class can't provide \ref row_view or \ref rows_view objects.
+ * \n
+ * Objects of this type are populated from \ref rows_view objects, by construction or
+ * by calling \ref append. For instance, you can build a `compact_rows` object
+ * by appending the results of successive `read_some_rows` operations, without ever
+ * holding the entire resultset as `field_view`s.
+ */
+class compact_rows
+{
+public:
+    /**
+     * \brief Constructs an empty object.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    compact_rows() = default;
+
+    /**
+     * \brief Constructs an empty object that allocates memory using `alloc`.
+     * \details
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    explicit compact_rows(const Allocator& alloc) noexcept
+        : payloads_(alloc), kinds_(alloc), strings_(alloc), wide_strings_(alloc), wide_datetimes_(alloc)
+    {
+    }
+
+    /**
+     * \brief Constructs an object containing a copy of the rows in `r`.
+     * \par Exception safety
+     * Strong guarantee. Internal allocations may throw.
+     *
+     * \par Object lifetimes
+     * `*this` lifetime will be independent of `r`'s (the contents of `r` will be copied
+     * into `*this`).
+     *
+     * \par Complexity
+     * Linear on `r.size() * r.num_columns()`.
+     */
+    explicit compact_rows(const rows_view& r) { append(r); }
+
+    /**
+     * \brief Appends the rows in `r` to `*this`.
+     * \details
+     * If `*this` is empty, `r` determines the number of columns. Otherwise,
+     * `r.num_columns()` must be equal to `this->num_columns()`.
+     *
+     * \par Exception safety
+     * Strong guarantee. Internal allocations may throw.
+     * Throws `std::invalid_argument` if `r` has a different number of columns than `*this`.
+     *
+     * \par Object lifetimes
+     * `field_view`s obtained from `*this` pointing to strings or blobs are invalidated.
+     *
+     * \par Complexity
+     * Linear on `r.size() * r.num_columns()`, amortized.
+     */
+    BOOST_MYSQL_DECL
+    void append(const rows_view& r);
+
+    /**
+     * \brief Returns the field at the given row and column, checking bounds.
+     * \details
+     * The returned object is constructed on demand. If it's a string or blob,
+     * it points into memory owned by `*this`.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws `std::out_of_range` if `row >= this->size()`
+     * or `column >= this->num_columns()`.
+     *
+     * \par Object lifetimes
+     * The returned object is valid until `*this` is destroyed, cleared or appended to.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    field_view at(std::size_t row, std::size_t column) const
+    {
+        if (row >= size() || column >= num_columns_)
+            BOOST_THROW_EXCEPTION(std::out_of_range("compact_rows::at"));
+        return get(row * num_columns_ + column);
+    }
+
+    /**
+     * \brief Returns the field at the given row and column (unchecked access).
+     * \par Preconditions
+     * `row < this->size() && column < this->num_columns()`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned object is valid until `*this` is destroyed, cleared or appended to.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    field_view operator()(std::size_t row, std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(row < size());
+        BOOST_ASSERT(column < num_columns_);
+        return get(row * num_columns_ + column);
+    }
+
+    /**
+     * \brief Returns the number of rows.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return num_columns_ == 0u ? 0u : kinds_.size() / num_columns_; }
+
+    /**
+     * \brief Returns whether `*this` contains any rows.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return kinds_.empty(); }
+
+    /**
+     * \brief Returns the number of columns each row has.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t num_columns() const noexcept { return num_columns_; }
+
+    /**
+     * \brief Removes all rows, keeping allocated memory.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * `field_view`s obtained from `*this` pointing to strings or blobs are invalidated.
+     */
+    void clear() noexcept
+    {
+        payloads_.clear();
+        kinds_.clear();
+        strings_.clear();
+        wide_strings_.clear();
+        wide_datetimes_.clear();
+        num_columns_ = 0u;
+    }
+
+private:
+    template <class T>
+    using vector_type = std::vector<T, detail::erased_allocator<T>>;
+
+    vector_type<std::uint64_t> payloads_;
+    vector_type<detail::compact_kind> kinds_;
+    vector_type<unsigned char> strings_;
+    vector_type<detail::compact_wide_string> wide_strings_;
+    vector_type<datetime> wide_datetimes_;
+    std::size_t num_columns_{};
+
+    BOOST_MYSQL_DECL
+    void push_field(field_view f);
+
+    template <class T>
+    T load_payload(std::size_t i) const noexcept
+    {
+        static_assert(sizeof(T) <= sizeof(std::uint64_t), "");
+        T res;
+        std::memcpy(&res, &payloads_[i], sizeof(T));
+        return res;
+    }
+
+    string_view str_at(std::size_t offset, std::size_t size) const noexcept
+    {
+        return string_view(reinterpret_cast<const char*>(strings_.data()) + offset, size);
+    }
+
+    blob_view blob_at(std::size_t offset, std::size_t size) const noexcept
+    {
+        return blob_view(strings_.data() + offset, size);
+    }
+
+    field_view get(std::size_t i) const noexcept
+    {
+        std::uint64_t p = payloads_[i];
+        switch (kinds_[i])
+        {
+        case detail::compact_kind::int64: return field_view(load_payload<std::int64_t>(i));
+        case detail::compact_kind::uint64: return field_view(p);
+        case detail::compact_kind::string: return field_view(str_at(p >> 32u, p & 0xffffffffu));
+        case detail::compact_kind::blob: return field_view(blob_at(p >> 32u, p & 0xffffffffu));
+        case detail::compact_kind::float_: return field_view(load_payload<float>(i));
+        case detail::compact_kind::double_: return field_view(load_payload<double>(i));
+        case detail::compact_kind::date:
+            return field_view(date(
+                static_cast<std::uint16_t>(p >> 16u),
+                static_cast<std::uint8_t>((p >> 8u) & 0xffu),
+                static_cast<std::uint8_t>(p & 0xffu)
+            ));
+        case detail::compact_kind::datetime: return field_view(detail::compact_datetime::unpack(p));
+        case detail::compact_kind::time: return field_view(time(load_payload<std::int64_t>(i)));
+        case detail::compact_kind::wide_string:
+            return field_view(str_at(wide_strings_[p].offset, wide_strings_[p].size));
+        case detail::compact_kind::wide_blob:
+            return field_view(blob_at(wide_strings_[p].offset, wide_strings_[p].size));
+        case detail::compact_kind::wide_datetime: return field_view(wide_datetimes_[p]);
+        case detail::compact_kind::null:
+        default: return field_view();
+        }
+    }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/compact_rows.ipp>
+#endif
+
+#endif
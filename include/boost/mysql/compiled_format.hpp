@@ -0,0 +1,300 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_COMPILED_FORMAT_HPP
+#define BOOST_MYSQL_COMPILED_FORMAT_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/constant_string_view.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/with_params.hpp>
+
+#include <boost/mysql/detail/compiled_format_parser.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/format_sql.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A format string that has been parsed at compile time.
+ * \details
+ * Contains a format string, as accepted by \ref format_sql, split into a flat sequence of
+ * steps. Each step either appends a piece of the format string to the output, or
+ * formats one of the arguments. Formatting with a `compiled_format` just runs these steps,
+ * rather than parsing the format string every time.
+ * \n
+ * When constructed in a constant expression (e.g. as a `constexpr` variable),
+ * the format string is parsed and validated at compile time. A malformed format string
+ * (e.g. an unbalanced brace or a mix of automatic and manual indexing) is a compilation error.
+ * The \ref BOOST_MYSQL_COMPILE_FORMAT macro computes `NumSteps` for you:
+ * ```
+ * static constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT("SELECT * FROM employee WHERE id = {}");
+ * conn.execute(with_params(query, 42), result);
+ * ```
+ * \n
+ * Compiled format strings can be used with \ref format_sql, \ref format_sql_to and \ref with_params.
+ * Formatting produces the same output and errors as the equivalent non-compiled format string,
+ * except for format string syntax errors, which are detected when compiling. Arguments are still
+ * checked when formatting, since their number and types are not part of the compiled format.
+ * \n
+ * Format strings containing non-ASCII characters must be parsed using the character set
+ * in use, which is only known when formatting (in some character sets, bytes like `{` may be part
+ * of a multi-byte character). Such strings are not parsed when compiled. They're parsed when
+ * formatting, as if they weren't compiled, and any syntax error is reported then.
+ *
+ * \par Object lifetimes
+ * The format string is stored as a view. It should usually be a string literal.
+ *
+ * \par Availability
+ * Requires C++14 or later.
+ */
+template <std::size_t NumSteps>
+class compiled_format
+{
+    string_view format_str_;
+    // A plain array, since std::array can't be modified in constant expressions in C++14
+    detail::compiled_format_step steps_[NumSteps == 0u ? 1u : NumSteps]{};
+    bool has_non_ascii_{};
+
+public:
+    /**
+     * \brief Compiles a format string.
+     * \details
+     * `NumSteps` must match the number of steps in `format_str`. Use \ref BOOST_MYSQL_COMPILE_FORMAT
+     * to compute it automatically.
+     * \n
+     * This constructor is `constexpr`. If it's evaluated in a constant expression,
+     * any error is reported at compile time.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws `boost::system::system_error` with one of the following codes
+     * if `format_str` is not a valid format string: \n
+     *   \li \ref client_errc::format_string_invalid_syntax if `format_str` can't be parsed, or
+     *       if `NumSteps` doesn't match the number of steps in `format_str`.
+     *   \li \ref client_errc::format_string_manual_auto_mix if `format_str` contains a mix of automatic
+     *       (`{}`) and manual indexed (`{1}`) replacement fields.
+     *
+     * \par Object lifetimes
+     * `format_str` is stored as a view, and must be valid while `*this` is used.
+     */
+    constexpr explicit compiled_format(constant_string_view format_str)
+        : format_str_(format_str.get()), has_non_ascii_(detail::has_non_ascii_chars(format_str.get()))
+    {
+        detail::compiled_format_step_writer writer{steps_, NumSteps, 0u};
+        detail::parse_compiled_format(format_str_, writer);
+        if (writer.count != NumSteps)
+            detail::throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+    }
+
+    /**
+     * \brief Returns the format string this object was created from.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    constexpr string_view format_string() const noexcept { return format_str_; }
+
+    /**
+     * \brief Returns the number of steps in the compiled format string.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    static constexpr std::size_t num_steps() noexcept { return NumSteps; }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    detail::compiled_format_ref to_ref() const noexcept
+    {
+        return {
+            format_str_,
+            {steps_, NumSteps},
+            has_non_ascii_
+        };
+    }
+#endif
+};
+
+/**
+ * \brief Composes a SQL query client-side using a compiled format string.
+ * \details
+ * Behaves like the \ref format_sql_to overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Basic guarantee. Memory allocations may throw.
+ *
+ * \par Errors
+ * The same as the overload taking a \ref constant_string_view. Syntax errors in the format string
+ * are detected when compiling it, instead.
+ */
+template <std::size_t NumSteps, BOOST_MYSQL_FORMATTABLE... Formattable>
+void format_sql_to(
+    format_context_base& ctx,
+    const compiled_format<NumSteps>& format_str,
+    Formattable&&... args
+);
+
+/**
+ * \copydoc format_sql_to(format_context_base&,const compiled_format<NumSteps>&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+template <std::size_t NumSteps>
+void format_sql_to(
+    format_context_base& ctx,
+    const compiled_format<NumSteps>& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    detail::vformat_sql_to(ctx, format_str.to_ref(), args);
+}
+
+/**
+ * \brief Composes a SQL query client-side using a compiled format string.
+ * \details
+ * Behaves like the \ref format_sql overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Strong guarantee. Memory allocations may throw. `boost::system::system_error` is thrown if an error
+ * is found while formatting.
+ *
+ * \par Errors
+ * The same as the overload taking a \ref constant_string_view. Syntax errors in the format string
+ * are detected when compiling it, instead.
+ */
+template <std::size_t NumSteps, BOOST_MYSQL_FORMATTABLE... Formattable>
+std::string format_sql(
+    format_options opts,
+    const compiled_format<NumSteps>& format_str,
+    Formattable&&... args
+);
+
+/**
+ * \copydoc format_sql(format_options,const compiled_format<NumSteps>&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+template <std::size_t NumSteps>
+std::string format_sql(
+    format_options opts,
+    const compiled_format<NumSteps>& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    format_context ctx(opts);
+    format_sql_to(ctx, format_str, args);
+    return std::move(ctx).get().value();
+}
+
+/**
+ * \brief Computes an upper bound for the size of a SQL query composed using a compiled format string.
+ * \details
+ * Behaves like the \ref format_sql_size_hint overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Basic guarantee. Exceptions thrown by custom formatters are propagated.
+ */
+template <std::size_t NumSteps, BOOST_MYSQL_FORMATTABLE... Formattable>
+std::size_t format_sql_size_hint(
+    format_options opts,
+    const compiled_format<NumSteps>& format_str,
+    Formattable&&... args
+);
+
+/**
+ * \copydoc format_sql_size_hint(format_options,const compiled_format<NumSteps>&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+template <std::size_t NumSteps>
+std::size_t format_sql_size_hint(
+    format_options opts,
+    const compiled_format<NumSteps>& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    return detail::vformat_sql_size_hint(opts, format_str.to_ref(), args);
+}
+
+/**
+ * \brief A compiled query format string and format arguments that can be executed.
+ * \details
+ * Like \ref with_params_t, but using a \ref compiled_format. Satisfies `ExecutionRequest`.
+ * When executed, the query is generated as if \ref format_sql was called with the compiled format
+ * string and the connection's current format options. The query is written directly
+ * into the connection's write buffer, without parsing the format string.
+ * \n
+ * Objects of this type are usually created using \ref with_params.
+ *
+ * \par Object lifetimes
+ * `query` is stored by value, but references the format string it was compiled from,
+ * which should usually be a string literal. `args` has the same semantics as in \ref with_params_t.
+ *
+ * \par Errors
+ * The same as \ref with_params_t.
+ *
+ * \par Availability
+ * Requires C++14 or later.
+ */
+template <std::size_t NumSteps, BOOST_MYSQL_FORMATTABLE... Formattable>
+struct with_compiled_params_t
+{
+    /// The compiled format string to be expanded and executed.
+    compiled_format<NumSteps> query;
+
+    /// The arguments to use to expand the query.
+    std::tuple<Formattable...> args;
+};
+
+/**
+ * \brief Creates a query with parameters from a compiled format string.
+ * \details
+ * Creates a \ref with_compiled_params_t object by packing the supplied arguments into a tuple,
+ * with the same semantics as the \ref with_params overload taking a \ref constant_string_view.
+ *
+ * \par Exception safety
+ * Strong guarantee. Any exception thrown when copying `args` will be propagated.
+ */
+template <std::size_t NumSteps, class... FormattableOrRefWrapper>
+auto with_params(const compiled_format<NumSteps>& query, FormattableOrRefWrapper&&... args)
+    -> with_compiled_params_t<NumSteps, make_tuple_element_t<FormattableOrRefWrapper>...>
+{
+    return {query, std::make_tuple(std::forward<FormattableOrRefWrapper>(args)...)};
+}
+
+}  // namespace mysql
+}  // namespace boost
+
+/**
+ * \brief Creates a \ref boost::mysql::compiled_format from a string literal.
+ * \details
+ * Expands to a `compiled_format<N>` object, where `N` is the number of steps
+ * in `s`, computed at compile time. `s` must be a string literal (or another
+ * constant expression convertible to \ref boost::mysql::string_view).
+ * Use it to initialize a `constexpr` variable to get compile-time validation.
+ */
+#define BOOST_MYSQL_COMPILE_FORMAT(s) \
+    ::boost::mysql::compiled_format<::boost::mysql::detail::count_compiled_format_steps(s)>(s)
+
+#include <boost/mysql/impl/compiled_format.hpp>
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -14,6 +14,8 @@
 
 #include <boost/mysql/detail/any_execution_request.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/pipeline_visitor_ref.hpp>
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
 
 #include <boost/core/span.hpp>
 
@@ -27,12 +29,17 @@ namespace mysql {
 class rows_view;
 class statement;
 class stage_response;
+class binlog_event;
+struct binlog_dump_params;
 
 namespace detail {
 
 class execution_processor;
 class execution_state_impl;
 struct pipeline_request_stage;
+struct binlog_stream_impl;
+struct row_batch_impl;
+struct lazy_row_batch_impl;
 
 struct connect_algo_params
 {
@@ -58,6 +65,14 @@ struct execute_algo_params
     using result_type = void;
 };
 
+struct execute_each_algo_params
+{
+    any_execution_request req;
+    resultset_visitor_ref visitor;
+
+    using result_type = void;
+};
+
 struct start_execution_algo_params
 {
     any_execution_request req;
@@ -88,6 +103,22 @@ struct read_some_rows_dynamic_algo_params
     using result_type = rows_view;
 };
 
+struct read_some_rows_batch_algo_params
+{
+    execution_state_impl* exec_st;
+    row_batch_impl* output;
+
+    using result_type = void;
+};
+
+struct read_some_rows_lazy_algo_params
+{
+    execution_state_impl* exec_st;
+    lazy_row_batch_impl* output;
+
+    using result_type = void;
+};
+
 struct prepare_statement_algo_params
 {
     string_view stmt_sql;
@@ -138,6 +169,32 @@ struct run_pipeline_algo_params
     using result_type = void;
 };
 
+// Like run_pipeline_algo_params, but stage responses are passed to a visitor
+// as they are read, instead of being stored
+struct run_pipeline_each_algo_params
+{
+    span<const std::uint8_t> request_buffer;
+    span<const pipeline_request_stage> request_stages;
+    pipeline_visitor_ref visitor;
+
+    using result_type = void;
+};
+
+struct binlog_dump_algo_params
+{
+    const binlog_dump_params* params;
+    binlog_stream_impl* stream;
+
+    using result_type = void;
+};
+
+struct read_binlog_event_algo_params
+{
+    binlog_stream_impl* stream;
+
+    using result_type = binlog_event;
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -11,8 +11,12 @@
 #include <boost/mysql/constant_string_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/compiled_format_ref.hpp>
+
 #include <boost/core/span.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <vector>
@@ -31,6 +35,7 @@ struct any_execution_request
     {
         query,
         query_with_params,
+        query_with_compiled_params,
         stmt
     };
 
@@ -42,6 +47,11 @@ struct any_execution_request
             constant_string_view query;
             span<const format_arg> args;
         } query_with_params;
+        struct query_with_compiled_params_t
+        {
+            compiled_format_ref query;
+            span<const format_arg> args;
+        } query_with_compiled_params;
         struct stmt_t
         {
             std::uint32_t stmt_id;
@@ -51,6 +61,7 @@ struct any_execution_request
 
         data_t(string_view q) noexcept : query(q) {}
         data_t(query_with_params_t v) noexcept : query_with_params(v) {}
+        data_t(query_with_compiled_params_t v) noexcept : query_with_compiled_params(v) {}
         data_t(stmt_t v) noexcept : stmt(v) {}
     };
 
@@ -61,9 +72,23 @@ struct any_execution_request
     any_execution_request(data_t::query_with_params_t v) noexcept : type(type_t::query_with_params), data(v)
     {
     }
+    any_execution_request(data_t::query_with_compiled_params_t v) noexcept
+        : type(type_t::query_with_compiled_params), data(v)
+    {
+    }
     any_execution_request(data_t::stmt_t v) noexcept : type(type_t::stmt), data(v) {}
 };
 
+// Type-erases a compiled format string and its arguments. Used by compiled_format and query_template
+template <std::size_t N>
+struct compiled_params_proxy
+{
+    compiled_format_ref query;
+    std::array<format_arg, N> args;
+
+    operator any_execution_request() const { return any_execution_request({query, args}); }
+};
+
 struct no_execution_request_traits
 {
 };
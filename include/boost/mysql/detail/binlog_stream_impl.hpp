@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_BINLOG_STREAM_IMPL_HPP
+#define BOOST_MYSQL_DETAIL_BINLOG_STREAM_IMPL_HPP
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/gtid_set.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A table definition, as sent by TABLE_MAP events
+struct binlog_table_map
+{
+    std::uint64_t table_id{};
+    std::string database;
+    std::string table;
+    std::vector<std::uint8_t> column_types;     // protocol_field_type, with binlog-specific extensions
+    std::vector<std::uint16_t> column_meta;     // type-specific metadata (e.g. max length)
+    std::vector<std::uint8_t> column_unsigned;  // only populated if the server sends signedness info
+};
+
+// State required to decode a binlog event stream. Owned by binlog_stream
+struct binlog_stream_impl
+{
+    // Has the dump command been sent? Has the server signaled EOF?
+    bool started{false};
+    bool complete{false};
+
+    // Sequence number for the next event packet
+    std::uint8_t seqnum{0};
+
+    // Do events carry a CRC32 trailer? Only known after the first format description event
+    bool checksum_known{false};
+    bool has_checksum{false};
+
+    // Table maps seen in the current transaction. Entries past num_table_maps
+    // are kept to reuse their memory
+    std::vector<binlog_table_map> table_maps;
+    std::size_t num_table_maps{0};
+
+    // Storage for decoded row images. Strings point into the connection's buffer,
+    // except for DECIMALs, which are decoded into decimal_buffer
+    std::vector<field_view> before_fields;
+    std::vector<field_view> after_fields;
+    std::string decimal_buffer;
+
+    // Position tracking
+    gtid_set executed_gtids;
+    bool in_transaction{false};  // set by BEGIN, until the transaction ends
+    bool has_pending_gtid{false};
+    gtid_source_id pending_gtid_source{};
+    std::uint64_t pending_gtid_transaction_id{};
+    std::string log_file;
+    std::uint64_t log_position{};
+
+    void reset()
+    {
+        started = false;
+        complete = false;
+        seqnum = 0;
+        checksum_known = false;
+        has_checksum = false;
+        num_table_maps = 0;
+        before_fields.clear();
+        after_fields.clear();
+        decimal_buffer.clear();
+        in_transaction = false;
+        has_pending_gtid = false;
+    }
+
+    const binlog_table_map* find_table_map(std::uint64_t table_id) const
+    {
+        for (std::size_t i = 0; i < num_table_maps; ++i)
+        {
+            if (table_maps[i].table_id == table_id)
+                return &table_maps[i];
+        }
+        return nullptr;
+    }
+
+    binlog_table_map& add_table_map(std::uint64_t table_id)
+    {
+        // Replace any previous definition
+        for (std::size_t i = 0; i < num_table_maps; ++i)
+        {
+            if (table_maps[i].table_id == table_id)
+                return table_maps[i];
+        }
+        if (num_table_maps == table_maps.size())
+            table_maps.emplace_back();
+        auto& res = table_maps[num_table_maps++];
+        res.table_id = table_id;
+        return res;
+    }
+
+    // Called when a transaction commits
+    void on_transaction_end()
+    {
+        if (has_pending_gtid)
+        {
+            executed_gtids.add(pending_gtid_source, pending_gtid_transaction_id);
+            has_pending_gtid = false;
+        }
+        in_transaction = false;
+        num_table_maps = 0;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_BULK_INSERT_HPP
+#define BOOST_MYSQL_DETAIL_BULK_INSERT_HPP
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/format_sql.hpp>
+
+#include <boost/mysql/detail/format_sql.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+
+#include <boost/describe/members.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/tuple.hpp>
+
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A type-erased input range of rows, consumed by bulk_insert
+class bulk_insert_row_source
+{
+public:
+    // Formats the next row into ctx and advances. Returns false if there are no more rows
+    virtual bool format_next(format_context_base& ctx) = 0;
+    virtual ~bulk_insert_row_source() {}
+};
+
+// Appends each value in a row, separated by commas
+class bulk_insert_value_appender
+{
+    format_context_base& ctx_;
+    bool first_{true};
+
+public:
+    bulk_insert_value_appender(format_context_base& ctx) noexcept : ctx_(ctx) {}
+
+    template <class T>
+    void operator()(const T& value)
+    {
+        static_assert(
+            is_formattable_type<T>(),
+            "bulk_insert: rows must only contain formattable types (e.g. integers, strings or types "
+            "with a formatter specialization)"
+        );
+        if (!first_)
+            ctx_.append_raw(", ");
+        first_ = false;
+        ctx_.append_value(value);
+    }
+};
+
+template <class T>
+struct is_std_tuple : std::false_type
+{
+};
+
+template <class... T>
+struct is_std_tuple<std::tuple<T...>> : std::true_type
+{
+};
+
+// Rows are formatted as a parenthesized list of values, e.g. (42, 'abc')
+template <class Row>
+void format_bulk_insert_row(const Row& row, format_context_base& ctx, std::true_type /* is_tuple */)
+{
+    bulk_insert_value_appender appender(ctx);
+    mp11::tuple_for_each(row, appender);
+}
+
+template <class Row>
+void format_bulk_insert_row(const Row& row, format_context_base& ctx, std::false_type /* is_tuple */)
+{
+    bulk_insert_value_appender appender(ctx);
+    mp11::mp_for_each<row_members<Row>>([&appender, &row](auto D) { appender(row.*D.pointer); });
+}
+
+template <class Row>
+void format_bulk_insert_row(const Row& row, format_context_base& ctx)
+{
+    static_assert(
+        is_std_tuple<Row>::value || describe::has_describe_members<Row>::value,
+        "bulk_insert: rows must be std::tuple objects or Boost.Describe structs"
+    );
+    ctx.append_raw("(");
+    format_bulk_insert_row(row, ctx, is_std_tuple<Row>{});
+    ctx.append_raw(")");
+}
+
+template <class Iterator, class Sentinel>
+class bulk_insert_range_source final : public bulk_insert_row_source
+{
+    Iterator it_;
+    Sentinel end_;
+
+public:
+    bulk_insert_range_source(Iterator first, Sentinel last) : it_(std::move(first)), end_(std::move(last)) {}
+
+    bool format_next(format_context_base& ctx) override
+    {
+        if (it_ == end_)
+            return false;
+        format_bulk_insert_row(*it_, ctx);
+        ++it_;
+        return true;
+    }
+};
+
+template <class InputRange>
+auto make_bulk_insert_range_source(InputRange& rows)
+    -> bulk_insert_range_source<decltype(std::begin(rows)), decltype(std::end(rows))>
+{
+    return {std::begin(rows), std::end(rows)};
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_COMPILED_FORMAT_PARSER_HPP
+#define BOOST_MYSQL_DETAIL_COMPILED_FORMAT_PARSER_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/compiled_format_ref.hpp>
+
+#include <boost/config.hpp>
+#include <boost/system/system_error.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+
+// Splits format strings into steps. constexpr in C++14, so format strings can be compiled
+// at compile time (compiled_format). Also used at runtime (query_template)
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Not constexpr: if it's called while compiling a format string in a constant expression,
+// compilation fails
+inline void throw_compiled_format_error(client_errc ec)
+{
+    BOOST_THROW_EXCEPTION(system::system_error(ec));
+}
+
+BOOST_CXX14_CONSTEXPR inline bool is_compiled_number(char c) noexcept { return c >= '0' && c <= '9'; }
+
+BOOST_CXX14_CONSTEXPR inline bool is_compiled_name_start(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+BOOST_CXX14_CONSTEXPR inline bool is_compiled_spec_char(char c) noexcept
+{
+    return c != '{' && c != '}' && static_cast<unsigned char>(c) >= 0x20 &&
+           static_cast<unsigned char>(c) <= 0x7e;
+}
+
+BOOST_CXX14_CONSTEXPR inline bool has_non_ascii_chars(string_view s) noexcept
+{
+    for (std::size_t i = 0; i < s.size(); ++i)
+    {
+        if (static_cast<unsigned char>(s[i]) >= 0x80)
+            return true;
+    }
+    return false;
+}
+
+// Emits a step with the literal text in [first, last), if any.
+// Not a lambda because they can't be constexpr in C++14
+template <class OnStep>
+BOOST_CXX14_CONSTEXPR void emit_compiled_literal(OnStep& on_step, std::size_t first, std::size_t last)
+{
+    if (last != first)
+    {
+        on_step(compiled_format_step{compiled_format_step::kind_t::literal, first, last - first, 0u, 0u, 0u}
+        );
+    }
+}
+
+// Parses a format string with the same grammar as format_sql, invoking on_step for each step.
+// Reports errors by calling throw_compiled_format_error. Strings with non-ASCII characters
+// yield no steps, since they can only be parsed once the character set is known
+template <class OnStep>
+BOOST_CXX14_CONSTEXPR void parse_compiled_format(string_view s, OnStep& on_step)
+{
+    using kind_t = compiled_format_step::kind_t;
+
+    // In some character sets, braces may be part of a multi-byte character
+    if (has_non_ascii_chars(s))
+        return;
+
+    // Borrowed from fmt
+    // 0: we haven't used any args yet
+    // -1: we're doing explicit indexing
+    // >0: we're doing auto indexing
+    int next_arg_id = 0;
+
+    std::size_t i = 0;
+    std::size_t literal_first = 0;
+    const std::size_t n = s.size();
+
+    while (i < n)
+    {
+        if (s[i] == '{')
+        {
+            emit_compiled_literal(on_step, literal_first, i);
+            ++i;
+            if (i == n)
+                throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+
+            if (s[i] == '{')
+            {
+                // A double brace is the escaped form of '{'. The second one is literal text
+                literal_first = i++;
+                continue;
+            }
+
+            // replacement_field ::=  "{" [arg_id] [":" (format_spec)] "}"
+            compiled_format_step step{};
+            if (is_compiled_number(s[i]))
+            {
+                // Must fit in an unsigned short, as in format_sql
+                std::size_t index = 0;
+                while (i < n && is_compiled_number(s[i]))
+                {
+                    index = index * 10u + static_cast<std::size_t>(s[i++] - '0');
+                    if (index > 0xffffu)
+                        throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+                }
+                if (next_arg_id > 0)
+                    throw_compiled_format_error(client_errc::format_string_manual_auto_mix);
+                next_arg_id = -1;
+                step.kind = kind_t::indexed_arg;
+                step.arg_index = index;
+            }
+            else if (is_compiled_name_start(s[i]))
+            {
+                step.kind = kind_t::named_arg;
+                step.first = i;
+                while (i < n && (is_compiled_name_start(s[i]) || is_compiled_number(s[i])))
+                    ++i;
+                step.size = i - step.first;
+            }
+            else
+            {
+                if (next_arg_id == -1)
+                    throw_compiled_format_error(client_errc::format_string_manual_auto_mix);
+                step.kind = kind_t::indexed_arg;
+                step.arg_index = static_cast<std::size_t>(next_arg_id++);
+            }
+
+            // Format spec
+            if (i < n && s[i] == ':')
+            {
+                step.spec_first = ++i;
+                while (i < n && is_compiled_spec_char(s[i]))
+                    ++i;
+                step.spec_size = i - step.spec_first;
+            }
+
+            if (i == n || s[i] != '}')
+                throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+            ++i;
+            on_step(step);
+            literal_first = i;
+        }
+        else if (s[i] == '}')
+        {
+            // A lonely } is only legal as a escape curly brace (i.e. }})
+            emit_compiled_literal(on_step, literal_first, i);
+            ++i;
+            if (i == n || s[i] != '}')
+                throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+            literal_first = i++;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    emit_compiled_literal(on_step, literal_first, n);
+}
+
+struct compiled_format_step_counter
+{
+    std::size_t count{};
+    BOOST_CXX14_CONSTEXPR void operator()(const compiled_format_step&) noexcept { ++count; }
+};
+
+// Returns the number of steps in a format string. Used as the template argument for compiled_format
+BOOST_CXX14_CONSTEXPR inline std::size_t count_compiled_format_steps(string_view format_str)
+{
+    compiled_format_step_counter counter{};
+    parse_compiled_format(format_str, counter);
+    return counter.count;
+}
+
+struct compiled_format_step_writer
+{
+    compiled_format_step* steps;
+    std::size_t capacity;
+    std::size_t count;
+
+    BOOST_CXX14_CONSTEXPR void operator()(const compiled_format_step& step)
+    {
+        if (count == capacity)
+            throw_compiled_format_error(client_errc::format_string_invalid_syntax);
+        steps[count++] = step;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_COMPILED_FORMAT_REF_HPP
+#define BOOST_MYSQL_DETAIL_COMPILED_FORMAT_REF_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A step in a compiled format string: either append a piece of the format string, or format an argument
+struct compiled_format_step
+{
+    enum class kind_t : unsigned char
+    {
+        literal,      // append format_str[first, first + size)
+        indexed_arg,  // format args[arg_index]. Automatic indexing is resolved when compiling
+        named_arg     // format the argument named format_str[first, first + size)
+    };
+
+    kind_t kind;
+    std::size_t first;
+    std::size_t size;
+    std::size_t arg_index;
+    std::size_t spec_first;
+    std::size_t spec_size;
+};
+
+// A type-erased view over a compiled_format
+struct compiled_format_ref
+{
+    string_view format_str;
+    span<const compiled_format_step> steps;
+
+    // If the format string contains non-ASCII characters, it needs to be validated
+    // against the character set in use, which is not known at compile time
+    bool has_non_ascii;
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -9,13 +9,16 @@
 #define BOOST_MYSQL_DETAIL_CONNECTION_IMPL_HPP
 
 #include <boost/mysql/any_address.hpp>
+#include <boost/mysql/column_buffers.hpp>
 #include <boost/mysql/connect_params.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/execution_state.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/handshake_params.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/row_batch.hpp>
 #include <boost/mysql/rows_view.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -28,6 +31,8 @@
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/initiation_base.hpp>
 #include <boost/mysql/detail/intermediate_handler.hpp>
+#include <boost/mysql/detail/pipeline_visitor_ref.hpp>
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
 #include <boost/system/result.hpp>
@@ -297,6 +302,31 @@ class connection_impl
         }
     };
 
+    // execute each
+    struct initiate_execute_each : initiation_base
+    {
+        using initiation_base::initiation_base;
+
+        template <class Handler, class ExecutionRequest>
+        void operator()(
+            Handler&& handler,
+            diagnostics* diag,
+            engine* eng,
+            connection_state* st,
+            ExecutionRequest&& req,
+            resultset_visitor_ref visitor
+        )
+        {
+            async_run_impl(
+                *eng,
+                *st,
+                execute_each_algo_params{make_request(std::forward<ExecutionRequest>(req), *st), visitor},
+                *diag,
+                std::forward<Handler>(handler)
+            );
+        }
+    };
+
     // start execution
     struct initiate_start_execution : initiation_base
     {
@@ -492,6 +522,48 @@ public:
         );
     }
 
+    // Execute each
+    template <class ExecutionRequest, class ResultsetVisitor>
+    void execute_each(ExecutionRequest&& req, ResultsetVisitor& visitor, error_code& err, diagnostics& diag)
+    {
+        run(
+            execute_each_algo_params{
+                make_request(std::forward<ExecutionRequest>(req), *st_),
+                resultset_visitor_ref(visitor)
+            },
+            err,
+            diag
+        );
+    }
+
+    template <class ExecutionRequest, class ResultsetVisitor, class CompletionToken>
+    auto async_execute_each(
+        ExecutionRequest&& req,
+        ResultsetVisitor& visitor,
+        diagnostics& diag,
+        CompletionToken&& token
+    )
+        -> decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute_each(get_executor()),
+            token,
+            &diag,
+            engine_.get(),
+            st_.get(),
+            std::forward<ExecutionRequest>(req),
+            resultset_visitor_ref(visitor)
+        ))
+    {
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute_each(get_executor()),
+            token,
+            &diag,
+            engine_.get(),
+            st_.get(),
+            std::forward<ExecutionRequest>(req),
+            resultset_visitor_ref(visitor)
+        );
+    }
+
     // Start execution
     template <class ExecutionRequest, class ExecutionStateType>
     void start_execution(
@@ -545,6 +617,19 @@ public:
         return {&access::get_impl(st).get_interface()};
     }
 
+    // Read some rows (borrowed batch)
+    read_some_rows_batch_algo_params make_params_read_some_rows(execution_state& st, row_batch& output) const
+    {
+        return {&access::get_impl(st).get_interface(), &access::get_impl(output)};
+    }
+
+    // Read some rows (lazy batch)
+    read_some_rows_lazy_algo_params make_params_read_some_rows(execution_state& st, lazy_row_batch& output)
+        const
+    {
+        return {&access::get_impl(st).get_interface(), &access::get_impl(output)};
+    }
+
     // Read some rows (static)
     template <class SpanElementType, class ExecutionState>
     read_some_rows_algo_params make_params_read_some_rows_static(
@@ -558,6 +643,21 @@ public:
         };
     }
 
+#ifdef BOOST_MYSQL_CXX14
+    // Read some rows (static, into column buffers)
+    template <class ColumnsRow, class ExecutionState>
+    read_some_rows_algo_params make_params_read_some_rows_static(
+        ExecutionState& exec_st,
+        const column_buffers<ColumnsRow>& output
+    ) const
+    {
+        return {
+            &access::get_impl(exec_st).get_interface(),
+            access::get_impl(exec_st).make_output_ref(output)
+        };
+    }
+#endif
+
     // Read resultset head
     template <class ExecutionStateType>
     read_resultset_head_algo_params make_params_read_resultset_head(ExecutionStateType& st) const
@@ -574,6 +674,12 @@ public:
         const pipeline_request& req,
         std::vector<stage_response>& response
     );
+
+    BOOST_MYSQL_DECL
+    static run_pipeline_each_algo_params make_params_pipeline_each(
+        const pipeline_request& req,
+        pipeline_visitor_ref visitor
+    );
 };
 
 // To use some completion tokens, like deferred, in C++11, the old macros
@@ -609,6 +715,14 @@ using async_execute_t = decltype(std::declval<connection_impl&>().async_execute(
     std::declval<CompletionToken>()
 ));
 
+template <class ExecutionRequest, class ResultsetVisitor, class CompletionToken>
+using async_execute_each_t = decltype(std::declval<connection_impl&>().async_execute_each(
+    std::declval<ExecutionRequest>(),
+    std::declval<ResultsetVisitor&>(),
+    std::declval<diagnostics&>(),
+    std::declval<CompletionToken>()
+));
+
 template <class ExecutionRequest, class ExecutionStateType, class CompletionToken>
 using async_start_execution_t = decltype(std::declval<connection_impl&>().async_start_execution(
     std::declval<ExecutionRequest>(),
@@ -626,6 +740,12 @@ using async_read_resultset_head_t = async_run_t<read_resultset_head_algo_params,
 template <class CompletionToken>
 using async_read_some_rows_dynamic_t = async_run_t<read_some_rows_dynamic_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_read_some_rows_batch_t = async_run_t<read_some_rows_batch_algo_params, CompletionToken>;
+
+template <class CompletionToken>
+using async_read_some_rows_lazy_t = async_run_t<read_some_rows_lazy_algo_params, CompletionToken>;
+
 template <class CompletionToken>
 using async_prepare_statement_t = async_run_t<prepare_statement_algo_params, CompletionToken>;
 
@@ -650,6 +770,15 @@ using async_close_connection_t = async_run_t<close_connection_algo_params, Compl
 template <class CompletionToken>
 using async_run_pipeline_t = async_run_t<run_pipeline_algo_params, CompletionToken>;
 
+template <class CompletionToken>
+using async_run_pipeline_each_t = async_run_t<run_pipeline_each_algo_params, CompletionToken>;
+
+template <class CompletionToken>
+using async_start_binlog_dump_t = async_run_t<binlog_dump_algo_params, CompletionToken>;
+
+template <class CompletionToken>
+using async_read_binlog_event_t = async_run_t<read_binlog_event_algo_params, CompletionToken>;
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
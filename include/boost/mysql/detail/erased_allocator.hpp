@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_ERASED_ALLOCATOR_HPP
+#define BOOST_MYSQL_DETAIL_ERASED_ALLOCATOR_HPP
+
+#include <boost/mysql/detail/void_t.hpp>
+
+#include <boost/throw_exception.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// A type-erased allocator, used by the containers in results, rows, row and execution_state.
+// This allows these classes to be used with user-supplied allocators (e.g. std::pmr::polymorphic_allocator
+// or a per-request arena) without becoming templates.
+// Allocators are stored inline, and must be small and nothrow copyable.
+// A default-constructed erased_allocator uses operator new, like std::allocator.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <class T, class = void>
+struct is_allocator : std::false_type
+{
+};
+
+template <class T>
+struct is_allocator<
+    T,
+    void_t<typename T::value_type, decltype(std::declval<T&>().allocate(std::size_t()))>>
+    : std::true_type
+{
+};
+
+// Common base for all erased_allocator specializations. Containers may pass
+// objects derived from their allocator to allocator constructors.
+struct erased_allocator_base
+{
+};
+
+template <class T>
+struct is_std_allocator : std::false_type
+{
+};
+
+template <class T>
+struct is_std_allocator<std::allocator<T>> : std::true_type
+{
+};
+
+struct erased_allocator_vtable
+{
+    void* (*allocate)(void* alloc, std::size_t size);
+    void (*deallocate)(void* alloc, void* p, std::size_t size);
+    void (*copy)(const void* from, void* to);
+    void (*destroy)(void* alloc);
+    bool (*equals)(const void* lhs, const void* rhs);
+};
+
+// Memory is requested to the user allocator in units of max_align_t, so any type can be stored
+template <class Allocator>
+struct erased_allocator_ops
+{
+    using unit_type = std::max_align_t;
+    using unit_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<unit_type>;
+    using unit_traits = std::allocator_traits<unit_allocator>;
+
+    static std::size_t num_units(std::size_t size) noexcept
+    {
+        return (size + sizeof(unit_type) - 1) / sizeof(unit_type);
+    }
+
+    static void* allocate(void* alloc, std::size_t size)
+    {
+        unit_allocator a(*static_cast<Allocator*>(alloc));
+        unit_type* res = unit_traits::allocate(a, num_units(size));
+        return res;
+    }
+
+    static void deallocate(void* alloc, void* p, std::size_t size) noexcept
+    {
+        unit_allocator a(*static_cast<Allocator*>(alloc));
+        unit_traits::deallocate(a, static_cast<unit_type*>(p), num_units(size));
+    }
+
+    static void copy(const void* from, void* to) noexcept
+    {
+        new (to) Allocator(*static_cast<const Allocator*>(from));
+    }
+
+    static void destroy(void* alloc) noexcept { static_cast<Allocator*>(alloc)->~Allocator(); }
+
+    static bool equals(const void* lhs, const void* rhs) noexcept
+    {
+        return *static_cast<const Allocator*>(lhs) == *static_cast<const Allocator*>(rhs);
+    }
+
+    static constexpr erased_allocator_vtable vtable{&allocate, &deallocate, &copy, &destroy, &equals};
+};
+
+template <class Allocator>
+constexpr erased_allocator_vtable erased_allocator_ops<Allocator>::vtable;
+
+template <class T>
+class erased_allocator : erased_allocator_base
+{
+    static constexpr std::size_t storage_size = 2 * sizeof(void*);
+
+    const erased_allocator_vtable* vtable_{};  // nullptr means operator new
+    alignas(void*) unsigned char storage_[storage_size];
+
+    template <class U>
+    friend class erased_allocator;
+
+    void copy_from(const erased_allocator_vtable* vtable, const void* storage) noexcept
+    {
+        vtable_ = vtable;
+        if (vtable_)
+            vtable_->copy(storage, storage_);
+    }
+
+    void destroy() noexcept
+    {
+        if (vtable_)
+            vtable_->destroy(storage_);
+    }
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    erased_allocator() noexcept = default;
+
+    // Allocators are rebound to a common type, so allocators for different types compare equal
+    template <
+        class Allocator,
+        class = typename std::enable_if<
+            is_allocator<Allocator>::value &&
+            !std::is_base_of<erased_allocator_base, Allocator>::value>::type>
+    erased_allocator(const Allocator& alloc) noexcept
+    {
+        using canonical_allocator = typename erased_allocator_ops<Allocator>::unit_allocator;
+        static_assert(
+            sizeof(canonical_allocator) <= storage_size && alignof(canonical_allocator) <= alignof(void*),
+            "Allocator is too big to be stored inline. Use a reference to it, instead"
+        );
+        static_assert(
+            std::is_nothrow_copy_constructible<canonical_allocator>::value,
+            "Allocator should be nothrow copy constructible"
+        );
+        if (!is_std_allocator<canonical_allocator>::value)
+        {
+            canonical_allocator canonical(alloc);
+            copy_from(&erased_allocator_ops<canonical_allocator>::vtable, &canonical);
+        }
+    }
+
+    erased_allocator(const erased_allocator& other) noexcept { copy_from(other.vtable_, other.storage_); }
+
+    template <class U>
+    erased_allocator(const erased_allocator<U>& other) noexcept
+    {
+        copy_from(other.vtable_, other.storage_);
+    }
+
+    erased_allocator& operator=(const erased_allocator& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            copy_from(other.vtable_, other.storage_);
+        }
+        return *this;
+    }
+
+    ~erased_allocator() { destroy(); }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > static_cast<std::size_t>(-1) / sizeof(T))
+            BOOST_THROW_EXCEPTION(std::bad_alloc());
+        std::size_t size = n * sizeof(T);
+        return static_cast<T*>(vtable_ ? vtable_->allocate(storage_, size) : ::operator new(size));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (vtable_)
+            vtable_->deallocate(storage_, p, n * sizeof(T));
+        else
+            ::operator delete(p);
+    }
+
+    // Copies don't inherit the allocator, like std::pmr containers
+    erased_allocator select_on_container_copy_construction() const noexcept { return erased_allocator(); }
+
+    template <class U>
+    bool operator==(const erased_allocator<U>& other) const noexcept
+    {
+        if (vtable_ != other.vtable_)
+            return false;
+        return vtable_ == nullptr || vtable_->equals(storage_, other.storage_);
+    }
+
+    template <class U>
+    bool operator!=(const erased_allocator<U>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
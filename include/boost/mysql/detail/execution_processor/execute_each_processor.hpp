@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_EXECUTE_EACH_PROCESSOR_HPP
+#define BOOST_MYSQL_DETAIL_EXECUTION_PROCESSOR_EXECUTE_EACH_PROCESSOR_HPP
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
+
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Forwards resultsets to a visitor as they are read, instead of storing them.
+// Rows are deserialized into fields_, which point into the connection's read buffer.
+// They are handed to the visitor at the end of each row batch, before any other read
+// can invalidate them. At most one batch is kept in memory.
+class execute_each_processor final : public execution_processor
+{
+    resultset_visitor_ref visitor_;
+    std::vector<metadata> meta_;
+    std::vector<field_view> fields_;
+
+    BOOST_MYSQL_DECL
+    void flush_rows();
+
+    BOOST_MYSQL_DECL
+    void reset_impl() noexcept override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_head_ok_packet_impl(const ok_view& pack, diagnostics&) override final;
+
+    BOOST_MYSQL_DECL
+    void on_num_meta_impl(std::size_t num_columns) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_meta_impl(const coldef_view&, bool is_last, diagnostics&) override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+        override final;
+
+    BOOST_MYSQL_DECL
+    error_code on_row_ok_packet_impl(const ok_view& pack) override final;
+
+    void on_row_batch_start_impl() noexcept override final {}
+
+    void on_row_batch_finish_impl() override final { flush_rows(); }
+
+public:
+    execute_each_processor() = default;
+    execute_each_processor(resultset_visitor_ref visitor) noexcept : visitor_(visitor) {}
+
+    execute_each_processor& get_interface() noexcept { return *this; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/execute_each_processor.ipp>
+#endif
+
+#endif
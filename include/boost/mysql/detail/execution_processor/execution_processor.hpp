@@ -17,6 +17,7 @@
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/metadata_arena.hpp>
 #include <boost/mysql/detail/ok_view.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
@@ -27,11 +28,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace boost {
 namespace mysql {
 namespace detail {
 
+struct binary_cell;
+
 // A type-erased reference to be used as the output range for static_execution_state
 class output_ref
 {
@@ -47,6 +51,17 @@ class output_ref
     // Offset into the span's data (static_execution_state). Otherwise unused
     std::size_t offset_{};
 
+    // Set when rows are written column by column (column_buffers). data_ points
+    // to an array of column pointers, instead
+    bool is_columnar_{false};
+
+    // NULL bitmap for column_buffers. Null if the user didn't supply one
+    unsigned char* null_bitmap_{};
+
+    // Set when rows are split into cells, but not decoded (lazy_row_batch).
+    // Only used by execution_state_impl
+    std::vector<binary_cell>* cells_{};
+
 public:
     constexpr output_ref() noexcept = default;
 
@@ -56,22 +71,67 @@ public:
     {
     }
 
+    constexpr output_ref(
+        void* const* columns,
+        unsigned char* null_bitmap,
+        std::size_t max_size,
+        std::size_t type_index
+    ) noexcept
+        : data_(const_cast<void**>(columns)),
+          max_size_(max_size),
+          type_index_(type_index),
+          is_columnar_(true),
+          null_bitmap_(null_bitmap)
+    {
+    }
+
+    explicit output_ref(std::vector<binary_cell>& cells) noexcept : cells_(&cells) {}
+
     std::size_t max_size() const noexcept { return max_size_; }
     std::size_t type_index() const noexcept { return type_index_; }
     std::size_t offset() const noexcept { return offset_; }
     void set_offset(std::size_t v) noexcept { offset_ = v; }
+    bool is_columnar() const noexcept { return is_columnar_; }
+    std::vector<binary_cell>* cells() const noexcept { return cells_; }
 
     template <class T>
     T& span_element() const noexcept
     {
         BOOST_ASSERT(data_);
+        BOOST_ASSERT(!is_columnar());
         return static_cast<T*>(data_)[offset_];
     }
+
+    template <class T>
+    T& column_element(std::size_t column) const noexcept
+    {
+        BOOST_ASSERT(is_columnar());
+        return static_cast<T*>(static_cast<void* const*>(data_)[column])[offset_];
+    }
+
+    bool has_null_bitmap() const noexcept { return null_bitmap_ != nullptr; }
+
+    // Bit offset_ * num_columns + column is set if the value is NULL, and cleared otherwise
+    void set_null(std::size_t column, std::size_t num_columns, bool is_null) const noexcept
+    {
+        BOOST_ASSERT(is_columnar());
+        if (!null_bitmap_)
+            return;
+        std::size_t bit = offset_ * num_columns + column;
+        unsigned char mask = static_cast<unsigned char>(1u << (bit % 8u));
+        unsigned char& byte = null_bitmap_[bit / 8u];
+        byte = is_null ? static_cast<unsigned char>(byte | mask) : static_cast<unsigned char>(byte & ~mask);
+    }
 };
 
 class execution_processor
 {
 public:
+    execution_processor() = default;
+    execution_processor(const execution_processor&) = default;
+    execution_processor(execution_processor&&) = default;
+    execution_processor& operator=(const execution_processor&) = default;
+    execution_processor& operator=(execution_processor&&) = default;
     virtual ~execution_processor() {}
 
     void reset(resultset_encoding enc, metadata_mode mode) noexcept
@@ -82,6 +142,9 @@ public:
         seqnum_ = 0;
         remaining_meta_ = 0;
         reset_impl();
+
+        // Metadata has been cleared by reset_impl, so the arena's block can usually be reused
+        meta_arena_.reset();
     }
 
     BOOST_ATTRIBUTE_NODISCARD
@@ -151,6 +214,9 @@ public:
     metadata_mode meta_mode() const noexcept { return mode_; }
 
 protected:
+    // Metadata strings are allocated using alloc
+    explicit execution_processor(const erased_allocator<char>& alloc) noexcept : meta_arena_(alloc) {}
+
     virtual void reset_impl() noexcept = 0;
     virtual error_code on_head_ok_packet_impl(const ok_view& pack, diagnostics& diag) = 0;
     virtual void on_num_meta_impl(std::size_t num_columns) = 0;
@@ -164,9 +230,10 @@ protected:
     virtual void on_row_batch_start_impl() = 0;
     virtual void on_row_batch_finish_impl() = 0;
 
-    metadata create_meta(const coldef_view& coldef) const
+    // Strings are placed in an arena shared by all the metadata objects created by this processor
+    metadata create_meta(const coldef_view& coldef)
     {
-        return access::construct<metadata>(coldef, mode_ == metadata_mode::full);
+        return access::construct<metadata>(coldef, mode_ == metadata_mode::full, meta_arena_);
     }
 
 private:
@@ -194,6 +261,7 @@ private:
     std::uint8_t seqnum_{};
     metadata_mode mode_{metadata_mode::minimal};
     std::size_t remaining_meta_{};
+    metadata_arena meta_arena_;
 
     void set_state(state_t v) noexcept { state_ = v; }
 
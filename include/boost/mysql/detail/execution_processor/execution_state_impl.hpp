@@ -13,9 +13,11 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 
 #include <boost/assert.hpp>
@@ -37,15 +39,17 @@ class execution_state_impl final : public execution_processor
         bool is_out_params{false};       // Does this resultset contain OUT param information?
     };
 
-    std::vector<metadata> meta_;
+    std::vector<metadata, erased_allocator<metadata>> meta_;
     ok_data eof_data_;
-    std::vector<char> info_;
+    std::vector<char, erased_allocator<char>> info_;
+    std::vector<std::uint8_t, erased_allocator<std::uint8_t>> session_state_;
 
     void on_new_resultset() noexcept
     {
         meta_.clear();
         eof_data_ = ok_data{};
         info_.clear();
+        session_state_.clear();
     }
 
     BOOST_MYSQL_DECL
@@ -77,7 +81,15 @@ class execution_state_impl final : public execution_processor
 public:
     execution_state_impl() = default;
 
-    metadata_collection_view meta() const noexcept { return meta_; }
+    explicit execution_state_impl(const erased_allocator<char>& alloc) noexcept
+        : execution_processor(alloc), meta_(alloc), info_(alloc), session_state_(alloc)
+    {
+    }
+
+    metadata_collection_view meta() const noexcept
+    {
+        return metadata_collection_view(meta_.data(), meta_.size());
+    }
 
     std::uint64_t get_affected_rows() const noexcept
     {
@@ -103,6 +115,14 @@ public:
         return string_view(info_.data(), info_.size());
     }
 
+    session_state_view get_session_state() const noexcept
+    {
+        BOOST_ASSERT(eof_data_.has_value);
+        return access::construct<session_state_view>(
+            span<const std::uint8_t>(session_state_.data(), session_state_.size())
+        );
+    }
+
     bool get_is_out_params() const noexcept
     {
         BOOST_ASSERT(eof_data_.has_value);
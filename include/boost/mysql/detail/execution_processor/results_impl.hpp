@@ -14,9 +14,11 @@
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/row_impl.hpp>
 
@@ -28,17 +30,19 @@ namespace detail {
 
 struct per_resultset_data
 {
-    std::size_t num_columns{};       // Number of columns this resultset has
-    std::size_t meta_offset{};       // Offset into the vector of metadata
-    std::size_t field_offset;        // Offset into the vector of fields (append mode only)
-    std::size_t num_rows{};          // Number of rows this resultset has (append mode only)
-    std::uint64_t affected_rows{};   // OK packet data
-    std::uint64_t last_insert_id{};  // OK packet data
-    std::uint16_t warnings{};        // OK packet data
-    std::size_t info_offset{};       // Offset into the vector of info characters
-    std::size_t info_size{};         // Number of characters that this resultset's info string has
-    bool has_ok_packet_data{false};  // The OK packet information is default constructed, or actual data?
-    bool is_out_params{false};       // Does this resultset contain OUT param information?
+    std::size_t num_columns{};           // Number of columns this resultset has
+    std::size_t meta_offset{};           // Offset into the vector of metadata
+    std::size_t field_offset;            // Offset into the vector of fields (append mode only)
+    std::size_t num_rows{};              // Number of rows this resultset has (append mode only)
+    std::uint64_t affected_rows{};       // OK packet data
+    std::uint64_t last_insert_id{};      // OK packet data
+    std::uint16_t warnings{};            // OK packet data
+    std::size_t info_offset{};           // Offset into the vector of info characters
+    std::size_t info_size{};             // Number of characters that this resultset's info string has
+    std::size_t session_state_offset{};  // Offset into the vector of session state bytes
+    std::size_t session_state_size{};    // Number of session state bytes that this resultset has
+    bool has_ok_packet_data{false};      // The OK packet information is default constructed, or actual data?
+    bool is_out_params{false};           // Does this resultset contain OUT param information?
 };
 
 // A container similar to a vector with SBO. To avoid depending on Boost.Container
@@ -46,10 +50,11 @@ class resultset_container
 {
     bool first_has_data_{false};
     per_resultset_data first_;
-    std::vector<per_resultset_data> rest_;
+    std::vector<per_resultset_data, erased_allocator<per_resultset_data>> rest_;
 
 public:
     resultset_container() = default;
+    explicit resultset_container(const erased_allocator<char>& alloc) noexcept : rest_(alloc) {}
     std::size_t size() const noexcept { return !first_has_data_ ? 0 : rest_.size() + 1; }
     bool empty() const noexcept { return !first_has_data_; }
     void clear() noexcept
@@ -82,14 +87,23 @@ public:
 // - When a row batch is started, we record how many fields we had before the batch.
 // - When rows are read, fields are allocated in the rows_impl object, then deserialized against
 //   the allocated storage. At this point, strings/blobs point into the connection read buffer.
-// - When a row batch is finished, we copy strings/blobs into the rows_impl, then transform them
-//   into offsets to allow rows_impl to grow.
-// - When the final OK packet is received, offsets are transformed back into views.
+// - When a row batch is finished, we copy strings/blobs into the rows_impl. String storage
+//   is never reallocated, so views copied by previous batches remain valid as rows_impl grows.
 class results_impl final : public execution_processor
 {
 public:
     results_impl() = default;
 
+    explicit results_impl(const erased_allocator<char>& alloc) noexcept
+        : execution_processor(alloc),
+          meta_(alloc),
+          per_result_(alloc),
+          info_(alloc),
+          session_state_(alloc),
+          rows_(alloc)
+    {
+    }
+
     BOOST_MYSQL_DECL
     row_view get_out_params() const noexcept;
 
@@ -132,6 +146,15 @@ public:
         return string_view(info_.data() + resultset_data.info_offset, resultset_data.info_size);
     }
 
+    session_state_view get_session_state(std::size_t index) const noexcept
+    {
+        const auto& resultset_data = get_resultset(index);
+        return access::construct<session_state_view>(span<const std::uint8_t>(
+            session_state_.data() + resultset_data.session_state_offset,
+            resultset_data.session_state_size
+        ));
+    }
+
     bool get_is_out_params(std::size_t index) const noexcept { return get_resultset(index).is_out_params; }
 
     results_impl& get_interface() noexcept { return *this; }
@@ -164,9 +187,10 @@ private:
     void on_row_batch_finish_impl() override final;
 
     // Data
-    std::vector<metadata> meta_;
+    std::vector<metadata, erased_allocator<metadata>> meta_;
     resultset_container per_result_;
-    std::vector<char> info_;
+    std::vector<char, erased_allocator<char>> info_;
+    std::vector<std::uint8_t, erased_allocator<std::uint8_t>> session_state_;
     row_impl rows_;
     std::size_t num_fields_at_batch_start_{no_batch};
 
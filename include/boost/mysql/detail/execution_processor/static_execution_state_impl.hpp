@@ -12,14 +12,18 @@
 
 #ifdef BOOST_MYSQL_CXX14
 
+#include <boost/mysql/column_buffers.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/typing/column_parser.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
 #include <boost/mysql/detail/typing/row_traits.hpp>
 
 #include <boost/assert.hpp>
@@ -34,13 +38,27 @@ namespace detail {
 
 using execst_parse_fn_t =
     error_code (*)(span<const std::size_t> pos_map, span<const field_view> from, const output_ref& ref);
+using execst_direct_parse_fn_t = error_code (*)(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    const output_ref& ref
+);
+
+// Same as the above, but for column_buffers outputs
+using execst_columns_parse_fn_t = execst_parse_fn_t;
+using execst_columns_direct_parse_fn_t = execst_direct_parse_fn_t;
 
 struct execst_resultset_descriptor
 {
     std::size_t num_columns;
     name_table_t name_table;
+    name_index_t name_index;
     meta_check_fn_t meta_check;
     execst_parse_fn_t parse_fn;
+    execst_direct_parse_fn_t direct_parse_fn;
+    execst_columns_parse_fn_t columns_parse_fn;
+    execst_columns_direct_parse_fn_t columns_direct_parse_fn;
     std::size_t type_index;
 };
 
@@ -68,6 +86,11 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].name_table;
     }
+    name_index_t name_index(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].name_index;
+    }
     meta_check_fn_t meta_check_fn(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
@@ -78,6 +101,21 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].parse_fn;
     }
+    execst_direct_parse_fn_t direct_parse_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].direct_parse_fn;
+    }
+    execst_columns_parse_fn_t columns_parse_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].columns_parse_fn;
+    }
+    execst_columns_direct_parse_fn_t columns_direct_parse_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].columns_direct_parse_fn;
+    }
     std::size_t type_index(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
@@ -128,6 +166,12 @@ public:
         return string_view(info_.data(), info_.size());
     }
 
+    session_state_view get_session_state() const noexcept
+    {
+        BOOST_ASSERT(ok_data_.has_value);
+        return access::construct<session_state_view>(span<const std::uint8_t>(session_state_));
+    }
+
     bool get_is_out_params() const noexcept
     {
         BOOST_ASSERT(ok_data_.has_value);
@@ -149,7 +193,9 @@ private:
     std::size_t resultset_index_{};
     ok_packet_data ok_data_;
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_state_;
     std::vector<metadata> meta_;
+    std::vector<binary_cell> cells_;  // temporary storage for binary rows
 
     // Virtual impls
     BOOST_MYSQL_DECL
@@ -180,6 +226,7 @@ private:
 
     // Auxiliar
     name_table_t current_name_table() const noexcept { return ext_.name_table(resultset_index_ - 1); }
+    name_index_t current_name_index() const noexcept { return ext_.name_index(resultset_index_ - 1); }
     span<std::size_t> current_pos_map() noexcept { return ext_.pos_map(resultset_index_ - 1); }
     span<const std::size_t> current_pos_map() const noexcept { return ext_.pos_map(resultset_index_ - 1); }
 
@@ -205,14 +252,50 @@ static error_code execst_parse_fn(
     return parse<StaticRow>(pos_map, from, ref.span_element<underlying_row_t<StaticRow>>());
 }
 
+template <class StaticRow>
+static error_code execst_direct_parse_fn(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    const output_ref& ref
+)
+{
+    return parse_direct<StaticRow>(pos_map, from, meta, ref.span_element<underlying_row_t<StaticRow>>());
+}
+
+template <class StaticRow>
+static error_code execst_columns_parse_fn(
+    span<const std::size_t> pos_map,
+    span<const field_view> from,
+    const output_ref& ref
+)
+{
+    return parse_columns<StaticRow>(pos_map, from, ref);
+}
+
+template <class StaticRow>
+static error_code execst_columns_direct_parse_fn(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    const output_ref& ref
+)
+{
+    return parse_columns_direct<StaticRow>(pos_map, from, meta, ref);
+}
+
 template <class... StaticRow>
 constexpr std::array<execst_resultset_descriptor, sizeof...(StaticRow)> create_execst_resultset_descriptors()
 {
     return {{{
         get_row_size<StaticRow>(),
         get_row_name_table<StaticRow>(),
+        get_row_name_index<StaticRow>(),
         &meta_check<StaticRow>,
         &execst_parse_fn<StaticRow>,
+        &execst_direct_parse_fn<StaticRow>,
+        &execst_columns_parse_fn<StaticRow>,
+        &execst_columns_direct_parse_fn<StaticRow>,
         get_type_index<underlying_row_t<StaticRow>, StaticRow...>(),
     }...}};
 }
@@ -288,6 +371,18 @@ public:
         return output_ref(output, index, offset);
     }
 
+    template <class ColumnsRow>
+    output_ref make_output_ref(const column_buffers<ColumnsRow>& output) const noexcept
+    {
+        constexpr std::size_t index = get_type_index<underlying_row_t<ColumnsRow>, StaticRow...>();
+        static_assert(
+            index != index_not_found,
+            "column_buffers' row type must be one of the types returned by the query"
+        );
+        const auto& impl = access::get_impl(output);
+        return output_ref(impl.columns.data(), impl.null_bitmap, impl.capacity, index);
+    }
+
     const static_execution_state_erased_impl& get_interface() const noexcept { return impl_; }
     static_execution_state_erased_impl& get_interface() noexcept { return impl_; }
 };
@@ -16,9 +16,11 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
 #include <boost/mysql/detail/typing/readable_field_traits.hpp>
 #include <boost/mysql/detail/typing/row_traits.hpp>
 
@@ -36,13 +38,21 @@ namespace detail {
 using results_reset_fn_t = void (*)(void*);
 using results_parse_fn_t =
     error_code (*)(span<const std::size_t> pos_map, span<const field_view> from, void* to);
+using results_direct_parse_fn_t = error_code (*)(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    void* to
+);
 
 struct results_resultset_descriptor
 {
     std::size_t num_columns;
     name_table_t name_table;
+    name_index_t name_index;
     meta_check_fn_t meta_check;
     results_parse_fn_t parse_fn;
+    results_direct_parse_fn_t direct_parse_fn;
 };
 
 struct static_per_resultset_data
@@ -51,6 +61,8 @@ struct static_per_resultset_data
     std::size_t meta_size{};
     std::size_t info_offset{};
     std::size_t info_size{};
+    std::size_t session_state_offset{};
+    std::size_t session_state_size{};
     bool has_ok_packet_data{false};  // The OK packet information is default constructed, or actual data?
     std::uint64_t affected_rows{};   // OK packet data
     std::uint64_t last_insert_id{};  // OK packet data
@@ -90,6 +102,11 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].name_table;
     }
+    name_index_t name_index(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].name_index;
+    }
     meta_check_fn_t meta_check_fn(std::size_t idx) const noexcept
     {
         BOOST_ASSERT(idx < num_resultsets());
@@ -100,6 +117,11 @@ public:
         BOOST_ASSERT(idx < num_resultsets());
         return desc_[idx].parse_fn;
     }
+    results_direct_parse_fn_t direct_parse_fn(std::size_t idx) const noexcept
+    {
+        BOOST_ASSERT(idx < num_resultsets());
+        return desc_[idx].direct_parse_fn;
+    }
     results_reset_fn_t reset_fn() const noexcept { return reset_; }
     void* rows() const noexcept { return ptr_.rows; }
     span<std::size_t> pos_map(std::size_t idx) const noexcept
@@ -149,6 +171,15 @@ public:
         return string_view(info_.data() + resultset_data.info_offset, resultset_data.info_size);
     }
 
+    session_state_view get_session_state(std::size_t index) const noexcept
+    {
+        const auto& resultset_data = ext_.per_result(index);
+        return access::construct<session_state_view>(span<const std::uint8_t>(
+            session_state_.data() + resultset_data.session_state_offset,
+            resultset_data.session_state_size
+        ));
+    }
+
     bool get_is_out_params(std::size_t index) const noexcept { return ext_.per_result(index).is_out_params; }
 
 private:
@@ -179,12 +210,15 @@ private:
     results_external_data ext_;
     std::vector<metadata> meta_;
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_state_;
+    std::vector<binary_cell> cells_;  // temporary storage for binary rows
     std::size_t resultset_index_{0};
 
     // Helpers
     span<std::size_t> current_pos_map() noexcept { return ext_.pos_map(resultset_index_ - 1); }
     span<const std::size_t> current_pos_map() const noexcept { return ext_.pos_map(resultset_index_ - 1); }
     name_table_t current_name_table() const noexcept { return ext_.name_table(resultset_index_ - 1); }
+    name_index_t current_name_index() const noexcept { return ext_.name_index(resultset_index_ - 1); }
     static_per_resultset_data& current_resultset() noexcept { return ext_.per_result(resultset_index_ - 1); }
     metadata_collection_view current_resultset_meta() const noexcept
     {
@@ -237,6 +271,20 @@ struct results_fns
         return parse<StaticRowT>(pos_map, from, v.back());
     }
 
+    template <std::size_t I>
+    static error_code do_parse_direct(
+        span<const std::size_t> pos_map,
+        span<const binary_cell> from,
+        metadata_collection_view meta,
+        void* to
+    )
+    {
+        using StaticRowT = mp11::mp_at_c<mp11::mp_list<StaticRow...>, I>;
+        auto& v = std::get<I>(*static_cast<rows_t*>(to));
+        v.emplace_back();
+        return parse_direct<StaticRowT>(pos_map, from, meta, v.back());
+    }
+
     template <std::size_t I>
     static constexpr results_resultset_descriptor create_descriptor()
     {
@@ -244,8 +292,10 @@ struct results_fns
         return {
             get_row_size<StaticRowT>(),
             get_row_name_table<StaticRowT>(),
+            get_row_name_index<StaticRowT>(),
             &meta_check<StaticRowT>,
             &do_parse<I>,
+            &do_parse_direct<I>,
         };
     }
 
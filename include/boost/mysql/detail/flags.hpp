@@ -42,6 +42,7 @@ namespace status_flags {
 BOOST_INLINE_CONSTEXPR std::uint32_t more_results = 8;
 BOOST_INLINE_CONSTEXPR std::uint32_t no_backslash_escapes = 512;
 BOOST_INLINE_CONSTEXPR std::uint32_t out_params = 4096;
+BOOST_INLINE_CONSTEXPR std::uint32_t session_state_changed = 16384;
 
 }  // namespace status_flags
 
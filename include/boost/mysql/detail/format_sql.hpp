@@ -12,8 +12,10 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/compiled_format_ref.hpp>
 #include <boost/mysql/detail/writable_field_traits.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -28,10 +30,12 @@ struct formatter;
 class format_context_base;
 class formattable_ref;
 class format_arg;
+struct format_options;
 
 namespace detail {
 
 class format_state;
+struct format_size_counter;
 
 struct formatter_is_unspecialized
 {
@@ -151,6 +155,28 @@ formattable_ref_impl make_formattable_ref(T&& v);
 BOOST_MYSQL_DECL
 void vformat_sql_to(format_context_base& ctx, constant_string_view format_str, span<const format_arg> args);
 
+BOOST_MYSQL_DECL
+void vformat_sql_to(format_context_base& ctx, compiled_format_ref format_str, span<const format_arg> args);
+
+BOOST_MYSQL_DECL
+std::size_t vformat_sql_size_hint(
+    format_options opts,
+    constant_string_view format_str,
+    span<const format_arg> args
+);
+
+BOOST_MYSQL_DECL
+std::size_t vformat_sql_size_hint(
+    format_options opts,
+    compiled_format_ref format_str,
+    span<const format_arg> args
+);
+
+// A cheaper, less accurate version of vformat_sql_size_hint, which doesn't parse the format string
+// or invoke custom formatters. Used to reserve space in the connection's write buffer.
+BOOST_MYSQL_DECL
+std::size_t estimate_formatted_size(format_options opts, string_view format_str, span<const format_arg> args);
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
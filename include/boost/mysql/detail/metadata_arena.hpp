@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_METADATA_ARENA_HPP
+#define BOOST_MYSQL_DETAIL_METADATA_ARENA_HPP
+
+#include <boost/mysql/detail/erased_allocator.hpp>
+
+#include <boost/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Storage for the strings in metadata objects. Instead of allocating a
+// std::string per string and column, strings are appended to reference-counted
+// blocks shared by all the metadata objects of a resultset. metadata objects
+// hold a reference to the block their strings live in, so copies are cheap
+// and outlive the arena that created them.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// The header of a block. Characters are stored right after it.
+struct metadata_block_header
+{
+    std::atomic<std::size_t> refcount;
+    std::size_t capacity;
+    erased_allocator<metadata_block_header> alloc;  // used to deallocate the block
+
+    metadata_block_header(std::size_t capacity, const erased_allocator<char>& alloc) noexcept
+        : refcount(1), capacity(capacity), alloc(alloc)
+    {
+    }
+
+    static std::size_t num_headers(std::size_t capacity) noexcept
+    {
+        return 1u + (capacity + sizeof(metadata_block_header) - 1) / sizeof(metadata_block_header);
+    }
+
+    char* data() noexcept { return reinterpret_cast<char*>(this + 1); }
+};
+
+// An intrusive, thread-safe reference to a block
+class metadata_block_ref
+{
+    metadata_block_header* block_{};
+
+    void release() noexcept
+    {
+        if (block_ && block_->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1u)
+        {
+            auto alloc = block_->alloc;
+            auto n = metadata_block_header::num_headers(block_->capacity);
+            block_->~metadata_block_header();
+            alloc.deallocate(block_, n);
+        }
+    }
+
+    explicit metadata_block_ref(metadata_block_header* block) noexcept : block_(block) {}
+
+public:
+    metadata_block_ref() = default;
+    metadata_block_ref(const metadata_block_ref& other) noexcept : block_(other.block_)
+    {
+        if (block_)
+            block_->refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+    metadata_block_ref(metadata_block_ref&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+    metadata_block_ref& operator=(const metadata_block_ref& other) noexcept
+    {
+        metadata_block_ref(other).swap(*this);
+        return *this;
+    }
+    metadata_block_ref& operator=(metadata_block_ref&& other) noexcept
+    {
+        metadata_block_ref(std::move(other)).swap(*this);
+        return *this;
+    }
+    ~metadata_block_ref() { release(); }
+
+    void swap(metadata_block_ref& other) noexcept { std::swap(block_, other.block_); }
+    void reset() noexcept { metadata_block_ref().swap(*this); }
+
+    metadata_block_header* get() const noexcept { return block_; }
+
+    // Whether this is the only reference to the block
+    bool unique() const noexcept
+    {
+        return block_ && block_->refcount.load(std::memory_order_acquire) == 1u;
+    }
+
+    // Allocates a new block, with space for at least capacity characters
+    static metadata_block_ref create(std::size_t capacity, const erased_allocator<char>& alloc)
+    {
+        erased_allocator<metadata_block_header> header_alloc(alloc);
+        void* mem = header_alloc.allocate(metadata_block_header::num_headers(capacity));
+        return metadata_block_ref(new (mem) metadata_block_header(capacity, alloc));
+    }
+};
+
+// Appends strings to blocks. Owned by execution processors.
+// Blocks are never shared between arenas: copying an arena yields an empty one,
+// using the default allocator (like containers using erased_allocator).
+class metadata_arena
+{
+    metadata_block_ref current_;
+    std::size_t size_{};  // number of characters used in current_
+    erased_allocator<char> alloc_;
+
+public:
+    metadata_arena() = default;
+    explicit metadata_arena(const erased_allocator<char>& alloc) noexcept : alloc_(alloc) {}
+    metadata_arena(const metadata_arena&) noexcept {}
+    metadata_arena(metadata_arena&& other) noexcept
+        : current_(std::move(other.current_)), size_(other.size_), alloc_(other.alloc_)
+    {
+        other.size_ = 0u;
+    }
+    metadata_arena& operator=(const metadata_arena&) noexcept
+    {
+        current_.reset();
+        size_ = 0u;
+        return *this;
+    }
+    metadata_arena& operator=(metadata_arena&& other) noexcept
+    {
+        current_ = std::move(other.current_);
+        size_ = other.size_;
+        alloc_ = other.alloc_;
+        other.size_ = 0u;
+        return *this;
+    }
+    ~metadata_arena() = default;
+
+    // Returns a contiguous region of n characters, placed in the block returned by current_block().
+    // Blocks grow geometrically, so a resultset usually takes a single allocation.
+    char* allocate(std::size_t n)
+    {
+        BOOST_ASSERT(n > 0u);
+        std::size_t capacity = current_.get() ? current_.get()->capacity : 0u;
+        if (capacity - size_ < n)
+        {
+            std::size_t new_capacity = capacity ? capacity * 2u : 512u;
+            if (new_capacity < n)
+                new_capacity = n;
+            current_ = metadata_block_ref::create(new_capacity, alloc_);
+            size_ = 0u;
+        }
+        char* res = current_.get()->data() + size_;
+        size_ += n;
+        return res;
+    }
+
+    const metadata_block_ref& current_block() const noexcept { return current_; }
+
+    // Makes the current block available for new strings if nobody else references it.
+    // Otherwise, the block is released, and will be freed when the last metadata referencing it dies.
+    void reset() noexcept
+    {
+        if (!current_.unique())
+            current_.reset();
+        size_ = 0u;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
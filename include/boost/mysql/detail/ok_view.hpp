@@ -12,6 +12,8 @@
 
 #include <boost/mysql/detail/flags.hpp>
 
+#include <boost/core/span.hpp>
+
 #include <cstdint>
 
 namespace boost {
@@ -25,6 +27,7 @@ struct ok_view
     std::uint16_t status_flags;
     std::uint16_t warnings;
     string_view info;
+    span<const std::uint8_t> session_state;  // raw session state changes, validated
 
     bool more_results() const noexcept { return status_flags & status_flags::more_results; }
     bool backslash_escapes() const noexcept { return !(status_flags & status_flags::no_backslash_escapes); }
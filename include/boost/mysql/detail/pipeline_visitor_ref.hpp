@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_PIPELINE_VISITOR_REF_HPP
+#define BOOST_MYSQL_DETAIL_PIPELINE_VISITOR_REF_HPP
+
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+class stage_response;
+
+namespace detail {
+
+// Type-erased reference to a visitor passed to run_pipeline_each.
+// Resultsets generated by execution stages are handled by the resultset visitor part.
+class pipeline_visitor_ref
+{
+    template <class T>
+    static void do_stage_finished(void* self, std::size_t stage_index, stage_response&& response)
+    {
+        static_cast<T*>(self)->on_stage_finished(stage_index, std::move(response));
+    }
+
+    resultset_visitor_ref resultsets_;
+    void* visitor_{};
+    void (*stage_finished_fn_)(void*, std::size_t, stage_response&&){};
+
+public:
+    pipeline_visitor_ref() = default;
+
+    template <class T, class = typename std::enable_if<!std::is_same<T, pipeline_visitor_ref>::value>::type>
+    explicit pipeline_visitor_ref(T& visitor) noexcept
+        : resultsets_(visitor), visitor_(&visitor), stage_finished_fn_(&do_stage_finished<T>)
+    {
+    }
+
+    bool has_value() const noexcept { return visitor_ != nullptr; }
+    resultset_visitor_ref resultsets() const noexcept { return resultsets_; }
+
+    void on_stage_finished(std::size_t stage_index, stage_response&& response) const
+    {
+        stage_finished_fn_(visitor_, stage_index, std::move(response));
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
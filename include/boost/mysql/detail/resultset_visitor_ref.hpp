@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_RESULTSET_VISITOR_REF_HPP
+#define BOOST_MYSQL_DETAIL_RESULTSET_VISITOR_REF_HPP
+
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/resultset_summary.hpp>
+#include <boost/mysql/rows_view.hpp>
+
+#include <type_traits>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Type-erased reference to a visitor passed to execute_each.
+// Avoids instantiating the algorithm once per visitor type.
+class resultset_visitor_ref
+{
+    template <class T>
+    static void do_head(void* self, metadata_collection_view meta)
+    {
+        static_cast<T*>(self)->on_resultset_head(meta);
+    }
+
+    template <class T>
+    static void do_rows(void* self, rows_view rows)
+    {
+        static_cast<T*>(self)->on_rows(rows);
+    }
+
+    template <class T>
+    static void do_end(void* self, const resultset_summary& summary)
+    {
+        static_cast<T*>(self)->on_resultset_end(summary);
+    }
+
+    void* visitor_{};
+    void (*head_fn_)(void*, metadata_collection_view){};
+    void (*rows_fn_)(void*, rows_view){};
+    void (*end_fn_)(void*, const resultset_summary&){};
+
+public:
+    resultset_visitor_ref() = default;
+
+    template <class T, class = typename std::enable_if<!std::is_same<T, resultset_visitor_ref>::value>::type>
+    explicit resultset_visitor_ref(T& visitor) noexcept
+        : visitor_(&visitor), head_fn_(&do_head<T>), rows_fn_(&do_rows<T>), end_fn_(&do_end<T>)
+    {
+    }
+
+    void on_resultset_head(metadata_collection_view meta) const { head_fn_(visitor_, meta); }
+    void on_rows(rows_view rows) const { rows_fn_(visitor_, rows); }
+    void on_resultset_end(const resultset_summary& summary) const { end_fn_(visitor_, summary); }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -11,10 +11,12 @@
 #include <boost/mysql/field_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
 
 #include <boost/core/span.hpp>
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 namespace boost {
@@ -23,20 +25,119 @@ namespace detail {
 
 // Adds num_fields default-constructed fields to the vector, return pointer to the first
 // allocated value. Used to allocate fields before deserialization
-inline span<field_view> add_fields(std::vector<field_view>& storage, std::size_t num_fields)
+template <class Allocator>
+span<field_view> add_fields(std::vector<field_view, Allocator>& storage, std::size_t num_fields)
 {
     std::size_t old_size = storage.size();
     storage.resize(old_size + num_fields);
     return span<field_view>(storage.data() + old_size, num_fields);
 }
 
-// A field_view vector with strings pointing into a
-// single character buffer. Used to implement owning row types
+using field_vector = std::vector<field_view, erased_allocator<field_view>>;
+
+// Storage for the strings and blobs in a row_impl. Memory is allocated in chunks
+// that are never reallocated, so strings already copied keep their addresses
+// when more strings are added. This allows field_views to point into the storage
+// while rows are being read.
+class row_string_storage
+{
+    struct chunk
+    {
+        unsigned char* data;
+        std::size_t capacity;
+    };
+
+    static constexpr std::size_t min_chunk_size = 512u;
+    static constexpr std::size_t max_chunk_size = 1024u * 1024u;
+
+    chunk current_{};                                    // the chunk we're allocating from
+    std::size_t size_{};                                 // number of bytes used in current_
+    std::vector<chunk, erased_allocator<chunk>> full_;  // chunks allocated before current_
+
+    BOOST_MYSQL_DECL
+    void add_chunk(std::size_t capacity);
+
+    BOOST_MYSQL_DECL
+    void deallocate_full_chunks() noexcept;
+
+    void deallocate_all() noexcept
+    {
+        deallocate_full_chunks();
+        if (current_.data)
+        {
+            erased_allocator<unsigned char> alloc(full_.get_allocator());
+            alloc.deallocate(current_.data, current_.capacity);
+        }
+    }
+
+public:
+    row_string_storage() = default;
+    explicit row_string_storage(const erased_allocator<char>& alloc) noexcept : full_(alloc) {}
+    row_string_storage(const row_string_storage&) = delete;
+    row_string_storage(row_string_storage&& other) noexcept
+        : current_(other.current_), size_(other.size_), full_(std::move(other.full_))
+    {
+        other.current_ = chunk{};
+        other.size_ = 0u;
+        other.full_.clear();
+    }
+    row_string_storage& operator=(const row_string_storage&) = delete;
+    row_string_storage& operator=(row_string_storage&& other) noexcept
+    {
+        deallocate_all();
+        current_ = other.current_;
+        size_ = other.size_;
+        full_ = std::move(other.full_);
+        other.current_ = chunk{};
+        other.size_ = 0u;
+        other.full_.clear();
+        return *this;
+    }
+    ~row_string_storage() { deallocate_all(); }
+
+    // Returns n contiguous bytes. Chunks grow geometrically, up to max_chunk_size
+    unsigned char* allocate(std::size_t n)
+    {
+        if (current_.capacity - size_ < n)
+        {
+            std::size_t capacity = current_.data ? current_.capacity * 2u : min_chunk_size;
+            if (capacity > max_chunk_size)
+                capacity = max_chunk_size;
+            add_chunk(capacity < n ? n : capacity);
+        }
+        unsigned char* res = current_.data + size_;
+        size_ += n;
+        return res;
+    }
+
+    // Ensures that the next n bytes can be allocated without adding chunks.
+    // If a chunk needs to be added, it will have exactly n bytes. Used when
+    // the size of all strings is known in advance, like when copying a row.
+    void reserve(std::size_t n)
+    {
+        if (current_.capacity - size_ < n)
+            add_chunk(n);
+    }
+
+    // Releases all the strings. The current chunk is kept for reuse
+    void clear() noexcept
+    {
+        deallocate_full_chunks();
+        full_.clear();
+        size_ = 0u;
+    }
+};
+
+// A field_view vector with strings pointing into
+// chunked, stable storage. Used to implement owning row types.
+// Memory is obtained from the supplied allocator. Copies use the default allocator.
 class row_impl
 {
 public:
     row_impl() = default;
 
+    explicit row_impl(const erased_allocator<char>& alloc) noexcept : fields_(alloc), strings_(alloc) {}
+
     BOOST_MYSQL_DECL
     row_impl(const row_impl&);
 
@@ -51,7 +152,7 @@ public:
 
     // Copies the given span into *this
     BOOST_MYSQL_DECL
-    row_impl(const field_view* fields, std::size_t size);
+    row_impl(const field_view* fields, std::size_t size, const erased_allocator<char>& alloc = {});
 
     // Copies the given span into *this, used by row/rows in assignment from view
     BOOST_MYSQL_DECL
@@ -63,25 +164,22 @@ public:
         return ::boost::mysql::detail::add_fields(fields_, num_fields);
     }
 
-    // Saves strings in the [first, first+num_fields) range into the string buffer, used by execute
-    BOOST_MYSQL_DECL
-    void copy_strings_as_offsets(std::size_t first, std::size_t num_fields);
-
-    // Restores any offsets into string views, used by execute
+    // Copies strings in the [first, first+num_fields) range into the string storage,
+    // used by execute. Strings copied by previous calls remain valid.
     BOOST_MYSQL_DECL
-    void offsets_to_string_views();
+    void copy_strings(std::size_t first, std::size_t num_fields);
 
-    const std::vector<field_view>& fields() const noexcept { return fields_; }
+    const field_vector& fields() const noexcept { return fields_; }
 
     void clear() noexcept
     {
         fields_.clear();
-        string_buffer_.clear();
+        strings_.clear();
     }
 
 private:
-    std::vector<field_view> fields_;
-    std::vector<unsigned char> string_buffer_;
+    field_vector fields_;
+    row_string_storage strings_;
 };
 
 }  // namespace detail
@@ -0,0 +1,186 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_TYPING_COLUMN_PARSER_HPP
+#define BOOST_MYSQL_DETAIL_TYPING_COLUMN_PARSER_HPP
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
+#include <boost/mysql/detail/typing/pos_map.hpp>
+#include <boost/mysql/detail/typing/readable_field_traits.hpp>
+#include <boost/mysql/detail/typing/row_traits.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/list.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+// Parsing rows into column buffers (see column_buffers), rather than into row objects.
+// Each member of the static row is written to its own array. Optional members are written
+// as their value_type, and NULLs are reported in a separate bitmap.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <class ReadableField, class EnableIf = void>
+struct column_value
+{
+    using type = ReadableField;
+};
+
+template <class ReadableField>
+struct column_value<ReadableField, typename std::enable_if<is_readable_optional<ReadableField>::value>::type>
+{
+    using type = typename ReadableField::value_type;
+};
+
+// The element type of the column buffer for a ReadableField
+template <class ReadableField>
+using column_value_t = typename column_value<ReadableField>::type;
+
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+using row_field_types_t = typename row_traits_with_check<StaticRow>::field_types;
+
+// Whether any of the columns may contain NULLs, thus requiring a bitmap
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+constexpr bool has_nullable_columns() noexcept
+{
+    return mp11::mp_any_of<row_field_types_t<StaticRow>, is_readable_optional>::value;
+}
+
+// A NULL can only be reported through the NULL bitmap. The element is value-initialized,
+// so it never holds stale data, and the read fails if there is nowhere to report the NULL
+template <class T>
+error_code parse_null_column(std::size_t column, std::size_t num_columns, const output_ref& ref)
+{
+    ref.column_element<T>(column) = T();
+    ref.set_null(column, num_columns, true);
+    return ref.has_null_bitmap() ? error_code() : error_code(client_errc::static_row_parsing_error);
+}
+
+template <class FieldTypes>
+struct column_parse_functor
+{
+    span<const std::size_t> pos_map;
+    span<const field_view> fields;
+    const output_ref& ref;
+    error_code& ec;
+
+    template <class I>
+    void operator()(I) const
+    {
+        using field_type = mp11::mp_at<FieldTypes, I>;
+        using value_type = column_value_t<field_type>;
+        constexpr std::size_t num_columns = mp11::mp_size<FieldTypes>::value;
+
+        field_view fv = map_field_view(pos_map, I::value, fields);
+        error_code err;
+        if (is_readable_optional<field_type>::value && fv.is_null())
+        {
+            err = parse_null_column<value_type>(I::value, num_columns, ref);
+        }
+        else
+        {
+            err = readable_field_traits<value_type>::parse(fv, ref.column_element<value_type>(I::value));
+            ref.set_null(I::value, num_columns, false);
+        }
+        if (!ec)
+            ec = err;
+    }
+};
+
+template <class FieldTypes>
+struct column_direct_parse_functor
+{
+    span<const std::size_t> pos_map;
+    span<const binary_cell> cells;
+    metadata_collection_view meta;
+    const output_ref& ref;
+    error_code& ec;
+
+    template <class I>
+    void operator()(I) const
+    {
+        using field_type = mp11::mp_at<FieldTypes, I>;
+        using value_type = column_value_t<field_type>;
+        constexpr std::size_t num_columns = mp11::mp_size<FieldTypes>::value;
+
+        std::size_t db_index = pos_map[I::value];
+        const binary_cell& cell = cells[db_index];
+        error_code err;
+        if (is_readable_optional<field_type>::value && cell.is_null)
+        {
+            err = parse_null_column<value_type>(I::value, num_columns, ref);
+        }
+        else
+        {
+            err = direct_field_parser<value_type>::parse(
+                cell,
+                meta[db_index],
+                ref.column_element<value_type>(I::value)
+            );
+            ref.set_null(I::value, num_columns, false);
+        }
+        if (!ec)
+            ec = err;
+    }
+};
+
+// Parses a row into the columns referenced by ref, at position ref.offset()
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+error_code parse_columns(span<const std::size_t> pos_map, span<const field_view> from, const output_ref& ref)
+{
+    using field_types = row_field_types_t<StaticRow>;
+    BOOST_ASSERT(pos_map.size() == get_row_size<StaticRow>());
+    BOOST_ASSERT(ref.is_columnar());
+    error_code ec;
+    mp11::mp_for_each<mp11::mp_iota<mp11::mp_size<field_types>>>(
+        column_parse_functor<field_types>{pos_map, from, ref, ec}
+    );
+    return ec;
+}
+
+// Same as parse_columns, but for binary rows previously split by split_binary_row
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+error_code parse_columns_direct(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    const output_ref& ref
+)
+{
+    using field_types = row_field_types_t<StaticRow>;
+    BOOST_ASSERT(pos_map.size() == get_row_size<StaticRow>());
+    BOOST_ASSERT(from.size() == meta.size());
+    BOOST_ASSERT(ref.is_columnar());
+    error_code ec;
+    mp11::mp_for_each<mp11::mp_iota<mp11::mp_size<field_types>>>(
+        column_direct_parse_functor<field_types>{pos_map, from, meta, ref, ec}
+    );
+    return ec;
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_DETAIL_TYPING_DIRECT_FIELD_PARSER_HPP
+#define BOOST_MYSQL_DETAIL_TYPING_DIRECT_FIELD_PARSER_HPP
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/typing/readable_field_traits.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Parsing binary protocol values directly into ReadableFields, without going
+// through field_view. Rows are first split into cells (see split_binary_row),
+// which is cheap because no value is decoded. Then, each cell is decoded into
+// the C++ type it maps to. Common types (integers, floating point, strings and blobs)
+// are decoded inline. Less common ones go through field_view.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// The bytes of a binary protocol value, as they appear in the row message.
+// Length-encoded values (strings, blobs, bits) don't include the length prefix.
+// Date and time values do include their length byte.
+struct binary_cell
+{
+    span<const std::uint8_t> data;
+    bool is_null{true};
+};
+
+// Slow path. Decodes a cell into a field_view, with the same semantics as deserialize_binary_field
+BOOST_MYSQL_DECL
+error_code binary_cell_to_field_view(binary_cell cell, const metadata& meta, field_view& output);
+
+inline bool is_binary_string_column(column_type t) noexcept
+{
+    switch (t)
+    {
+    case column_type::char_:
+    case column_type::varchar:
+    case column_type::text:
+    case column_type::enum_:
+    case column_type::set:
+    case column_type::decimal:
+    case column_type::json: return true;
+    default: return false;
+    }
+}
+
+inline bool is_binary_blob_column(column_type t) noexcept
+{
+    switch (t)
+    {
+    case column_type::binary:
+    case column_type::varbinary:
+    case column_type::blob:
+    case column_type::geometry:
+    case column_type::unknown: return true;
+    default: return false;
+    }
+}
+
+template <class ReadableField>
+error_code parse_binary_cell_fallback(binary_cell cell, const metadata& meta, ReadableField& output)
+{
+    field_view fv;
+    auto err = binary_cell_to_field_view(cell, meta, fv);
+    if (err)
+        return err;
+    return readable_field_traits<ReadableField>::parse(fv, output);
+}
+
+template <class ReadableField, class EnableIf = void>
+struct direct_field_parser
+{
+    static error_code parse(binary_cell cell, const metadata& meta, ReadableField& output)
+    {
+        return parse_binary_cell_fallback(cell, meta, output);
+    }
+};
+
+// Integers and bool. Range checks are performed by readable_field_traits,
+// on a field_view that never leaves the stack
+template <class T>
+struct direct_field_parser<T, typename std::enable_if<std::is_integral<T>::value>::type>
+{
+    template <class IntType>
+    static IntType load(const std::uint8_t* p) noexcept
+    {
+        return endian::endian_load<IntType, sizeof(IntType), endian::order::little>(p);
+    }
+
+    static error_code parse(binary_cell cell, const metadata& meta, T& output)
+    {
+        // BIT values are sent as strings
+        if (cell.is_null || meta.type() == column_type::bit)
+            return parse_binary_cell_fallback(cell, meta, output);
+
+        const std::uint8_t* p = cell.data.data();
+        field_view fv;
+        if (meta.is_unsigned())
+        {
+            switch (cell.data.size())
+            {
+            case 1: fv = field_view(static_cast<std::uint64_t>(load<std::uint8_t>(p))); break;
+            case 2: fv = field_view(static_cast<std::uint64_t>(load<std::uint16_t>(p))); break;
+            case 4: fv = field_view(static_cast<std::uint64_t>(load<std::uint32_t>(p))); break;
+            case 8: fv = field_view(load<std::uint64_t>(p)); break;
+            default: return parse_binary_cell_fallback(cell, meta, output);
+            }
+        }
+        else
+        {
+            switch (cell.data.size())
+            {
+            case 1: fv = field_view(static_cast<std::int64_t>(load<std::int8_t>(p))); break;
+            case 2: fv = field_view(static_cast<std::int64_t>(load<std::int16_t>(p))); break;
+            case 4: fv = field_view(static_cast<std::int64_t>(load<std::int32_t>(p))); break;
+            case 8: fv = field_view(load<std::int64_t>(p)); break;
+            default: return parse_binary_cell_fallback(cell, meta, output);
+            }
+        }
+        return readable_field_traits<T>::parse(fv, output);
+    }
+};
+
+template <class T>
+struct direct_field_parser<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    template <class FloatType>
+    static error_code parse_impl(const std::uint8_t* p, T& output)
+    {
+        auto v = endian::endian_load<FloatType, sizeof(FloatType), endian::order::little>(p);
+
+        // Nans and infs not allowed in SQL
+        if (std::isnan(v) || std::isinf(v))
+            return client_errc::protocol_value_error;
+        return readable_field_traits<T>::parse(field_view(v), output);
+    }
+
+    static error_code parse(binary_cell cell, const metadata& meta, T& output)
+    {
+        if (!cell.is_null && cell.data.size() == 4u && meta.type() == column_type::float_)
+            return parse_impl<float>(cell.data.data(), output);
+        else if (!cell.is_null && cell.data.size() == 8u && meta.type() == column_type::double_)
+            return parse_impl<double>(cell.data.data(), output);
+        else
+            return parse_binary_cell_fallback(cell, meta, output);
+    }
+};
+
+template <class Allocator>
+struct direct_field_parser<std::basic_string<char, std::char_traits<char>, Allocator>, void>
+{
+    using string_type = std::basic_string<char, std::char_traits<char>, Allocator>;
+
+    static error_code parse(binary_cell cell, const metadata& meta, string_type& output)
+    {
+        if (cell.is_null || !is_binary_string_column(meta.type()))
+            return parse_binary_cell_fallback(cell, meta, output);
+        output.assign(reinterpret_cast<const char*>(cell.data.data()), cell.data.size());
+        return error_code();
+    }
+};
+
+template <class Allocator>
+struct direct_field_parser<std::vector<unsigned char, Allocator>, void>
+{
+    using blob_type = std::vector<unsigned char, Allocator>;
+
+    static error_code parse(binary_cell cell, const metadata& meta, blob_type& output)
+    {
+        if (cell.is_null || !is_binary_blob_column(meta.type()))
+            return parse_binary_cell_fallback(cell, meta, output);
+        output.assign(cell.data.begin(), cell.data.end());
+        return error_code();
+    }
+};
+
+template <class T>
+struct direct_field_parser<
+    T,
+    typename std::enable_if<
+        is_readable_optional<T>::value && readable_field_traits<typename T::value_type>::is_supported>::type>
+{
+    static error_code parse(binary_cell cell, const metadata& meta, T& output)
+    {
+        if (cell.is_null)
+        {
+            output.reset();
+            return error_code();
+        }
+        else
+        {
+            output.emplace();
+            return direct_field_parser<typename T::value_type>::parse(cell, meta, output.value());
+        }
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/direct_field_parser.ipp>
+#endif
+
+#endif
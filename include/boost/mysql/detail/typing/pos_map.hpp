@@ -17,6 +17,7 @@
 #include <boost/config.hpp>
 #include <boost/core/span.hpp>
 
+#include <algorithm>
 #include <cstddef>
 
 namespace boost {
@@ -30,6 +31,32 @@ using name_table_t = boost::span<const string_view>;
 
 inline bool has_field_names(name_table_t name_table) noexcept { return !name_table.empty(); }
 
+// Indices into a name table, sorted by field name. Allows looking up
+// fields by name using binary search. May be empty, in which case a linear search is performed.
+using name_index_t = boost::span<const std::size_t>;
+
+inline const string_view* find_field_name(
+    name_table_t name_table,
+    name_index_t name_index,
+    string_view field_name
+) noexcept
+{
+    if (name_index.empty())
+    {
+        auto it = std::find(name_table.begin(), name_table.end(), field_name);
+        return it == name_table.end() ? nullptr : it;
+    }
+
+    BOOST_ASSERT(name_index.size() == name_table.size());
+    auto it = std::lower_bound(
+        name_index.begin(),
+        name_index.end(),
+        field_name,
+        [name_table](std::size_t idx, string_view name) { return name_table[idx] < name; }
+    );
+    return it != name_index.end() && name_table[*it] == field_name ? name_table.data() + *it : nullptr;
+}
+
 inline void pos_map_reset(span<std::size_t> self) noexcept
 {
     for (std::size_t i = 0; i < self.size(); ++i)
@@ -39,6 +66,7 @@ inline void pos_map_reset(span<std::size_t> self) noexcept
 inline void pos_map_add_field(
     span<std::size_t> self,
     name_table_t name_table,
+    name_index_t name_index,
     std::size_t db_index,
     string_view field_name
 ) noexcept
@@ -49,10 +77,10 @@ inline void pos_map_add_field(
 
         // We're mapping fields by name. Try to find where in our target struct
         // is the current field located
-        auto it = std::find(name_table.begin(), name_table.end(), field_name);
-        if (it != name_table.end())
+        const string_view* it = find_field_name(name_table, name_index, field_name);
+        if (it != nullptr)
         {
-            std::size_t cpp_index = it - name_table.begin();
+            std::size_t cpp_index = it - name_table.data();
             self[cpp_index] = db_index;
         }
     }
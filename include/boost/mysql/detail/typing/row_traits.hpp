@@ -21,6 +21,7 @@
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
 #include <boost/mysql/detail/typing/meta_check_context.hpp>
 #include <boost/mysql/detail/typing/pos_map.hpp>
 #include <boost/mysql/detail/typing/readable_field_traits.hpp>
@@ -155,6 +156,47 @@ public:
     }
 };
 
+//
+// Name indices, to look up fields by name in logarithmic time.
+// Computed at compile time from the row's name table.
+//
+constexpr bool name_less(string_view lhs, string_view rhs) noexcept
+{
+    // string_view comparisons are not constexpr in C++14
+    std::size_t size = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (lhs.data()[i] != rhs.data()[i])
+            return static_cast<unsigned char>(lhs.data()[i]) < static_cast<unsigned char>(rhs.data()[i]);
+    }
+    return lhs.size() < rhs.size();
+}
+
+template <std::size_t N>
+struct name_index_builder
+{
+    // Insertion sort is stable, so duplicate names are resolved to the first member,
+    // as in a linear search
+    static constexpr array_wrapper<std::size_t, N> build(name_table_t name_table) noexcept
+    {
+        array_wrapper<std::size_t, N> res{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            std::size_t j = i;
+            for (; j > 0 && name_less(name_table[i], name_table[res.data_[j - 1]]); --j)
+                res.data_[j] = res.data_[j - 1];
+            res.data_[j] = i;
+        }
+        return res;
+    }
+};
+
+template <>
+struct name_index_builder<0u>
+{
+    static constexpr array_wrapper<std::size_t, 0u> build(name_table_t) noexcept { return {}; }
+};
+
 //
 // Helpers to implement the external interface section
 //
@@ -256,6 +298,49 @@ struct parse_functor
     }
 };
 
+// Same as parse_context, but reads values directly from binary protocol cells
+class direct_parse_context
+{
+    span<const std::size_t> pos_map_;
+    span<const binary_cell> cells_;
+    metadata_collection_view meta_;
+    std::size_t index_{};
+    error_code ec_;
+
+public:
+    direct_parse_context(
+        span<const std::size_t> pos_map,
+        span<const binary_cell> cells,
+        metadata_collection_view meta
+    ) noexcept
+        : pos_map_(pos_map), cells_(cells), meta_(meta)
+    {
+    }
+
+    template <class ReadableField>
+    void parse(ReadableField& output)
+    {
+        BOOST_ASSERT(index_ < pos_map_.size());
+        std::size_t db_index = pos_map_[index_++];
+        auto ec = direct_field_parser<ReadableField>::parse(cells_[db_index], meta_[db_index], output);
+        if (!ec_)
+            ec_ = ec;
+    }
+
+    error_code error() const noexcept { return ec_; }
+};
+
+struct direct_parse_functor
+{
+    direct_parse_context& ctx;
+
+    template <class ReadableField>
+    void operator()(ReadableField& output) const
+    {
+        ctx.parse(output);
+    }
+};
+
 //
 // External interface. Other Boost.MySQL components should never use row_traits
 // directly, but the functions below, instead.
@@ -293,6 +378,16 @@ constexpr name_table_t get_row_name_table() noexcept
     return row_traits_with_check<StaticRow>::name_table();
 }
 
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+BOOST_INLINE_CONSTEXPR auto name_index_storage =
+    name_index_builder<get_row_name_table<StaticRow>().size()>::build(get_row_name_table<StaticRow>());
+
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+constexpr name_index_t get_row_name_index() noexcept
+{
+    return name_index_storage<StaticRow>.span();
+}
+
 template <BOOST_MYSQL_STATIC_ROW StaticRow>
 error_code meta_check(span<const std::size_t> pos_map, metadata_collection_view meta, diagnostics& diag)
 {
@@ -315,6 +410,23 @@ error_code parse(
     return ctx.error();
 }
 
+// Parses a binary row previously split by split_binary_row. Avoids creating
+// intermediate field_view objects for the most common types
+template <BOOST_MYSQL_STATIC_ROW StaticRow>
+error_code parse_direct(
+    span<const std::size_t> pos_map,
+    span<const binary_cell> from,
+    metadata_collection_view meta,
+    underlying_row_t<StaticRow>& to
+)
+{
+    BOOST_ASSERT(pos_map.size() == get_row_size<StaticRow>());
+    BOOST_ASSERT(from.size() == meta.size());
+    direct_parse_context ctx(pos_map, from, meta);
+    row_traits_with_check<StaticRow>::for_each_member(to, direct_parse_functor{ctx});
+    return ctx.error();
+}
+
 using meta_check_fn_t =
     error_code (*)(span<const std::size_t> field_map, metadata_collection_view meta, diagnostics& diag);
 
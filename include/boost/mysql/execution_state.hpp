@@ -9,13 +9,16 @@
 #define BOOST_MYSQL_EXECUTION_STATE_HPP
 
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace boost {
 namespace mysql {
@@ -45,6 +48,35 @@ public:
      */
     execution_state() = default;
 
+    /**
+     * \brief Constructs an object that allocates memory using `alloc`.
+     * \details
+     * Metadata and any other data read into this object are allocated using a copy of `alloc`.
+     * The constructed object is guaranteed to have `should_start_op() == true`.
+     * \n
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    explicit execution_state(const Allocator& alloc) noexcept : impl_(detail::erased_allocator<char>(alloc))
+    {
+    }
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -197,6 +229,30 @@ public:
      */
     string_view info() const noexcept { return impl_.get_info(); }
 
+    /**
+     * \brief Returns the session state changes reported by the server for the current resultset.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     */
+    session_state_view session_state() const noexcept { return impl_.get_session_state(); }
+
     /**
      * \brief Returns whether the current resultset represents a procedure OUT params.
      * \par Preconditions
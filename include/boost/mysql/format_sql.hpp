@@ -22,6 +22,7 @@
 #include <boost/core/span.hpp>
 #include <boost/system/result.hpp>
 
+#include <cstddef>
 #include <initializer_list>
 #include <string>
 #include <type_traits>
@@ -198,6 +199,9 @@ class format_context_base
         detail::output_string_ref output;
         format_options opts;
         error_code ec;
+
+        // If not null, we're running a sizing pass (see format_sql_size_hint)
+        detail::format_size_counter* size_counter;
     } impl_;
 
     friend struct detail::access;
@@ -208,12 +212,12 @@ class format_context_base
 
 protected:
     format_context_base(detail::output_string_ref out, format_options opts, error_code ec = {}) noexcept
-        : impl_{out, opts, ec}
+        : impl_{out, opts, ec, nullptr}
     {
     }
 
     format_context_base(detail::output_string_ref out, const format_context_base& rhs) noexcept
-        : impl_{out, rhs.impl_.opts, rhs.impl_.ec}
+        : impl_{out, rhs.impl_.opts, rhs.impl_.ec, nullptr}
     {
     }
 
@@ -558,6 +562,45 @@ std::string format_sql(
     std::initializer_list<format_arg> args
 );
 
+/**
+ * \brief Computes an upper bound for the size of a SQL query composed client-side.
+ * \details
+ * Returns the number of bytes that \ref format_sql would generate when invoked with the same
+ * arguments, or a greater number. Use it to reserve the output string's storage before calling
+ * \ref format_sql_to, so it's allocated only once. This is useful when composing big queries,
+ * like batch inserts.
+ * \n
+ * This function runs a sizing pass: `format_str` is parsed and the arguments are measured,
+ * but nothing is written. Most built-in types are measured in constant time.
+ * Strings are scanned for characters that may need escaping. Ranges and types with custom
+ * \ref formatter specializations are traversed, invoking their formatters with a context
+ * that only counts bytes.
+ * \n
+ * The returned value is an estimate: it's only guaranteed to be an upper bound if
+ * custom formatters generate the same output when invoked repeatedly. If formatting
+ * would fail, the returned value is unspecified.
+ *
+ * \par Exception safety
+ * Basic guarantee. Exceptions thrown by custom formatters are propagated.
+ */
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::size_t format_sql_size_hint(format_options opts, constant_string_view format_str, Formattable&&... args);
+
+/**
+ * \copydoc format_sql_size_hint
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+inline std::size_t format_sql_size_hint(
+    format_options opts,
+    constant_string_view format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    return detail::vformat_sql_size_hint(opts, format_str, args);
+}
+
 }  // namespace mysql
 }  // namespace boost
 
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_GTID_SET_HPP
+#define BOOST_MYSQL_GTID_SET_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/system/result.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) The UUID identifying the server where a transaction originated.
+ * \details
+ * Stored in binary form, in the order used by the MySQL wire protocol
+ * (the same order as its textual representation).
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+using gtid_source_id = std::array<std::uint8_t, 16>;
+
+/**
+ * \brief (EXPERIMENTAL) A set of global transaction identifiers (GTIDs).
+ * \details
+ * Represents a MySQL GTID set, like `3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11`.
+ * GTIDs are grouped by source ID and stored as sorted, non-overlapping intervals,
+ * so adding consecutive transactions doesn't cause the set to grow.
+ * \n
+ * This is the type used by \ref binlog_stream to track replication progress,
+ * and by \ref binlog_dump_params to specify where to start replicating from.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class gtid_set
+{
+#ifndef BOOST_MYSQL_DOXYGEN
+    struct interval
+    {
+        // Inclusive range
+        std::uint64_t first;
+        std::uint64_t last;
+    };
+
+    struct source_entry
+    {
+        gtid_source_id id;
+        std::vector<interval> intervals;
+    };
+
+    // Sorted by source ID
+    std::vector<source_entry> impl_;
+
+    friend struct detail::access;
+#endif
+
+public:
+    /**
+     * \brief Default constructor.
+     * \details Constructs an empty set.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    gtid_set() = default;
+
+    /**
+     * \brief Returns whether the set contains no GTIDs.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return impl_.empty(); }
+
+    /**
+     * \brief Removes all GTIDs from the set.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void clear() noexcept { impl_.clear(); }
+
+    /**
+     * \brief Adds a GTID to the set.
+     * \details
+     * Adding a GTID that is already in the set is a no-op.
+     * `transaction_id` should be non-zero, since zero is never a valid transaction ID.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     * \throws std::invalid_argument If `transaction_id` is the maximum `std::uint64_t` value,
+     *         which can't be represented in the binlog protocol.
+     */
+    void add(const gtid_source_id& source_id, std::uint64_t transaction_id)
+    {
+        add(source_id, transaction_id, transaction_id);
+    }
+
+    /**
+     * \brief Adds a range of GTIDs to the set.
+     * \details
+     * Adds all GTIDs from `source_id` with transaction IDs in the closed interval `[first, last]`.
+     * Ranges may overlap with GTIDs already in the set.
+     * Requires `first <= last`.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     * \throws std::invalid_argument If `last` is the maximum `std::uint64_t` value.
+     *         The binlog protocol encodes intervals with exclusive upper bounds,
+     *         so this value can't be represented.
+     */
+    BOOST_MYSQL_DECL
+    void add(const gtid_source_id& source_id, std::uint64_t first, std::uint64_t last);
+
+    /**
+     * \brief Returns whether a GTID is contained in the set.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    bool contains(const gtid_source_id& source_id, std::uint64_t transaction_id) const noexcept;
+
+    /**
+     * \brief Returns the textual representation of the set.
+     * \details
+     * The output has the format used by the server (e.g. in `@@global.gtid_executed`),
+     * and can be parsed back using \ref gtid_set::parse.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    std::string to_string() const;
+
+    /**
+     * \brief Parses a GTID set from its textual representation.
+     * \details
+     * Accepts the format used by the server, like `3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11`.
+     * Several sources may be separated by commas. Whitespace around separators is allowed.
+     * An empty string is parsed as an empty set.
+     * \n
+     * If the input is malformed, returns \ref client_errc::invalid_gtid_set.
+     * Transaction IDs must be between 1 and the maximum `std::uint64_t` value, exclusive.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    static system::result<gtid_set> parse(string_view input);
+
+    /**
+     * \brief Equality operator.
+     * \details Returns whether both sets contain the same GTIDs.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    bool operator==(const gtid_set& rhs) const noexcept;
+
+    /**
+     * \brief Inequality operator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool operator!=(const gtid_set& rhs) const noexcept { return !(*this == rhs); }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/gtid_set.ipp>
+#endif
+
+#endif
@@ -19,11 +19,14 @@
 
 std::unique_ptr<boost::mysql::detail::engine> boost::mysql::any_connection::create_engine(
     asio::any_io_executor ex,
-    asio::ssl::context* ctx
+    const any_connection_params& params
 )
 {
-    return std::unique_ptr<detail::engine>(new detail::engine_impl<detail::variant_stream>(std::move(ex), ctx)
-    );
+    return std::unique_ptr<detail::engine>(new detail::engine_impl<detail::variant_stream>(
+        std::move(ex),
+        params.ssl_context,
+        params.busy_poll_duration
+    ));
 }
 
 #endif
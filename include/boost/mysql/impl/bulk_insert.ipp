@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_BULK_INSERT_IPP
+#define BOOST_MYSQL_IMPL_BULK_INSERT_IPP
+
+#pragma once
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/bulk_insert.hpp>
+#include <boost/mysql/pipeline.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <boost/mysql/impl/internal/bulk_insert.hpp>
+#include <boost/mysql/impl/internal/coroutine.hpp>
+
+#include <boost/asio/compose.hpp>
+#include <boost/asio/post.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline bool bulk_insert_request_empty(const pipeline_request& req)
+{
+    return access::get_impl(req).stages_.empty();
+}
+
+// Statements that failed don't contain results
+inline std::uint64_t bulk_insert_affected_rows(const std::vector<stage_response>& responses)
+{
+    std::uint64_t res = 0;
+    for (const auto& resp : responses)
+    {
+        if (resp.has_results())
+            res += resp.as_results().affected_rows();
+    }
+    return res;
+}
+
+struct bulk_insert_op
+{
+    // The op is moved every time it yields, and the builder points to the row source.
+    // Keeping the state in the heap makes these pointers stable
+    struct state_t
+    {
+        any_connection* conn;
+        std::unique_ptr<bulk_insert_row_source> rows;
+        diagnostics* diag;
+        bulk_insert_builder builder;
+        format_options opts{};
+        pipeline_request req;
+        std::vector<stage_response> responses;
+        std::uint64_t affected_rows{0};
+
+        state_t(
+            any_connection& conn,
+            string_view insert_prefix,
+            std::unique_ptr<bulk_insert_row_source> rows_arg,
+            const bulk_insert_params& params,
+            diagnostics& diag
+        )
+            : conn(&conn),
+              rows(std::move(rows_arg)),
+              diag(&diag),
+              builder(insert_prefix, *rows, params.max_statement_size, params.max_pipeline_size)
+        {
+        }
+    };
+
+    int resume_point_{0};
+    std::unique_ptr<state_t> st_;
+
+    bulk_insert_op(std::unique_ptr<state_t> st) noexcept : st_(std::move(st)) {}
+
+    template <class Self>
+    void operator()(Self& self, error_code ec = {})
+    {
+        switch (resume_point_)
+        {
+        case 0:
+
+            st_->diag->clear();
+
+            // Get the format options
+            {
+                auto opts = st_->conn->format_opts();
+                if (opts.has_error())
+                    ec = opts.error();
+                else
+                    st_->opts = *opts;
+            }
+
+            while (!ec && !st_->builder.done())
+            {
+                // Compose as many statements as fit in the pipeline
+                ec = st_->builder.fill(st_->req, st_->opts);
+                if (ec || bulk_insert_request_empty(st_->req))
+                    break;
+
+                // Run them
+                BOOST_MYSQL_YIELD(
+                    resume_point_,
+                    1,
+                    st_->conn->async_run_pipeline(st_->req, st_->responses, *st_->diag, std::move(self))
+                )
+                st_->affected_rows += bulk_insert_affected_rows(st_->responses);
+            }
+
+            // Errors may happen before any statement is run. Never complete inline
+            if (resume_point_ == 0)
+            {
+                BOOST_MYSQL_YIELD(resume_point_, 2, asio::post(std::move(self)))
+            }
+
+            // Completing destroys the state
+            std::uint64_t affected_rows = st_->affected_rows;
+            self.complete(ec, affected_rows);
+        }
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+std::uint64_t boost::mysql::detail::bulk_insert_erased(
+    any_connection& conn,
+    string_view insert_prefix,
+    bulk_insert_row_source& rows,
+    const bulk_insert_params& params,
+    error_code& err,
+    diagnostics& diag
+)
+{
+    err.clear();
+    diag.clear();
+
+    // Get the format options
+    auto opts = conn.format_opts();
+    if (opts.has_error())
+    {
+        err = opts.error();
+        return 0u;
+    }
+
+    bulk_insert_builder builder(insert_prefix, rows, params.max_statement_size, params.max_pipeline_size);
+    pipeline_request req;
+    std::vector<stage_response> responses;
+    std::uint64_t affected_rows = 0;
+
+    while (!builder.done())
+    {
+        // Compose as many statements as fit in the pipeline
+        err = builder.fill(req, *opts);
+        if (err || bulk_insert_request_empty(req))
+            break;
+
+        // Run them
+        conn.run_pipeline(req, responses, err, diag);
+        affected_rows += bulk_insert_affected_rows(responses);
+        if (err)
+            break;
+    }
+
+    return affected_rows;
+}
+
+void boost::mysql::detail::async_bulk_insert_erased(
+    any_connection& conn,
+    string_view insert_prefix,
+    std::unique_ptr<bulk_insert_row_source> rows,
+    const bulk_insert_params& params,
+    diagnostics& diag,
+    asio::any_completion_handler<void(error_code, std::uint64_t)> handler
+)
+{
+    std::unique_ptr<bulk_insert_op::state_t> st(
+        new bulk_insert_op::state_t(conn, insert_prefix, std::move(rows), params, diag)
+    );
+    asio::async_compose<
+        asio::any_completion_handler<void(error_code, std::uint64_t)>,
+        void(error_code, std::uint64_t)>(bulk_insert_op(std::move(st)), handler, conn.get_executor());
+}
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_COMPACT_ROWS_IPP
+#define BOOST_MYSQL_IMPL_COMPACT_ROWS_IPP
+
+#pragma once
+
+#include <boost/mysql/compact_rows.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline bool fits_compact_datetime(const datetime& dt) noexcept
+{
+    using c = compact_datetime;
+    return dt.year() < (1u << c::year_bits) && dt.month() < (1u << c::month_bits) &&
+           dt.day() < (1u << c::day_bits) && dt.hour() < (1u << c::hour_bits) &&
+           dt.minute() < (1u << c::minute_bits) && dt.second() < (1u << c::second_bits) &&
+           dt.microsecond() < (1u << c::microsecond_bits);
+}
+
+inline std::uint64_t pack_compact_datetime(const datetime& dt) noexcept
+{
+    using c = compact_datetime;
+    return (std::uint64_t(dt.year()) << c::year_shift) | (std::uint64_t(dt.month()) << c::month_shift) |
+           (std::uint64_t(dt.day()) << c::day_shift) | (std::uint64_t(dt.hour()) << c::hour_shift) |
+           (std::uint64_t(dt.minute()) << c::minute_shift) |
+           (std::uint64_t(dt.second()) << c::second_shift) |
+           (std::uint64_t(dt.microsecond()) << c::microsecond_shift);
+}
+
+template <class T>
+std::uint64_t to_payload(T value) noexcept
+{
+    std::uint64_t res = 0u;
+    std::memcpy(&res, &value, sizeof(T));
+    return res;
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+void boost::mysql::compact_rows::push_field(field_view f)
+{
+    // Space has been reserved by append, so this doesn't throw
+    std::uint64_t payload = 0u;
+    auto kind = static_cast<detail::compact_kind>(f.kind());
+    switch (f.kind())
+    {
+    case field_kind::int64: payload = detail::to_payload(f.get_int64()); break;
+    case field_kind::uint64: payload = f.get_uint64(); break;
+    case field_kind::string:
+    case field_kind::blob:
+    {
+        bool is_blob = f.kind() == field_kind::blob;
+        const unsigned char* data = is_blob ? f.get_blob().data()
+                                            : reinterpret_cast<const unsigned char*>(f.get_string().data());
+        std::size_t size = is_blob ? f.get_blob().size() : f.get_string().size();
+        std::size_t offset = strings_.size();
+        strings_.insert(strings_.end(), data, data + size);
+        if (offset + size <= 0xffffffffu)
+        {
+            payload = (static_cast<std::uint64_t>(offset) << 32u) | size;
+        }
+        else
+        {
+            kind = is_blob ? detail::compact_kind::wide_blob : detail::compact_kind::wide_string;
+            payload = wide_strings_.size();
+            wide_strings_.push_back({offset, size});
+        }
+        break;
+    }
+    case field_kind::float_: payload = detail::to_payload(f.get_float()); break;
+    case field_kind::double_: payload = detail::to_payload(f.get_double()); break;
+    case field_kind::date:
+    {
+        auto d = f.get_date();
+        payload = (std::uint64_t(d.year()) << 16u) | (std::uint64_t(d.month()) << 8u) | d.day();
+        break;
+    }
+    case field_kind::datetime:
+    {
+        auto dt = f.get_datetime();
+        if (detail::fits_compact_datetime(dt))
+        {
+            payload = detail::pack_compact_datetime(dt);
+        }
+        else
+        {
+            kind = detail::compact_kind::wide_datetime;
+            payload = wide_datetimes_.size();
+            wide_datetimes_.push_back(dt);
+        }
+        break;
+    }
+    case field_kind::time: payload = detail::to_payload(f.get_time().count()); break;
+    case field_kind::null:
+    default: break;
+    }
+    payloads_.push_back(payload);
+    kinds_.push_back(kind);
+}
+
+void boost::mysql::compact_rows::append(const rows_view& r)
+{
+    if (r.empty())
+        return;
+    if (!empty() && r.num_columns() != num_columns_)
+        BOOST_THROW_EXCEPTION(std::invalid_argument("compact_rows::append: number of columns mismatch"));
+
+    // Reserve everything we need upfront. After this, nothing throws, so we
+    // provide the strong guarantee
+    std::size_t num_fields = r.size() * r.num_columns();
+    std::size_t num_strings = 0u, string_bytes = 0u, num_wide_datetimes = 0u;
+    for (std::size_t i = 0; i < r.size(); ++i)
+    {
+        for (field_view f : r[i])
+        {
+            switch (f.kind())
+            {
+            case field_kind::string:
+                ++num_strings;
+                string_bytes += f.get_string().size();
+                break;
+            case field_kind::blob:
+                ++num_strings;
+                string_bytes += f.get_blob().size();
+                break;
+            case field_kind::datetime:
+                if (!detail::fits_compact_datetime(f.get_datetime()))
+                    ++num_wide_datetimes;
+                break;
+            default: break;
+            }
+        }
+    }
+    payloads_.reserve(payloads_.size() + num_fields);
+    kinds_.reserve(kinds_.size() + num_fields);
+    strings_.reserve(strings_.size() + string_bytes);
+    if (strings_.size() + string_bytes > 0xffffffffu)
+        wide_strings_.reserve(wide_strings_.size() + num_strings);
+    wide_datetimes_.reserve(wide_datetimes_.size() + num_wide_datetimes);
+
+    for (std::size_t i = 0; i < r.size(); ++i)
+    {
+        for (field_view f : r[i])
+            push_field(f);
+    }
+    num_columns_ = r.num_columns();
+}
+
+#endif
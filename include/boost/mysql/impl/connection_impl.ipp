@@ -100,6 +100,13 @@ boost::mysql::detail::run_pipeline_algo_params boost::mysql::detail::connection_
     return {req_impl.buffer_, req_impl.stages_, &response};
 }
 
+boost::mysql::detail::run_pipeline_each_algo_params boost::mysql::detail::connection_impl::
+    make_params_pipeline_each(const pipeline_request& req, pipeline_visitor_ref visitor)
+{
+    const auto& req_impl = access::get_impl(req);
+    return {req_impl.buffer_, req_impl.stages_, visitor};
+}
+
 template <class AlgoParams>
 boost::mysql::detail::any_resumable_ref boost::mysql::detail::setup(
     connection_state& st,
@@ -131,10 +138,13 @@ namespace detail {
 BOOST_MYSQL_INSTANTIATE_SETUP(connect_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(handshake_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(execute_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(execute_each_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(start_execution_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(read_resultset_head_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_dynamic_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_batch_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(read_some_rows_lazy_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(prepare_statement_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(close_statement_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(set_character_set_algo_params)
@@ -143,10 +153,14 @@ BOOST_MYSQL_INSTANTIATE_SETUP(reset_connection_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(quit_connection_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(close_connection_algo_params)
 BOOST_MYSQL_INSTANTIATE_SETUP(run_pipeline_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(run_pipeline_each_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(binlog_dump_algo_params)
+BOOST_MYSQL_INSTANTIATE_SETUP(read_binlog_event_algo_params)
 
 BOOST_MYSQL_INSTANTIATE_GET_RESULT(read_some_rows_algo_params)
 BOOST_MYSQL_INSTANTIATE_GET_RESULT(read_some_rows_dynamic_algo_params)
 BOOST_MYSQL_INSTANTIATE_GET_RESULT(prepare_statement_algo_params)
+BOOST_MYSQL_INSTANTIATE_GET_RESULT(read_binlog_event_algo_params)
 
 }  // namespace detail
 }  // namespace mysql
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_DIRECT_FIELD_PARSER_IPP
+#define BOOST_MYSQL_IMPL_DIRECT_FIELD_PARSER_IPP
+
+#pragma once
+
+#include <boost/mysql/column_type.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/binary_protocol.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/bit_deserialization.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/deserialization_context.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/span_string.hpp>
+
+boost::mysql::error_code boost::mysql::detail::binary_cell_to_field_view(
+    binary_cell cell,
+    const metadata& meta,
+    field_view& output
+)
+{
+    if (cell.is_null)
+    {
+        output = field_view();
+        return error_code();
+    }
+
+    // Length-encoded values don't include their length prefix
+    auto type = meta.type();
+    if (type == column_type::bit)
+    {
+        return to_error_code(deserialize_bit(to_string(cell.data), output));
+    }
+    else if (is_binary_string_column(type))
+    {
+        output = field_view(to_string(cell.data));
+    }
+    else if (is_binary_blob_column(type))
+    {
+        output = field_view(cell.data);
+    }
+    else
+    {
+        // Fixed-size values and dates are stored as they appear in the message
+        deserialization_context ctx(cell.data);
+        auto err = deserialize_binary_field(ctx, meta, output);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+        return ctx.check_extra_bytes();
+    }
+    return error_code();
+}
+
+#endif
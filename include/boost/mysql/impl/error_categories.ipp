@@ -86,6 +86,13 @@ inline const char* error_to_string(client_errc error)
     case client_errc::max_buffer_size_exceeded:
         return "An operation attempted to read or write a packet larger than the maximum buffer size. "
                "Try increasing any_connection_params::max_buffer_size.";
+    case client_errc::invalid_gtid_set: return "The supplied string does not contain a valid GTID set.";
+    case client_errc::bulk_insert_row_too_large:
+        return "A row passed to bulk_insert is too large to fit into a single INSERT statement. "
+               "Try increasing bulk_insert_params::max_statement_size.";
+    case client_errc::binlog_stream_not_started:
+        return "read_binlog_event was called with a binlog_stream that hasn't been started. "
+               "Call start_binlog_dump first.";
 
     default: return "<unknown MySQL client error>";
     }
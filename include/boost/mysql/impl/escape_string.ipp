@@ -16,9 +16,13 @@
 #include <boost/mysql/escape_string.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/character_set.hpp>
 #include <boost/mysql/detail/output_string.hpp>
 
-#include <boost/mysql/impl/internal/call_next_char.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+
 
 namespace boost {
 namespace mysql {
@@ -37,11 +41,44 @@ public:
     string_view data() const noexcept { return string_view(data_, 2); }
 };
 
-// Escaper is a function object that takes a char and returns a
-// escape_sequence determining whether we should escape the char or not
-template <class Escaper>
+// Multi-byte advancers are function objects that take a range starting with a non-ASCII byte
+// and return the size of the character at its beginning, or 0 if it's not valid.
+// The specialized ones are selected once per string, and avoid an indirect call per character
+inline span<const unsigned char> to_span(const char* first, const char* last) noexcept
+{
+    return {reinterpret_cast<const unsigned char*>(first), static_cast<std::size_t>(last - first)};
+}
+
+struct generic_mb_advancer
+{
+    character_set charset;
+
+    std::size_t operator()(const char* first, const char* last) const noexcept
+    {
+        return charset.next_char(to_span(first, last));
+    }
+};
+
+struct utf8mb4_mb_advancer
+{
+    std::size_t operator()(const char* first, const char* last) const noexcept
+    {
+        return detail::next_char_utf8mb4(to_span(first, last));
+    }
+};
+
+struct ascii_mb_advancer
+{
+    std::size_t operator()(const char*, const char*) const noexcept { return 0u; }
+};
+
+// Escaper is a function object that takes an ASCII char and returns a
+// escape_sequence determining whether we should escape the char or not.
+// ASCII characters are always 1 byte (UTF-16 and friends are not supported),
+// and they're the only ones that may be escaped
+template <class Escaper, class MultiByteAdvancer>
 BOOST_ATTRIBUTE_NODISCARD error_code
-escape_impl(string_view input, character_set charset, Escaper escaper, output_string_ref output)
+escape_impl(string_view input, MultiByteAdvancer advance_mb, Escaper escaper, output_string_ref output)
 {
     const char* it = input.data();
     const char* end = it + input.size();
@@ -51,25 +88,26 @@ escape_impl(string_view input, character_set charset, Escaper escaper, output_st
     const char* raw_begin = it;
     while (it != end)
     {
-        escape_sequence seq = escaper(*it);
-        if (seq.is_escape())
+        if (static_cast<unsigned char>(*it) < 0x80)
         {
-            // Dump what we already had
-            output.append({raw_begin, it});
-
-            // Output the escape sequence
-            output.append(seq.data());
-
-            // Advance
+            escape_sequence seq = escaper(*it);
+            if (seq.is_escape())
+            {
+                // Dump what we already had
+                output.append({raw_begin, it});
+
+                // Output the escape sequence
+                output.append(seq.data());
+
+                // Update the start of the range that doesn't need escaping
+                raw_begin = it + 1;
+            }
             ++it;
-
-            // Update the start of the range that doesn't need escaping
-            raw_begin = it;
         }
         else
         {
-            // Advance with the charset function
-            std::size_t char_size = detail::call_next_char(charset, it, end);
+            // May be a multi-byte character. Advance with the charset function
+            std::size_t char_size = advance_mb(it, end);
             if (char_size == 0u)
                 return client_errc::invalid_encoding;
             it += char_size;
@@ -113,6 +151,21 @@ struct quote_escaper
     }
 };
 
+// Selects the char advancer for the given character set. Character sets are compared
+// by their next_char function, which is what determines escaping. Charsets without
+// a specialized advancer (e.g. user-defined ones) use the generic one
+template <class Escaper>
+BOOST_ATTRIBUTE_NODISCARD error_code
+escape_dispatch(string_view input, character_set charset, Escaper escaper, output_string_ref output)
+{
+    if (charset.next_char == &detail::next_char_utf8mb4)
+        return detail::escape_impl(input, utf8mb4_mb_advancer(), escaper, output);
+    else if (charset.next_char == &detail::next_char_ascii)
+        return detail::escape_impl(input, ascii_mb_advancer(), escaper, output);
+    else
+        return detail::escape_impl(input, generic_mb_advancer{charset}, escaper, output);
+}
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -125,8 +178,8 @@ boost::mysql::error_code boost::mysql::detail::escape_string(
 )
 {
     return (escape_char == '`' || !opts.backslash_escapes)
-               ? detail::escape_impl(input, opts.charset, quote_escaper(escape_char), output)
-               : detail::escape_impl(input, opts.charset, backslash_escaper(), output);
+               ? detail::escape_dispatch(input, opts.charset, quote_escaper(escape_char), output)
+               : detail::escape_dispatch(input, opts.charset, backslash_escaper(), output);
 }
 
 #endif
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_EXECUTE_EACH_PROCESSOR_IPP
+#define BOOST_MYSQL_IMPL_EXECUTE_EACH_PROCESSOR_IPP
+
+#pragma once
+
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/resultset_summary.hpp>
+#include <boost/mysql/rows_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/execution_processor/execute_each_processor.hpp>
+#include <boost/mysql/detail/row_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+
+void boost::mysql::detail::execute_each_processor::flush_rows()
+{
+    if (!fields_.empty())
+    {
+        visitor_.on_rows(access::construct<rows_view>(fields_.data(), fields_.size(), meta_.size()));
+        fields_.clear();
+    }
+}
+
+void boost::mysql::detail::execute_each_processor::reset_impl() noexcept
+{
+    meta_.clear();
+    fields_.clear();
+}
+
+boost::mysql::error_code boost::mysql::detail::execute_each_processor::
+    on_head_ok_packet_impl(const ok_view& pack, diagnostics&)
+{
+    // A resultset without rows, like the ones generated by UPDATEs
+    meta_.clear();
+    visitor_.on_resultset_head(metadata_collection_view());
+    visitor_.on_resultset_end(access::construct<resultset_summary>(pack));
+    return error_code();
+}
+
+void boost::mysql::detail::execute_each_processor::on_num_meta_impl(std::size_t num_columns)
+{
+    meta_.clear();
+    meta_.reserve(num_columns);
+}
+
+boost::mysql::error_code boost::mysql::detail::execute_each_processor::
+    on_meta_impl(const coldef_view& coldef, bool is_last, diagnostics&)
+{
+    meta_.push_back(create_meta(coldef));
+    if (is_last)
+        visitor_.on_resultset_head(meta_);
+    return error_code();
+}
+
+boost::mysql::error_code boost::mysql::detail::execute_each_processor::
+    on_row_impl(span<const std::uint8_t> msg, const output_ref&, std::vector<field_view>&)
+{
+    // Rows are accumulated until the batch finishes, so they can be delivered together
+    span<field_view> storage = add_fields(fields_, meta_.size());
+    return deserialize_row(encoding(), msg, meta_, storage);
+}
+
+boost::mysql::error_code boost::mysql::detail::execute_each_processor::on_row_ok_packet_impl(
+    const ok_view& pack
+)
+{
+    // Rows for this resultset must be delivered before its end
+    flush_rows();
+    visitor_.on_resultset_end(access::construct<resultset_summary>(pack));
+    return error_code();
+}
+
+#endif
@@ -23,6 +23,7 @@ void boost::mysql::detail::execution_state_impl::on_ok_packet_impl(const ok_view
     eof_data_.warnings = pack.warnings;
     eof_data_.is_out_params = pack.is_out_params();
     info_.assign(pack.info.begin(), pack.info.end());
+    session_state_.assign(pack.session_state.begin(), pack.session_state.end());
 }
 
 void boost::mysql::detail::execution_state_impl::reset_impl() noexcept
@@ -30,6 +31,7 @@ void boost::mysql::detail::execution_state_impl::reset_impl() noexcept
     meta_.clear();
     eof_data_ = ok_data();
     info_.clear();
+    session_state_.clear();
 }
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::
@@ -55,16 +57,26 @@ boost::mysql::error_code boost::mysql::detail::execution_state_impl::
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::on_row_impl(
     span<const std::uint8_t> msg,
-    const output_ref&,
+    const output_ref& ref,
     std::vector<field_view>& fields
 )
 
 {
+    // lazy_row_batch: just record where each field is
+    if (ref.cells())
+    {
+        auto& cells = *ref.cells();
+        std::size_t offset = cells.size();
+        cells.resize(offset + meta_.size());
+        return encoding() == resultset_encoding::text ? split_text_row(msg, meta(), cells.data() + offset)
+                                                      : split_binary_row(msg, meta(), cells.data() + offset);
+    }
+
     // add row storage
     span<field_view> storage = add_fields(fields, meta_.size());
 
     // deserialize the row
-    return deserialize_row(encoding(), msg, meta_, storage);
+    return deserialize_row(encoding(), msg, meta(), storage);
 }
 
 boost::mysql::error_code boost::mysql::detail::execution_state_impl::on_row_ok_packet_impl(const ok_view& pack
@@ -188,4 +188,18 @@ std::string boost::mysql::format_sql(
     return format_sql(opts, format_str, args_il);
 }
 
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::size_t boost::mysql::format_sql_size_hint(
+    format_options opts,
+    constant_string_view format_str,
+    Formattable&&... args
+)
+{
+    std::initializer_list<format_arg> args_il{
+        {string_view(), std::forward<Formattable>(args)}
+        ...
+    };
+    return detail::vformat_sql_size_hint(opts, format_str, args_il);
+}
+
 #endif
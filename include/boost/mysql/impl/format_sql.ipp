@@ -27,6 +27,7 @@
 #include <boost/mysql/impl/internal/byte_to_hex.hpp>
 #include <boost/mysql/impl/internal/call_next_char.hpp>
 #include <boost/mysql/impl/internal/dt_to_string.hpp>
+#include <boost/mysql/impl/internal/int_to_string.hpp>
 
 #include <boost/charconv/from_chars.hpp>
 #include <boost/charconv/to_chars.hpp>
@@ -58,19 +59,12 @@ inline void append_quoted_identifier(string_view name, format_context_base& ctx)
 template <class T>
 void append_int(T integer, format_context_base& ctx)
 {
-    // Make sure our buffer is big enough. 2: sign + digits10 is only 1 below max
-    constexpr std::size_t buffsize = 32;
-    static_assert(2 + std::numeric_limits<double>::digits10 < buffsize, "");
-
-    char buff[buffsize];
-
-    auto res = charconv::to_chars(buff, buff + buffsize, integer);
-
-    // Can only fail becuase of buffer being too small
-    BOOST_ASSERT(res.ec == std::errc());
+    // 20 chars is enough for any 64-bit integer, including the sign
+    char buff[24];
+    char* end = detail::write_int(buff, integer);
 
     // Copy
-    access::get_impl(ctx).output.append(string_view(buff, res.ptr - buff));
+    access::get_impl(ctx).output.append(string_view(buff, end - buff));
 }
 
 inline void append_double(double number, format_context_base& ctx)
@@ -257,6 +251,87 @@ inline void append_field_view(
     }
 }
 
+// Helpers for the sizing pass. These return upper bounds of the number of bytes
+// that append_field_view would generate, without formatting anything
+struct format_size_counter
+{
+    std::size_t size{0};
+
+    void append(const char*, std::size_t sz) { size += sz; }
+};
+
+inline std::size_t escaped_string_size_hint(string_view str, const format_options& opts, char quote_char)
+{
+    // Each escaped character generates two. Multi-byte characters are never escaped,
+    // but their bytes might be counted here. This yields an upper bound, which is good enough
+    std::size_t res = str.size() + 2u;  // quotes
+    if (quote_char == '`' || !opts.backslash_escapes)
+    {
+        for (char c : str)
+            res += (c == quote_char);
+    }
+    else
+    {
+        for (char c : str)
+        {
+            switch (c)
+            {
+            case '\0':
+            case '\n':
+            case '\r':
+            case '\\':
+            case '\'':
+            case '"':
+            case '\x1a': ++res; break;
+            default: break;
+            }
+        }
+    }
+    return res;
+}
+
+inline std::size_t field_view_size_hint(
+    field_view fv,
+    string_view format_spec,
+    bool allow_specs,
+    const format_options& opts
+)
+{
+    auto kind = fv.kind();
+
+    // Invalid specifiers make formatting fail, so anything is valid here
+    if (allow_specs && kind == field_kind::string && format_spec.size() == 1u)
+    {
+        auto str = fv.get_string();
+        switch (format_spec[0])
+        {
+        case 'i': return escaped_string_size_hint(str, opts, '`');
+        case 'r': return str.size();
+        default: return 0u;
+        }
+    }
+    else if (!format_spec.empty())
+    {
+        return 0u;
+    }
+
+    switch (kind)
+    {
+    case field_kind::null: return 4u;
+    case field_kind::int64:
+    case field_kind::uint64: return 20u;  // -9223372036854775808 and 18446744073709551615
+    case field_kind::float_:
+    case field_kind::double_: return 24u;  // sign, max_digits10 digits, radix point, e+ and 3 exponent digits
+    case field_kind::string: return escaped_string_size_hint(fv.get_string(), opts, '\'');
+    case field_kind::blob: return fv.get_blob().size() * 2u + 3u;  // x'' and two hex digits per byte
+    // Quotes plus the worst-case outputs of date_to_string, datetime_to_string and time_to_string
+    case field_kind::date: return 16u;
+    case field_kind::datetime: return 39u;
+    case field_kind::time: return 36u;
+    default: BOOST_ASSERT(false); return 0u;  // LCOV_EXCL_LINE
+    }
+}
+
 // Helpers for parsing format strings
 inline bool is_number(char c) { return c >= '0' && c <= '9'; }
 
@@ -519,6 +594,38 @@ public:
         // Dump any remaining SQL
         ctx_.impl_.output.append({cur_begin, end});
     }
+
+    void format(compiled_format_ref format_str)
+    {
+        // Validating the encoding requires the current character set. ASCII is valid in all of them
+        if (format_str.has_non_ascii)
+        {
+            format(format_str.format_str);
+            return;
+        }
+
+        // The format string was validated when compiled, so only argument errors may happen here
+        const char* base = format_str.format_str.data();
+        for (const auto& step : format_str.steps)
+        {
+            string_view spec(base + step.spec_first, step.spec_size);
+            switch (step.kind)
+            {
+            case compiled_format_step::kind_t::literal:
+                ctx_.impl_.output.append({base + step.first, step.size});
+                break;
+            case compiled_format_step::kind_t::indexed_arg:
+                if (!do_indexed_field(static_cast<int>(step.arg_index), spec))
+                    return;
+                break;
+            case compiled_format_step::kind_t::named_arg:
+                if (!append_named_field({base + step.first, step.size}, spec))
+                    return;
+                break;
+            default: BOOST_ASSERT(false); return;  // LCOV_EXCL_LINE
+            }
+        }
+    }
 };
 
 }  // namespace detail
@@ -530,11 +637,25 @@ void boost::mysql::format_context_base::format_arg(detail::formattable_ref_impl
     switch (arg.type)
     {
     case detail::formattable_ref_impl::type_t::field:
-        detail::append_field_view(arg.data.fv, format_spec, false, *this);
-        break;
     case detail::formattable_ref_impl::type_t::field_with_specs:
-        detail::append_field_view(arg.data.fv, format_spec, true, *this);
+    {
+        bool allow_specs = arg.type == detail::formattable_ref_impl::type_t::field_with_specs;
+        if (impl_.size_counter)
+        {
+            // Sizing pass: measure the field without formatting it
+            impl_.size_counter->size += detail::field_view_size_hint(
+                arg.data.fv,
+                format_spec,
+                allow_specs,
+                impl_.opts
+            );
+        }
+        else
+        {
+            detail::append_field_view(arg.data.fv, format_spec, allow_specs, *this);
+        }
         break;
+    }
     case detail::formattable_ref_impl::type_t::fn_and_ptr:
         if (!arg.data.custom.format_fn(arg.data.custom.obj, format_spec.begin(), format_spec.end(), *this))
         {
@@ -554,6 +675,71 @@ void boost::mysql::detail::vformat_sql_to(
     detail::format_state(ctx, args).format(format_str.get());
 }
 
+void boost::mysql::detail::vformat_sql_to(
+    format_context_base& ctx,
+    compiled_format_ref format_str,
+    span<const format_arg> args
+)
+{
+    detail::format_state(ctx, args).format(format_str);
+}
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Runs a sizing pass. Formatters see a regular context, but its output only counts bytes,
+// and built-in types are measured instead of formatted
+template <class FormatString>
+std::size_t format_size_hint_impl(format_options opts, FormatString format_str, span<const format_arg> args)
+{
+    format_size_counter counter;
+    auto ctx = access::construct<format_context_base>(output_string_ref::create(counter), opts);
+    access::get_impl(ctx).size_counter = &counter;
+    format_state(ctx, args).format(format_str);
+    return counter.size;
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+std::size_t boost::mysql::detail::vformat_sql_size_hint(
+    format_options opts,
+    constant_string_view format_str,
+    span<const format_arg> args
+)
+{
+    return detail::format_size_hint_impl(opts, format_str.get(), args);
+}
+
+std::size_t boost::mysql::detail::vformat_sql_size_hint(
+    format_options opts,
+    compiled_format_ref format_str,
+    span<const format_arg> args
+)
+{
+    return detail::format_size_hint_impl(opts, format_str, args);
+}
+
+std::size_t boost::mysql::detail::estimate_formatted_size(
+    format_options opts,
+    string_view format_str,
+    span<const format_arg> args
+)
+{
+    // Replacement fields are counted as literals, and each argument is counted once.
+    // Custom formatters and ranges can't be measured without invoking them, so they count as zero
+    std::size_t res = format_str.size();
+    for (const auto& arg : args)
+    {
+        const auto& impl = access::get_impl(arg).value;
+        if (impl.type != formattable_ref_impl::type_t::fn_and_ptr)
+            res += detail::field_view_size_hint(impl.data.fv, string_view(), false, opts);
+    }
+    return res;
+}
+
 std::string boost::mysql::format_sql(
     format_options opts,
     constant_string_view format_str,
@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_GTID_SET_IPP
+#define BOOST_MYSQL_IMPL_GTID_SET_IPP
+
+#pragma once
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline int gtid_hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    else if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    else
+        return -1;
+}
+
+inline bool gtid_source_id_less(const gtid_source_id& lhs, const gtid_source_id& rhs)
+{
+    return std::memcmp(lhs.data(), rhs.data(), lhs.size()) < 0;
+}
+
+// A simple recursive-descent parser for GTID sets. Grammar:
+//   gtid_set := [ source *( ',' source ) ]
+//   source   := uuid 1*( ':' interval )
+//   interval := number [ '-' number ]
+class gtid_set_parser
+{
+    const char* it_;
+    const char* end_;
+
+    void skip_ws()
+    {
+        while (it_ != end_ && (*it_ == ' ' || *it_ == '\t' || *it_ == '\n' || *it_ == '\r'))
+            ++it_;
+    }
+
+    bool consume(char c)
+    {
+        skip_ws();
+        if (it_ != end_ && *it_ == c)
+        {
+            ++it_;
+            return true;
+        }
+        return false;
+    }
+
+    // UUIDs may contain dashes at the canonical positions (8-4-4-4-12), or no dashes at all
+    bool parse_uuid(gtid_source_id& output)
+    {
+        skip_ws();
+        std::size_t num_digits = 0u;
+        while (num_digits < 32u)
+        {
+            if (it_ == end_)
+                return false;
+            bool dash_allowed = num_digits == 8u || num_digits == 12u || num_digits == 16u ||
+                                num_digits == 20u;
+            if (*it_ == '-' && dash_allowed && it_[-1] != '-')
+            {
+                ++it_;
+                continue;
+            }
+            int hi = gtid_hex_digit_value(*it_++);
+            if (hi == -1 || it_ == end_)
+                return false;
+            int lo = gtid_hex_digit_value(*it_++);
+            if (lo == -1)
+                return false;
+            output[num_digits / 2u] = static_cast<std::uint8_t>(hi * 16 + lo);
+            num_digits += 2u;
+        }
+        return true;
+    }
+
+    bool parse_number(std::uint64_t& output)
+    {
+        skip_ws();
+        if (it_ == end_ || *it_ < '0' || *it_ > '9')
+            return false;
+        std::uint64_t res = 0u;
+        while (it_ != end_ && *it_ >= '0' && *it_ <= '9')
+        {
+            auto digit = static_cast<std::uint64_t>(*it_ - '0');
+            if (res > (UINT64_MAX - digit) / 10u)
+                return false;  // overflow
+            res = res * 10u + digit;
+            ++it_;
+        }
+        output = res;
+        return true;
+    }
+
+public:
+    gtid_set_parser(string_view input) noexcept : it_(input.data()), end_(input.data() + input.size()) {}
+
+    bool parse(gtid_set& output)
+    {
+        skip_ws();
+        if (it_ == end_)
+            return true;  // empty set
+
+        do
+        {
+            gtid_source_id id{};
+            if (!parse_uuid(id))
+                return false;
+            if (!consume(':'))
+                return false;
+            do
+            {
+                std::uint64_t first = 0u, last = 0u;
+                if (!parse_number(first) || first == 0u)
+                    return false;
+                last = first;
+                if (consume('-') && (!parse_number(last) || last < first))
+                    return false;
+                if (last == UINT64_MAX)
+                    return false;  // not representable as an exclusive upper bound
+                output.add(id, first, last);
+            } while (consume(':'));
+        } while (consume(','));
+
+        skip_ws();
+        return it_ == end_;
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+void boost::mysql::gtid_set::add(const gtid_source_id& source_id, std::uint64_t first, std::uint64_t last)
+{
+    BOOST_ASSERT(first <= last);
+    if (last == UINT64_MAX)
+        BOOST_THROW_EXCEPTION(std::invalid_argument("gtid_set::add: transaction ID out of range"));
+
+    // Find the entry for this source, creating it if required
+    auto source_it = std::lower_bound(
+        impl_.begin(),
+        impl_.end(),
+        source_id,
+        [](const source_entry& entry, const gtid_source_id& id) {
+            return detail::gtid_source_id_less(entry.id, id);
+        }
+    );
+    if (source_it == impl_.end() || source_it->id != source_id)
+    {
+        impl_.insert(source_it, source_entry{source_id, {interval{first, last}}});
+        return;
+    }
+    auto& ivs = source_it->intervals;
+
+    // Find the first interval that overlaps or is adjacent to [first, last]
+    auto merge_first = std::lower_bound(
+        ivs.begin(),
+        ivs.end(),
+        first,
+        [](const interval& iv, std::uint64_t value) { return iv.last < value && iv.last + 1u < value; }
+    );
+
+    // Find the end of the range of intervals to be merged
+    auto merge_last = merge_first;
+    while (merge_last != ivs.end() && (merge_last->first <= last || merge_last->first - 1u == last))
+        ++merge_last;
+
+    if (merge_first == merge_last)
+    {
+        // Nothing to merge with
+        ivs.insert(merge_first, interval{first, last});
+    }
+    else
+    {
+        // Collapse the range into its first interval
+        merge_first->first = (std::min)(merge_first->first, first);
+        merge_first->last = (std::max)((merge_last - 1)->last, last);
+        ivs.erase(merge_first + 1, merge_last);
+    }
+}
+
+bool boost::mysql::gtid_set::contains(const gtid_source_id& source_id, std::uint64_t transaction_id)
+    const noexcept
+{
+    auto source_it = std::lower_bound(
+        impl_.begin(),
+        impl_.end(),
+        source_id,
+        [](const source_entry& entry, const gtid_source_id& id) {
+            return detail::gtid_source_id_less(entry.id, id);
+        }
+    );
+    if (source_it == impl_.end() || source_it->id != source_id)
+        return false;
+    const auto& ivs = source_it->intervals;
+    auto it = std::lower_bound(
+        ivs.begin(),
+        ivs.end(),
+        transaction_id,
+        [](const interval& iv, std::uint64_t value) { return iv.last < value; }
+    );
+    return it != ivs.end() && it->first <= transaction_id;
+}
+
+std::string boost::mysql::gtid_set::to_string() const
+{
+    constexpr const char* hex_digits = "0123456789abcdef";
+    std::string res;
+    for (const auto& entry : impl_)
+    {
+        if (!res.empty())
+            res.push_back(',');
+        for (std::size_t i = 0; i < entry.id.size(); ++i)
+        {
+            if (i == 4u || i == 6u || i == 8u || i == 10u)
+                res.push_back('-');
+            res.push_back(hex_digits[entry.id[i] >> 4]);
+            res.push_back(hex_digits[entry.id[i] & 0x0f]);
+        }
+        for (const auto& iv : entry.intervals)
+        {
+            res.push_back(':');
+            res += std::to_string(iv.first);
+            if (iv.last != iv.first)
+            {
+                res.push_back('-');
+                res += std::to_string(iv.last);
+            }
+        }
+    }
+    return res;
+}
+
+boost::system::result<boost::mysql::gtid_set> boost::mysql::gtid_set::parse(string_view input)
+{
+    gtid_set res;
+    if (!detail::gtid_set_parser(input).parse(res))
+        return error_code(client_errc::invalid_gtid_set);
+    return res;
+}
+
+bool boost::mysql::gtid_set::operator==(const gtid_set& rhs) const noexcept
+{
+    if (impl_.size() != rhs.impl_.size())
+        return false;
+    for (std::size_t i = 0; i < impl_.size(); ++i)
+    {
+        const auto& lhs_entry = impl_[i];
+        const auto& rhs_entry = rhs.impl_[i];
+        if (lhs_entry.id != rhs_entry.id || lhs_entry.intervals.size() != rhs_entry.intervals.size())
+            return false;
+        for (std::size_t j = 0; j < lhs_entry.intervals.size(); ++j)
+        {
+            if (lhs_entry.intervals[j].first != rhs_entry.intervals[j].first ||
+                lhs_entry.intervals[j].last != rhs_entry.intervals[j].last)
+                return false;
+        }
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_BULK_INSERT_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_BULK_INSERT_HPP
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/bulk_insert.hpp>
+#include <boost/mysql/detail/pipeline.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/mysql/impl/internal/protocol/frame_header.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Splits the rows supplied by a row source into INSERT statements, writing them
+// to a pipeline request. Each statement is made of the supplied prefix followed by as many
+// rows as fit in max_statement_size. A pipeline request is filled with statements
+// until it reaches max_pipeline_size, so memory usage is bounded.
+// Statements are serialized directly, without copying them into intermediate strings.
+// Every statement is limited to a single frame, so headers can be written in-place.
+class bulk_insert_builder
+{
+    std::string prefix_;
+    std::size_t max_statement_size_;
+    std::size_t max_pipeline_size_;
+    bulk_insert_row_source* rows_;
+    std::string row_;           // the last row that was formatted
+    bool row_pending_{false};   // if true, row_ contains a row that hasn't been written yet
+    bool exhausted_{false};     // if true, there are no more rows
+    std::size_t rows_written_{0};
+
+    // Makes row_ contain the next row to write, if any
+    error_code next_row(format_options opts, bool& has_row)
+    {
+        if (row_pending_ || exhausted_)
+        {
+            has_row = row_pending_;
+            return error_code();
+        }
+
+        // Re-use the row's memory
+        format_context ctx(opts, std::move(row_));
+        exhausted_ = !rows_->format_next(ctx);
+        auto res = std::move(ctx).get();
+        if (res.has_error())
+            return res.error();
+        row_ = std::move(*res);
+        row_pending_ = !exhausted_;
+        has_row = row_pending_;
+        return error_code();
+    }
+
+    static void append(std::vector<std::uint8_t>& buff, string_view data)
+    {
+        buff.insert(buff.end(), data.begin(), data.end());
+    }
+
+    // Writes a single statement to buff, with as many rows as possible
+    error_code write_statement(std::vector<std::uint8_t>& buff, format_options opts)
+    {
+        // Space for the frame header, the command byte and the prefix
+        std::size_t header_offset = buff.size();
+        buff.resize(header_offset + frame_header_size);
+        buff.push_back(0x03);
+        append(buff, prefix_);
+
+        // Rows
+        std::size_t num_rows = 0;
+        bool has_row = true;
+        while (has_row)
+        {
+            // Check whether the row fits into this statement
+            std::size_t stmt_size = buff.size() - header_offset - frame_header_size;
+            std::size_t row_size = row_.size() + (num_rows ? 2u : 0u);
+            if (stmt_size + row_size > max_statement_size_)
+            {
+                if (num_rows == 0u)
+                {
+                    // Not even a single row fits. Leave the buffer as it was
+                    buff.resize(header_offset);
+                    return client_errc::bulk_insert_row_too_large;
+                }
+                break;
+            }
+
+            // Write it
+            if (num_rows)
+                append(buff, ", ");
+            append(buff, row_);
+            row_pending_ = false;
+            ++num_rows;
+
+            // Get the next one
+            auto ec = next_row(opts, has_row);
+            if (ec)
+                return ec;
+        }
+        rows_written_ += num_rows;
+
+        // Frame header
+        auto payload_size = static_cast<std::uint32_t>(buff.size() - header_offset - frame_header_size);
+        serialize_frame_header(
+            span<std::uint8_t, frame_header_size>(buff.data() + header_offset, frame_header_size),
+            frame_header{payload_size, 0}
+        );
+        return error_code();
+    }
+
+public:
+    bulk_insert_builder(
+        string_view prefix,
+        bulk_insert_row_source& rows,
+        std::size_t max_statement_size,
+        std::size_t max_pipeline_size
+    )
+        : prefix_(prefix),
+          // A payload of exactly max_packet_size bytes would require an extra, empty frame
+          max_statement_size_((std::min)(max_statement_size, max_packet_size - 1u)),
+          max_pipeline_size_(max_pipeline_size),
+          rows_(&rows)
+    {
+    }
+
+    // Have all rows been written?
+    bool done() const noexcept { return exhausted_ && !row_pending_; }
+
+    // The number of rows written to pipeline requests so far
+    std::size_t rows_written() const noexcept { return rows_written_; }
+
+    // Clears req and writes as many statements as fit into it.
+    // If an error is returned, req should not be used
+    error_code fill(pipeline_request& req, format_options opts)
+    {
+        req.clear();
+        auto& impl = access::get_impl(req);
+
+        while (impl.buffer_.size() < max_pipeline_size_ || impl.stages_.empty())
+        {
+            // Do we have more rows?
+            bool has_row = false;
+            auto ec = next_row(opts, has_row);
+            if (ec)
+                return ec;
+            if (!has_row)
+                break;
+
+            // Write a statement
+            ec = write_statement(impl.buffer_, opts);
+            if (ec)
+                return ec;
+            impl.stages_.push_back({pipeline_stage_kind::execute, 1, resultset_encoding::text});
+        }
+
+        return error_code();
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif  // BOOST_MYSQL_CXX14
+
+#endif
@@ -10,62 +10,49 @@
 
 #include <boost/mysql/time.hpp>
 
-#include <boost/assert.hpp>
-#include <boost/charconv/to_chars.hpp>
+#include <boost/mysql/impl/internal/int_to_string.hpp>
+
 #include <boost/core/span.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <system_error>
 #include <type_traits>
 
-// gcc-11+ issues spurious warnings about to_chars
-#if BOOST_GCC >= 70000
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstringop-overflow"
-#endif
-
 namespace boost {
 namespace mysql {
 namespace detail {
 
-// Helpers
-template <class IntType>
-inline char* call_to_chars(char* begin, char* end, IntType value) noexcept
-{
-    auto r = charconv::to_chars(begin, end, value);
-    BOOST_ASSERT(r.ec == std::errc());
-    return r.ptr;
-}
-
-template <class UnsignedInt>
-inline char* write_pad2(char* begin, char* end, UnsignedInt value) noexcept
+// Helpers. Values in the ranges allowed by MySQL are written using fixed-width
+// digit pair writes. Out-of-range values (e.g. invalid dates) are written in full, without padding
+inline char* write_pad2(char* begin, std::uint64_t value) noexcept
 {
-    static_assert(std::is_unsigned<UnsignedInt>::value, "");
-    if (value < 10u)
-        *begin++ = '0';
-    return call_to_chars(begin, end, value);
+    if (value < 100u)
+    {
+        write_2digits(begin, static_cast<std::uint32_t>(value));
+        return begin + 2;
+    }
+    return write_int(begin, value);
 }
 
-inline char* write_pad4(char* begin, char* end, unsigned long value) noexcept
+inline char* write_pad4(char* begin, std::uint64_t value) noexcept
 {
-    for (auto l : {1000u, 100u, 10u})
+    if (value < 10000u)
     {
-        if (value < l)
-            *begin++ = '0';
+        write_4digits(begin, static_cast<std::uint32_t>(value));
+        return begin + 4;
     }
-    return call_to_chars(begin, end, value);
+    return write_int(begin, value);
 }
 
-inline char* write_pad6(char* begin, char* end, unsigned long value) noexcept
+inline char* write_pad6(char* begin, std::uint64_t value) noexcept
 {
-    for (auto l : {100000u, 10000u, 1000u, 100u, 10u})
+    if (value < 1000000u)
     {
-        if (value < l)
-            *begin++ = '0';
+        write_6digits(begin, static_cast<std::uint32_t>(value));
+        return begin + 6;
     }
-    return call_to_chars(begin, end, value);
+    return write_int(begin, value);
 }
 
 inline std::size_t date_to_string(
@@ -77,20 +64,19 @@ inline std::size_t date_to_string(
 {
     // Worst-case output is 14 chars, extra space just in case
 
-    // Iterators
+    // Iterator
     char* it = output.data();
-    char* end = it + output.size();
 
     // Year
-    it = write_pad4(it, end, year);
+    it = write_pad4(it, year);
 
     // Month
     *it++ = '-';
-    it = write_pad2(it, end, static_cast<unsigned long>(month));
+    it = write_pad2(it, month);
 
     // Day
     *it++ = '-';
-    it = write_pad2(it, end, static_cast<unsigned long>(day));
+    it = write_pad2(it, day);
 
     // Done
     return it - output.data();
@@ -109,28 +95,27 @@ inline std::size_t datetime_to_string(
 {
     // Worst-case output is 37 chars, extra space just in case
 
-    // Iterators
+    // Iterator
     char* it = output.data();
-    char* end = it + output.size();
 
     // Date
     it += date_to_string(year, month, day, span<char, 32>(it, 32));
 
     // Hour
     *it++ = ' ';
-    it = write_pad2(it, end, static_cast<unsigned long>(hour));
+    it = write_pad2(it, hour);
 
     // Minutes
     *it++ = ':';
-    it = write_pad2(it, end, static_cast<unsigned long>(minute));
+    it = write_pad2(it, minute);
 
     // Seconds
     *it++ = ':';
-    it = write_pad2(it, end, static_cast<unsigned long>(second));
+    it = write_pad2(it, second);
 
     // Microseconds
     *it++ = '.';
-    it = write_pad6(it, end, microsecond);
+    it = write_pad6(it, microsecond);
 
     // Done
     return it - output.data();
@@ -158,28 +143,30 @@ inline std::size_t time_to_string(::boost::mysql::time value, span<char, 64> out
 
     auto num_hours = total_count;
 
-    // Iterators
+    // Iterator
     char* it = output.data();
-    char* end = it + output.size();
 
     // Sign
     if (value.count() < 0)
         *it++ = '-';
 
     // Hours
-    it = write_pad2(it, end, num_hours);  // type is unspecified
+    it = write_pad2(it, num_hours);  // type is unspecified
 
-    // Minutes
+    // Minutes. Minutes, seconds and microseconds are always in range
     *it++ = ':';
-    it = write_pad2(it, end, static_cast<unsigned long>(num_mins));
+    write_2digits(it, static_cast<std::uint32_t>(num_mins));
+    it += 2;
 
     // Seconds
     *it++ = ':';
-    it = write_pad2(it, end, static_cast<unsigned long>(num_secs));
+    write_2digits(it, static_cast<std::uint32_t>(num_secs));
+    it += 2;
 
     // Microseconds
     *it++ = '.';
-    it = write_pad6(it, end, static_cast<unsigned long>(num_micros));
+    write_6digits(it, static_cast<std::uint32_t>(num_micros));
+    it += 6;
 
     // Done
     return it - output.data();
@@ -189,8 +176,4 @@ inline std::size_t time_to_string(::boost::mysql::time value, span<char, 64> out
 }  // namespace mysql
 }  // namespace boost
 
-#if BOOST_GCC >= 110000
-#pragma GCC diagnostic pop
-#endif
-
 #endif
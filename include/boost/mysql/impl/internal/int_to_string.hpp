@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_INT_TO_STRING_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_INT_TO_STRING_HPP
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Integer serialization routines used by format_sql and the date/time to string functions.
+// Digits are written two at a time, using a lookup table with the 100 possible digit pairs.
+// Callers are responsible for providing buffers that are big enough.
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// The decimal representation of 0-99, as pairs of characters
+inline const char* digit_pairs() noexcept
+{
+    static constexpr char table[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    return table;
+}
+
+// Writes exactly 2 digits. value must be < 100
+inline void write_2digits(char* to, std::uint32_t value) noexcept
+{
+    BOOST_ASSERT(value < 100u);
+    std::memcpy(to, digit_pairs() + 2u * value, 2);
+}
+
+// Writes exactly 4 digits. value must be < 10000
+inline void write_4digits(char* to, std::uint32_t value) noexcept
+{
+    BOOST_ASSERT(value < 10000u);
+    write_2digits(to, value / 100u);
+    write_2digits(to + 2, value % 100u);
+}
+
+// Writes exactly 6 digits. value must be < 1000000
+inline void write_6digits(char* to, std::uint32_t value) noexcept
+{
+    BOOST_ASSERT(value < 1000000u);
+    write_2digits(to, value / 10000u);
+    write_4digits(to + 2, value % 10000u);
+}
+
+// The number of decimal digits required to represent value
+inline std::size_t count_digits(std::uint64_t value) noexcept
+{
+    std::size_t res = 1u;
+    while (true)
+    {
+        if (value < 10u)
+            return res;
+        if (value < 100u)
+            return res + 1u;
+        if (value < 1000u)
+            return res + 2u;
+        if (value < 10000u)
+            return res + 3u;
+        value /= 10000u;
+        res += 4u;
+    }
+}
+
+// Writes an integer without padding. Requires 20 bytes of space, at most.
+// Returns a pointer past the last written character
+inline char* write_int(char* to, std::uint64_t value) noexcept
+{
+    char* const end = to + count_digits(value);
+    char* it = end;
+
+    // Digits are written from the end, two at a time
+    while (value >= 100u)
+    {
+        it -= 2;
+        write_2digits(it, static_cast<std::uint32_t>(value % 100u));
+        value /= 100u;
+    }
+
+    // Remaining 1 or 2 digits
+    if (value >= 10u)
+        write_2digits(to, static_cast<std::uint32_t>(value));
+    else
+        *to = static_cast<char>('0' + value);
+
+    return end;
+}
+
+// Same as the above, for signed integers. Requires 20 bytes of space, at most
+inline char* write_int(char* to, std::int64_t value) noexcept
+{
+    // Negating the minimum value as a signed integer is UB
+    if (value < 0)
+    {
+        *to++ = '-';
+        return write_int(to, static_cast<std::uint64_t>(0u - static_cast<std::uint64_t>(value)));
+    }
+    return write_int(to, static_cast<std::uint64_t>(value));
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,275 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_PIPELINE_BATCHER_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_PIPELINE_BATCHER_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/is_fatal_error.hpp>
+#include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/pipeline_batcher.hpp>
+#include <boost/mysql/results.hpp>
+
+#include <boost/mysql/impl/internal/coroutine.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/assert.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+class pipeline_batcher_impl : public std::enable_shared_from_this<pipeline_batcher_impl>
+{
+    // A submitted request, waiting for its batch to complete
+    struct pending_op
+    {
+        results* result;
+        diagnostics* diag;
+        asio::any_completion_handler<void(error_code)> handler;
+    };
+
+    // A group of requests to be sent together
+    struct batch
+    {
+        pipeline_request req;
+        std::vector<pending_op> ops;
+    };
+
+    any_connection* conn_;
+    pipeline_batcher_params params_;
+    std::deque<batch> pending_;  // batches waiting to be sent. Only the last one may grow
+    batch in_flight_;            // batch being executed
+    std::vector<stage_response> responses_;
+    diagnostics run_diag_;
+    asio::steady_timer timer_;  // used as a condition variable while idle, and to implement the batch window
+    bool running_{false};
+    bool cancelled_{false};
+
+    // Completes an operation, through its associated executor
+    void complete_op(pending_op& op, error_code ec)
+    {
+        asio::post(conn_->get_executor(), asio::append(std::move(op.handler), ec));
+    }
+
+    void fail_pending(error_code ec)
+    {
+        for (auto& b : pending_)
+        {
+            for (auto& op : b.ops)
+                complete_op(op, ec);
+        }
+        pending_.clear();
+    }
+
+    void complete_in_flight(error_code pipeline_ec)
+    {
+        for (std::size_t i = 0; i < in_flight_.ops.size(); ++i)
+        {
+            auto& op = in_flight_.ops[i];
+            if (i >= responses_.size())
+            {
+                // The pipeline failed before it could populate responses
+                *op.diag = run_diag_;
+                complete_op(op, pipeline_ec);
+                continue;
+            }
+
+            auto& resp = responses_[i];
+            error_code ec;
+            if (resp.has_results())
+            {
+                *op.result = std::move(resp).get_results();
+            }
+            else
+            {
+                ec = resp.error();
+                *op.diag = std::move(resp).diag();
+            }
+            complete_op(op, ec);
+        }
+        in_flight_.ops.clear();
+    }
+
+    bool front_batch_full() const { return pending_.front().ops.size() >= params_.max_batch_size; }
+
+    struct run_op
+    {
+        int resume_point_{0};
+        std::shared_ptr<pipeline_batcher_impl> obj_;
+        error_code fatal_ec_;
+
+        run_op(std::shared_ptr<pipeline_batcher_impl> obj) noexcept : obj_(std::move(obj)) {}
+
+        template <class Self>
+        void operator()(Self& self, error_code ec = {})
+        {
+            switch (resume_point_)
+            {
+            case 0:
+
+                BOOST_ASSERT(!obj_->running_);
+                obj_->running_ = true;
+                obj_->cancelled_ = false;
+
+                while (!obj_->cancelled_)
+                {
+                    // Wait for requests to arrive
+                    if (obj_->pending_.empty())
+                    {
+                        obj_->timer_.expires_at((std::chrono::steady_clock::time_point::max)());
+                        BOOST_MYSQL_YIELD(resume_point_, 1, obj_->timer_.async_wait(std::move(self)))
+                        continue;
+                    }
+
+                    // Give other tasks the chance to submit more requests
+                    if (obj_->params_.batch_window.count() > 0 && !obj_->front_batch_full())
+                    {
+                        obj_->timer_.expires_after(obj_->params_.batch_window);
+                        BOOST_MYSQL_YIELD(resume_point_, 2, obj_->timer_.async_wait(std::move(self)))
+                        if (obj_->cancelled_)
+                            break;
+                    }
+
+                    // Send the batch
+                    obj_->in_flight_ = std::move(obj_->pending_.front());
+                    obj_->pending_.pop_front();
+                    obj_->responses_.clear();
+                    BOOST_MYSQL_YIELD(
+                        resume_point_,
+                        3,
+                        obj_->conn_->async_run_pipeline(
+                            obj_->in_flight_.req,
+                            obj_->responses_,
+                            obj_->run_diag_,
+                            std::move(self)
+                        )
+                    )
+
+                    // Individual errors are reported to each submitter
+                    obj_->complete_in_flight(ec);
+
+                    // Fatal errors leave the connection unusable, so we can't continue
+                    if (ec && is_fatal_error(ec))
+                    {
+                        fatal_ec_ = ec;
+                        break;
+                    }
+                }
+
+                // Requests that haven't been sent yet won't be
+                obj_->fail_pending(fatal_ec_ ? fatal_ec_ : error_code(asio::error::operation_aborted));
+                obj_->running_ = false;
+                self.complete(fatal_ec_);
+            }
+        }
+    };
+
+    // Requests are appended to the last pending batch, unless it's full
+    batch& batch_for_new_request()
+    {
+        if (pending_.empty() || pending_.back().ops.size() >= params_.max_batch_size)
+            pending_.emplace_back();
+        return pending_.back();
+    }
+
+    void add_op(
+        batch& b,
+        results* result,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code)> handler
+    )
+    {
+        diag->clear();
+        b.ops.push_back(pending_op{result, diag, std::move(handler)});
+
+        // Wake the batcher if it was idle, or if the batch it's waiting for is full.
+        // If there is more than one pending batch, the first one is already full.
+        // Cancelling a timer without outstanding waits is a no-op.
+        if (pending_.size() == 1u && (b.ops.size() == 1u || front_batch_full()))
+            timer_.cancel();
+    }
+
+public:
+    pipeline_batcher_impl(any_connection& conn, const pipeline_batcher_params& params)
+        : conn_(&conn), params_(params), timer_(conn.get_executor())
+    {
+        BOOST_ASSERT(params.max_batch_size > 0u);
+    }
+
+    asio::any_io_executor get_executor() { return conn_->get_executor(); }
+
+    void async_run(asio::any_completion_handler<void(error_code)> handler)
+    {
+        asio::async_compose<asio::any_completion_handler<void(error_code)>, void(error_code)>(
+            run_op(shared_from_this()),
+            handler,
+            conn_->get_executor()
+        );
+    }
+
+    void add_query(
+        string_view query,
+        results* result,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code)> handler
+    )
+    {
+        auto& b = batch_for_new_request();
+        b.req.add_execute(query);
+        add_op(b, result, diag, std::move(handler));
+    }
+
+    void add_statement(
+        statement stmt,
+        span<const field_view> params,
+        results* result,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code)> handler
+    )
+    {
+        auto& b = batch_for_new_request();
+        // May throw. The batch is left untouched in this case,
+        // and an empty batch is reused by the next request
+        b.req.add_execute_range(stmt, params);
+        add_op(b, result, diag, std::move(handler));
+    }
+
+    void cancel()
+    {
+        if (running_)
+        {
+            cancelled_ = true;
+            timer_.cancel();
+        }
+        else
+        {
+            fail_pending(asio::error::operation_aborted);
+        }
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
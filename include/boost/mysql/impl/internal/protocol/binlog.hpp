@@ -0,0 +1,1290 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_PROTOCOL_BINLOG_HPP
+
+// Replication commands and binary log event decoding.
+// Reference: https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_replication.html
+
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/days.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/binlog_stream_impl.hpp>
+#include <boost/mysql/detail/datetime.hpp>
+#include <boost/mysql/detail/string_view_offset.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/binary_protocol.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/bit_deserialization.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/deserialization_context.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/protocol_field_type.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/protocol_types.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/serialization_context.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// COM_REGISTER_SLAVE. We don't report any host, user or password.
+struct register_replica_command
+{
+    std::uint32_t server_id;
+
+    void serialize(serialization_context& ctx) const
+    {
+        ctx.serialize_fixed(
+            int1{0x15},       // command
+            int4{server_id},  // server_id
+            int1{0},          // hostname length
+            int1{0},          // user length
+            int1{0},          // password length
+            int2{0},          // port
+            int4{0},          // replication rank (ignored)
+            int4{0}           // source ID (ignored)
+        );
+    }
+};
+
+// COM_BINLOG_DUMP_GTID
+BOOST_INLINE_CONSTEXPR std::uint16_t binlog_dump_non_block = 0x01;
+BOOST_INLINE_CONSTEXPR std::uint16_t binlog_through_position = 0x02;
+BOOST_INLINE_CONSTEXPR std::uint16_t binlog_through_gtid = 0x04;
+
+struct binlog_dump_gtid_command
+{
+    std::uint16_t flags;
+    std::uint32_t server_id;
+    string_view log_file;
+    std::uint64_t log_position;
+    const gtid_set* gtids;
+
+    inline void serialize(serialization_context& ctx) const;
+};
+
+// The common event header
+BOOST_INLINE_CONSTEXPR std::size_t binlog_event_header_size = 19u;
+BOOST_INLINE_CONSTEXPR std::size_t binlog_checksum_size = 4u;
+BOOST_INLINE_CONSTEXPR std::uint16_t binlog_artificial_event_flag = 0x20;
+BOOST_INLINE_CONSTEXPR std::uint8_t binlog_xa_prepare_event_type = 38u;
+
+// Decodes an event packet (without the leading 0x00 byte), updating the stream state.
+// The resulting event points into msg and into st
+BOOST_ATTRIBUTE_NODISCARD inline error_code deserialize_binlog_event(
+    span<const std::uint8_t> msg,
+    binlog_stream_impl& st,
+    binlog_event& output
+);
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+//
+// Implementations
+//
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Column types that only appear in the binary log
+namespace binlog_column_type {
+
+BOOST_INLINE_CONSTEXPR std::uint8_t timestamp2 = 0x11;
+BOOST_INLINE_CONSTEXPR std::uint8_t datetime2 = 0x12;
+BOOST_INLINE_CONSTEXPR std::uint8_t time2 = 0x13;
+
+}  // namespace binlog_column_type
+
+// Used only to detect checksums on events received before any format description event
+inline std::uint32_t binlog_crc32(const std::uint8_t* first, std::size_t size)
+{
+    std::uint32_t crc = 0xffffffffu;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc ^= first[i];
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+// Big-endian loads of arbitrary sizes, as used by the binlog temporal and decimal formats
+inline std::uint64_t binlog_load_big(const std::uint8_t* first, std::size_t size)
+{
+    BOOST_ASSERT(size <= 8u);
+    std::uint64_t res = 0u;
+    for (std::size_t i = 0; i < size; ++i)
+        res = (res << 8) | first[i];
+    return res;
+}
+
+inline std::uint64_t binlog_load_little(const std::uint8_t* first, std::size_t size)
+{
+    BOOST_ASSERT(size <= 8u);
+    std::uint64_t res = 0u;
+    for (std::size_t i = size; i > 0u; --i)
+        res = (res << 8) | first[i - 1];
+    return res;
+}
+
+inline bool binlog_bitmap_get(const std::uint8_t* bitmap, std::size_t pos)
+{
+    return bitmap[pos / 8u] & (1u << (pos % 8u));
+}
+
+// Fractional seconds are stored in (fsp + 1) / 2 big-endian bytes
+inline deserialize_errc deserialize_binlog_fsp(
+    deserialization_context& ctx,
+    std::uint16_t fsp,
+    std::uint32_t& micros
+)
+{
+    const std::size_t size = (fsp + 1u) / 2u;
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    auto value = static_cast<std::uint32_t>(binlog_load_big(ctx.first(), size));
+    ctx.advance(size);
+    switch (size)
+    {
+    case 0: micros = 0u; break;
+    case 1: micros = value * 10000u; break;
+    case 2: micros = value * 100u; break;
+    default: micros = value; break;
+    }
+    return micros > max_micro ? deserialize_errc::protocol_value_error : deserialize_errc::ok;
+}
+
+// Integers. Signedness is only known if the server sends the optional table map metadata.
+template <class UnsignedType, class SignedType>
+inline deserialize_errc deserialize_binlog_int(
+    deserialization_context& ctx,
+    bool is_unsigned,
+    field_view& output
+)
+{
+    return is_unsigned ? deserialize_binary_field_int_impl<std::uint64_t, UnsignedType>(ctx, output)
+                       : deserialize_binary_field_int_impl<std::int64_t, SignedType>(ctx, output);
+}
+
+inline deserialize_errc deserialize_binlog_int24(
+    deserialization_context& ctx,
+    bool is_unsigned,
+    field_view& output
+)
+{
+    int3 value{};
+    auto err = value.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (is_unsigned)
+    {
+        output = field_view(static_cast<std::uint64_t>(value.value));
+    }
+    else
+    {
+        // Sign-extend
+        auto v = static_cast<std::int64_t>(value.value);
+        output = field_view(v >= 0x800000 ? v - 0x1000000 : v);
+    }
+    return deserialize_errc::ok;
+}
+
+// DATE: 3 bytes, little endian, day | month << 5 | year << 9
+inline deserialize_errc deserialize_binlog_date(deserialization_context& ctx, field_view& output)
+{
+    int3 value{};
+    auto err = value.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if ((value.value >> 9) > max_year)
+        return deserialize_errc::protocol_value_error;
+    output = field_view(date(
+        static_cast<std::uint16_t>(value.value >> 9),
+        static_cast<std::uint8_t>((value.value >> 5) & 0x0f),
+        static_cast<std::uint8_t>(value.value & 0x1f)
+    ));
+    return deserialize_errc::ok;
+}
+
+inline deserialize_errc make_binlog_datetime(
+    std::uint64_t year,
+    std::uint64_t month,
+    std::uint64_t day,
+    std::uint64_t hour,
+    std::uint64_t minute,
+    std::uint64_t second,
+    std::uint32_t micros,
+    field_view& output
+)
+{
+    if (year > max_year || month > max_month || day > max_day || hour > max_hour || minute > max_min ||
+        second > max_sec)
+        return deserialize_errc::protocol_value_error;
+    output = field_view(datetime(
+        static_cast<std::uint16_t>(year),
+        static_cast<std::uint8_t>(month),
+        static_cast<std::uint8_t>(day),
+        static_cast<std::uint8_t>(hour),
+        static_cast<std::uint8_t>(minute),
+        static_cast<std::uint8_t>(second),
+        micros
+    ));
+    return deserialize_errc::ok;
+}
+
+// DATETIME2: 5 bytes big endian + fractional part
+//   1 bit sign (always 1), 17 bits year * 13 + month, 5 bits day, 5 bits hour, 6 bits minute, 6 bits second
+inline deserialize_errc deserialize_binlog_datetime2(
+    deserialization_context& ctx,
+    std::uint16_t fsp,
+    field_view& output
+)
+{
+    if (!ctx.enough_size(5u))
+        return deserialize_errc::incomplete_message;
+    std::uint64_t packed = binlog_load_big(ctx.first(), 5u) - 0x8000000000u;
+    ctx.advance(5u);
+    std::uint32_t micros = 0u;
+    auto err = deserialize_binlog_fsp(ctx, fsp, micros);
+    if (err != deserialize_errc::ok)
+        return err;
+    std::uint64_t ymd = packed >> 17;
+    std::uint64_t year_month = ymd >> 5;
+    std::uint64_t hms = packed & 0x1ffff;
+    return make_binlog_datetime(
+        year_month / 13u,
+        year_month % 13u,
+        ymd & 0x1f,
+        hms >> 12,
+        (hms >> 6) & 0x3f,
+        hms & 0x3f,
+        micros,
+        output
+    );
+}
+
+// Old DATETIME: 8 bytes little endian, as the decimal number YYYYMMDDhhmmss
+inline deserialize_errc deserialize_binlog_datetime(deserialization_context& ctx, field_view& output)
+{
+    int8 value{};
+    auto err = value.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    std::uint64_t ymd = value.value / 1000000u;
+    std::uint64_t hms = value.value % 1000000u;
+    return make_binlog_datetime(
+        ymd / 10000u,
+        (ymd / 100u) % 100u,
+        ymd % 100u,
+        hms / 10000u,
+        (hms / 100u) % 100u,
+        hms % 100u,
+        0u,
+        output
+    );
+}
+
+// TIMESTAMP values are stored as seconds since the epoch, in UTC
+inline deserialize_errc make_binlog_timestamp(std::uint32_t seconds, std::uint32_t micros, field_view& output)
+{
+    std::uint16_t year{};
+    std::uint8_t month{}, day{};
+    const std::uint32_t secs_per_day = 86400u;
+    std::uint32_t time_of_day = seconds % secs_per_day;
+    if (seconds == 0u && micros == 0u)
+    {
+        // Zero timestamp
+        output = field_view(datetime());
+        return deserialize_errc::ok;
+    }
+    if (!days_to_ymd(static_cast<int>(seconds / secs_per_day), year, month, day))
+        return deserialize_errc::protocol_value_error;
+    return make_binlog_datetime(
+        year,
+        month,
+        day,
+        time_of_day / 3600u,
+        (time_of_day / 60u) % 60u,
+        time_of_day % 60u,
+        micros,
+        output
+    );
+}
+
+// TIMESTAMP2: 4 bytes big endian + fractional part
+inline deserialize_errc deserialize_binlog_timestamp2(
+    deserialization_context& ctx,
+    std::uint16_t fsp,
+    field_view& output
+)
+{
+    if (!ctx.enough_size(4u))
+        return deserialize_errc::incomplete_message;
+    auto seconds = endian::load_big_u32(ctx.first());
+    ctx.advance(4u);
+    std::uint32_t micros = 0u;
+    auto err = deserialize_binlog_fsp(ctx, fsp, micros);
+    if (err != deserialize_errc::ok)
+        return err;
+    return make_binlog_timestamp(seconds, micros, output);
+}
+
+// Old TIMESTAMP: 4 bytes little endian
+inline deserialize_errc deserialize_binlog_timestamp(deserialization_context& ctx, field_view& output)
+{
+    int4 seconds{};
+    auto err = seconds.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    return make_binlog_timestamp(seconds.value, 0u, output);
+}
+
+inline deserialize_errc make_binlog_time(
+    bool negative,
+    std::uint64_t hours,
+    std::uint64_t minutes,
+    std::uint64_t seconds,
+    std::uint64_t micros,
+    field_view& output
+)
+{
+    if (hours > 838u || minutes > max_min || seconds > max_sec || micros > max_micro)
+        return deserialize_errc::protocol_value_error;
+    auto value = std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds) +
+                 std::chrono::microseconds(micros);
+    output = field_view(negative ? -value : value);
+    return deserialize_errc::ok;
+}
+
+// TIME2: 3 bytes big endian + fractional part.
+//   1 bit sign, 1 bit unused, 10 bits hour, 6 bits minute, 6 bits second.
+// Negative values are stored in two's complement, including the fractional part
+inline deserialize_errc deserialize_binlog_time2(
+    deserialization_context& ctx,
+    std::uint16_t fsp,
+    field_view& output
+)
+{
+    const std::size_t frac_size = (fsp + 1u) / 2u;
+    if (!ctx.enough_size(3u + frac_size))
+        return deserialize_errc::incomplete_message;
+
+    std::int64_t intpart = static_cast<std::int64_t>(binlog_load_big(ctx.first(), 3u)) - 0x800000;
+    std::int64_t packed = 0;  // hms << 24 + microseconds
+    switch (frac_size)
+    {
+    case 0: packed = intpart * (1 << 24); break;
+    case 1:
+    {
+        std::int64_t frac = static_cast<std::int8_t>(ctx.first()[3]);
+        if (intpart < 0 && frac)
+        {
+            ++intpart;
+            frac -= 0x100;
+        }
+        packed = intpart * (1 << 24) + frac * 10000;
+        break;
+    }
+    case 2:
+    {
+        std::int64_t frac = static_cast<std::int64_t>(binlog_load_big(ctx.first() + 3, 2u));
+        if (intpart < 0 && frac)
+        {
+            ++intpart;
+            frac -= 0x10000;
+        }
+        packed = intpart * (1 << 24) + frac * 100;
+        break;
+    }
+    default:
+        packed = static_cast<std::int64_t>(binlog_load_big(ctx.first(), 6u)) - 0x800000000000;
+        break;
+    }
+    ctx.advance(3u + frac_size);
+
+    bool negative = packed < 0;
+    std::uint64_t abs_packed = static_cast<std::uint64_t>(negative ? -packed : packed);
+    std::uint64_t hms = abs_packed >> 24;
+    return make_binlog_time(
+        negative,
+        (hms >> 12) & 0x3ff,
+        (hms >> 6) & 0x3f,
+        hms & 0x3f,
+        abs_packed & 0xffffff,
+        output
+    );
+}
+
+// Old TIME: 3 bytes little endian, as the signed decimal number hhmmss
+inline deserialize_errc deserialize_binlog_time(deserialization_context& ctx, field_view& output)
+{
+    int3 value{};
+    auto err = value.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    auto v = static_cast<std::int64_t>(value.value);
+    if (v >= 0x800000)
+        v -= 0x1000000;
+    bool negative = v < 0;
+    auto abs_v = static_cast<std::uint64_t>(negative ? -v : v);
+    return make_binlog_time(negative, abs_v / 10000u, (abs_v / 100u) % 100u, abs_v % 100u, 0u, output);
+}
+
+// Strings and blobs with a length prefix of 1 to 4 bytes. No copies are performed
+inline deserialize_errc deserialize_binlog_string(
+    deserialization_context& ctx,
+    std::size_t length_size,
+    bool is_blob,
+    field_view& output
+)
+{
+    if (length_size < 1u || length_size > 4u)
+        return deserialize_errc::protocol_value_error;
+    if (!ctx.enough_size(length_size))
+        return deserialize_errc::incomplete_message;
+    auto length = static_cast<std::size_t>(binlog_load_little(ctx.first(), length_size));
+    ctx.advance(length_size);
+    if (!ctx.enough_size(length))
+        return deserialize_errc::incomplete_message;
+    if (is_blob)
+        output = field_view(blob_view(ctx.first(), length));
+    else
+        output = field_view(ctx.get_string(length));
+    ctx.advance(length);
+    return deserialize_errc::ok;
+}
+
+// BIT: metadata contains the number of bits modulo 8 (low byte) and number of full bytes (high byte)
+inline deserialize_errc deserialize_binlog_bit(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    field_view& output
+)
+{
+    std::size_t size = (meta >> 8) + ((meta & 0xff) ? 1u : 0u);
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    auto err = deserialize_bit(ctx.get_string(size), output);
+    if (err != deserialize_errc::ok)
+        return err;
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
+// DECIMAL: a packed binary format, where every 9 decimal digits are stored in 4 bytes.
+// We decode it into its text representation, stored in the stream's decimal buffer.
+// The resulting field holds an offset into the buffer, since it may be reallocated while decoding the event.
+inline deserialize_errc deserialize_binlog_decimal(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    std::string& buffer,
+    field_view& output
+)
+{
+    constexpr std::size_t digits_per_group = 9u;
+    constexpr std::uint8_t dig2bytes[] = {0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
+
+    const std::size_t precision = meta & 0xff;
+    const std::size_t scale = meta >> 8;
+    if (precision == 0u || scale > precision)
+        return deserialize_errc::protocol_value_error;
+    const std::size_t intg = precision - scale;
+    const std::size_t intg0 = intg / digits_per_group, intg0x = intg % digits_per_group;
+    const std::size_t frac0 = scale / digits_per_group, frac0x = scale % digits_per_group;
+    const std::size_t size = intg0 * 4u + dig2bytes[intg0x] + frac0 * 4u + dig2bytes[frac0x];
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+
+    // Copy to a local buffer, so we can undo the sign transformations
+    std::array<std::uint8_t, 40> bytes{};
+    if (size > bytes.size())
+        return deserialize_errc::protocol_value_error;
+    std::memcpy(bytes.data(), ctx.first(), size);
+    ctx.advance(size);
+    const bool negative = !(bytes[0] & 0x80);
+    bytes[0] ^= 0x80;
+    if (negative)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<std::uint8_t>(~bytes[i]);
+    }
+
+    // Compose the text representation
+    const std::size_t offset = buffer.size();
+    const std::uint8_t* it = bytes.data();
+    auto read_group = [&it](std::size_t group_size) {
+        auto res = static_cast<std::uint32_t>(binlog_load_big(it, group_size));
+        it += group_size;
+        return res;
+    };
+    auto append_padded = [&buffer](std::uint32_t value, std::size_t num_digits) {
+        char digits[digits_per_group];
+        for (std::size_t i = num_digits; i > 0u; --i)
+        {
+            digits[i - 1] = static_cast<char>('0' + value % 10u);
+            value /= 10u;
+        }
+        buffer.append(digits, num_digits);
+    };
+
+    if (negative)
+        buffer.push_back('-');
+
+    // Integer part, skipping leading zeros
+    bool has_int_digits = false;
+    auto append_int_group = [&](std::uint32_t value, std::size_t num_digits) {
+        if (has_int_digits)
+        {
+            append_padded(value, num_digits);
+        }
+        else if (value != 0u)
+        {
+            // First non-zero group: don't pad
+            char digits[digits_per_group];
+            std::size_t n = 0;
+            while (value != 0u)
+            {
+                digits[digits_per_group - 1 - n++] = static_cast<char>('0' + value % 10u);
+                value /= 10u;
+            }
+            buffer.append(digits + digits_per_group - n, n);
+            has_int_digits = true;
+        }
+    };
+    if (intg0x)
+        append_int_group(read_group(dig2bytes[intg0x]), intg0x);
+    for (std::size_t i = 0; i < intg0; ++i)
+        append_int_group(read_group(4u), digits_per_group);
+    if (!has_int_digits)
+        buffer.push_back('0');
+
+    // Fractional part, with exactly scale digits
+    if (scale)
+    {
+        buffer.push_back('.');
+        for (std::size_t i = 0; i < frac0; ++i)
+            append_padded(read_group(4u), digits_per_group);
+        if (frac0x)
+            append_padded(read_group(dig2bytes[frac0x]), frac0x);
+    }
+
+    output = access::construct<field_view>(string_view_offset{offset, buffer.size() - offset}, false);
+    return deserialize_errc::ok;
+}
+
+// STRING columns: the metadata encodes the real type (string, enum or set)
+// and the maximum length. Lengths > 255 borrow two bits from the real type byte.
+inline deserialize_errc deserialize_binlog_string_column(
+    deserialization_context& ctx,
+    std::uint16_t meta,
+    field_view& output
+)
+{
+    std::uint8_t real_type = static_cast<std::uint8_t>(meta >> 8);
+    std::size_t max_length = meta & 0xff;
+    if ((real_type & 0x30) != 0x30)
+    {
+        max_length |= static_cast<std::size_t>((real_type & 0x30) ^ 0x30) << 4;
+        real_type |= 0x30;
+    }
+
+    if (real_type == static_cast<std::uint8_t>(protocol_field_type::enum_) ||
+        real_type == static_cast<std::uint8_t>(protocol_field_type::set))
+    {
+        // ENUMs are sent as their 1-based index; SETs, as a bitmask. max_length holds the size in bytes
+        if (max_length < 1u || max_length > 8u)
+            return deserialize_errc::protocol_value_error;
+        if (!ctx.enough_size(max_length))
+            return deserialize_errc::incomplete_message;
+        output = field_view(binlog_load_little(ctx.first(), max_length));
+        ctx.advance(max_length);
+        return deserialize_errc::ok;
+    }
+
+    return deserialize_binlog_string(ctx, max_length < 256u ? 1u : 2u, false, output);
+}
+
+// Decodes a single, non-NULL value
+inline deserialize_errc deserialize_binlog_value(
+    deserialization_context& ctx,
+    std::uint8_t type,
+    std::uint16_t meta,
+    bool is_unsigned,
+    std::string& decimal_buffer,
+    field_view& output
+)
+{
+    switch (type)
+    {
+    case static_cast<std::uint8_t>(protocol_field_type::tiny):
+        return deserialize_binlog_int<std::uint8_t, std::int8_t>(ctx, is_unsigned, output);
+    case static_cast<std::uint8_t>(protocol_field_type::short_):
+        return deserialize_binlog_int<std::uint16_t, std::int16_t>(ctx, is_unsigned, output);
+    case static_cast<std::uint8_t>(protocol_field_type::int24):
+        return deserialize_binlog_int24(ctx, is_unsigned, output);
+    case static_cast<std::uint8_t>(protocol_field_type::long_):
+        return deserialize_binlog_int<std::uint32_t, std::int32_t>(ctx, is_unsigned, output);
+    case static_cast<std::uint8_t>(protocol_field_type::longlong):
+        return deserialize_binlog_int<std::uint64_t, std::int64_t>(ctx, is_unsigned, output);
+    case static_cast<std::uint8_t>(protocol_field_type::float_):
+        return deserialize_binary_field_float<float>(ctx, output);
+    case static_cast<std::uint8_t>(protocol_field_type::double_):
+        return deserialize_binary_field_float<double>(ctx, output);
+    case static_cast<std::uint8_t>(protocol_field_type::year):
+    {
+        int1 value{};
+        auto err = value.deserialize(ctx);
+        if (err != deserialize_errc::ok)
+            return err;
+        output = field_view(static_cast<std::uint64_t>(value.value ? value.value + 1900u : 0u));
+        return deserialize_errc::ok;
+    }
+    case static_cast<std::uint8_t>(protocol_field_type::date): return deserialize_binlog_date(ctx, output);
+    case static_cast<std::uint8_t>(protocol_field_type::datetime):
+        return deserialize_binlog_datetime(ctx, output);
+    case static_cast<std::uint8_t>(protocol_field_type::timestamp):
+        return deserialize_binlog_timestamp(ctx, output);
+    case static_cast<std::uint8_t>(protocol_field_type::time): return deserialize_binlog_time(ctx, output);
+    case binlog_column_type::datetime2: return deserialize_binlog_datetime2(ctx, meta, output);
+    case binlog_column_type::timestamp2: return deserialize_binlog_timestamp2(ctx, meta, output);
+    case binlog_column_type::time2: return deserialize_binlog_time2(ctx, meta, output);
+    case static_cast<std::uint8_t>(protocol_field_type::varchar):
+    case static_cast<std::uint8_t>(protocol_field_type::var_string):
+        return deserialize_binlog_string(ctx, meta < 256u ? 1u : 2u, false, output);
+    case static_cast<std::uint8_t>(protocol_field_type::string):
+        return deserialize_binlog_string_column(ctx, meta, output);
+    case static_cast<std::uint8_t>(protocol_field_type::blob):
+    case static_cast<std::uint8_t>(protocol_field_type::json):
+    case static_cast<std::uint8_t>(protocol_field_type::geometry):
+        return deserialize_binlog_string(ctx, meta, true, output);
+    case static_cast<std::uint8_t>(protocol_field_type::bit):
+        return deserialize_binlog_bit(ctx, meta, output);
+    case static_cast<std::uint8_t>(protocol_field_type::newdecimal):
+        return deserialize_binlog_decimal(ctx, meta, decimal_buffer, output);
+    default: return deserialize_errc::protocol_value_error;
+    }
+}
+
+// Returns the number of metadata bytes used by each column type in TABLE_MAP events
+inline std::size_t binlog_column_meta_size(std::uint8_t type)
+{
+    switch (type)
+    {
+    case static_cast<std::uint8_t>(protocol_field_type::float_):
+    case static_cast<std::uint8_t>(protocol_field_type::double_):
+    case static_cast<std::uint8_t>(protocol_field_type::blob):
+    case static_cast<std::uint8_t>(protocol_field_type::json):
+    case static_cast<std::uint8_t>(protocol_field_type::geometry):
+    case binlog_column_type::timestamp2:
+    case binlog_column_type::datetime2:
+    case binlog_column_type::time2: return 1u;
+    case static_cast<std::uint8_t>(protocol_field_type::varchar):
+    case static_cast<std::uint8_t>(protocol_field_type::var_string):
+    case static_cast<std::uint8_t>(protocol_field_type::bit):
+    case static_cast<std::uint8_t>(protocol_field_type::newdecimal):
+    case static_cast<std::uint8_t>(protocol_field_type::string):
+    case static_cast<std::uint8_t>(protocol_field_type::enum_):
+    case static_cast<std::uint8_t>(protocol_field_type::set): return 2u;
+    default: return 0u;
+    }
+}
+
+inline bool binlog_is_numeric_column(std::uint8_t type)
+{
+    switch (type)
+    {
+    case static_cast<std::uint8_t>(protocol_field_type::tiny):
+    case static_cast<std::uint8_t>(protocol_field_type::short_):
+    case static_cast<std::uint8_t>(protocol_field_type::int24):
+    case static_cast<std::uint8_t>(protocol_field_type::long_):
+    case static_cast<std::uint8_t>(protocol_field_type::longlong):
+    case static_cast<std::uint8_t>(protocol_field_type::float_):
+    case static_cast<std::uint8_t>(protocol_field_type::double_):
+    case static_cast<std::uint8_t>(protocol_field_type::newdecimal): return true;
+    default: return false;
+    }
+}
+
+// A length-prefixed, null-terminated string, as used for database and table names
+inline deserialize_errc deserialize_binlog_name(deserialization_context& ctx, string_view& output)
+{
+    int1 length{};
+    auto err = length.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (!ctx.enough_size(length.value + 1u))
+        return deserialize_errc::incomplete_message;
+    output = ctx.get_string(length.value);
+    ctx.advance(length.value + 1u);  // skip the null terminator
+    return deserialize_errc::ok;
+}
+
+// TABLE_MAP
+inline deserialize_errc deserialize_table_map_event(
+    deserialization_context& ctx,
+    binlog_stream_impl& st,
+    binlog_event& output
+)
+{
+    // Post-header
+    if (!ctx.enough_size(8u))
+        return deserialize_errc::incomplete_message;
+    std::uint64_t table_id = binlog_load_little(ctx.first(), 6u);
+    ctx.advance(8u);  // table ID + flags
+
+    // Names
+    string_view db, table;
+    auto err = deserialize_binlog_name(ctx, db);
+    if (err != deserialize_errc::ok)
+        return err;
+    err = deserialize_binlog_name(ctx, table);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // Column types
+    int_lenenc num_columns{};
+    err = num_columns.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (!ctx.enough_size(num_columns.value))
+        return deserialize_errc::incomplete_message;
+    auto& map = st.add_table_map(table_id);
+    map.database.assign(db.data(), db.size());
+    map.table.assign(table.data(), table.size());
+    map.column_types.assign(ctx.first(), ctx.first() + num_columns.value);
+    ctx.advance(num_columns.value);
+
+    // Column metadata
+    int_lenenc meta_length{};
+    err = meta_length.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (!ctx.enough_size(meta_length.value))
+        return deserialize_errc::incomplete_message;
+    deserialization_context meta_ctx(ctx.to_span().subspan(0, meta_length.value));
+    ctx.advance(meta_length.value);
+    map.column_meta.resize(map.column_types.size());
+    for (std::size_t i = 0; i < map.column_types.size(); ++i)
+    {
+        std::uint8_t type = map.column_types[i];
+        std::size_t meta_size = binlog_column_meta_size(type);
+        if (!meta_ctx.enough_size(meta_size))
+            return deserialize_errc::incomplete_message;
+        // Most types store metadata little-endian. STRING, ENUM, SET and NEWDECIMAL
+        // store the real type / precision in the first byte
+        std::uint16_t meta = 0u;
+        if (meta_size == 1u)
+            meta = meta_ctx.first()[0];
+        else if (meta_size == 2u)
+        {
+            bool first_byte_high = type == static_cast<std::uint8_t>(protocol_field_type::string) ||
+                                   type == static_cast<std::uint8_t>(protocol_field_type::enum_) ||
+                                   type == static_cast<std::uint8_t>(protocol_field_type::set);
+            if (first_byte_high)
+                meta = static_cast<std::uint16_t>((meta_ctx.first()[0] << 8) | meta_ctx.first()[1]);
+            else
+                meta = static_cast<std::uint16_t>(meta_ctx.first()[0] | (meta_ctx.first()[1] << 8));
+        }
+        meta_ctx.advance(meta_size);
+        map.column_meta[i] = meta;
+    }
+
+    // Nullability bitmap. We don't use it, since rows have their own NULL bitmaps
+    std::size_t null_bitmap_size = (map.column_types.size() + 7u) / 8u;
+    if (!ctx.enough_size(null_bitmap_size))
+        return deserialize_errc::incomplete_message;
+    ctx.advance(null_bitmap_size);
+
+    // Optional metadata (binlog_row_metadata). We only use signedness (type 1),
+    // a bitmap with one bit per numeric column, most significant bit first
+    map.column_unsigned.clear();
+    while (ctx.size() > 0u)
+    {
+        int1 field_type{};
+        int_lenenc field_length{};
+        err = ctx.deserialize(field_type, field_length);
+        if (err != deserialize_errc::ok)
+            return err;
+        if (!ctx.enough_size(field_length.value))
+            return deserialize_errc::incomplete_message;
+        if (field_type.value == 1u)
+        {
+            map.column_unsigned.assign(map.column_types.size(), 0u);
+            std::size_t numeric_index = 0u;
+            for (std::size_t i = 0; i < map.column_types.size(); ++i)
+            {
+                if (!binlog_is_numeric_column(map.column_types[i]))
+                    continue;
+                std::size_t byte_pos = numeric_index / 8u;
+                if (byte_pos >= field_length.value)
+                    return deserialize_errc::protocol_value_error;
+                map.column_unsigned[i] = (ctx.first()[byte_pos] >> (7u - numeric_index % 8u)) & 1u;
+                ++numeric_index;
+            }
+        }
+        ctx.advance(field_length.value);
+    }
+
+    access::get_impl(output).database = map.database;
+    access::get_impl(output).table = map.table;
+    return deserialize_errc::ok;
+}
+
+// Decodes a row image, appending one field per table column to storage
+inline deserialize_errc deserialize_binlog_row_image(
+    deserialization_context& ctx,
+    const binlog_table_map& map,
+    const std::uint8_t* columns_present,
+    std::string& decimal_buffer,
+    std::vector<field_view>& storage
+)
+{
+    const std::size_t num_columns = map.column_types.size();
+
+    // The NULL bitmap has a bit per present column
+    std::size_t num_present = 0u;
+    for (std::size_t i = 0; i < num_columns; ++i)
+        num_present += binlog_bitmap_get(columns_present, i);
+    const std::size_t null_bitmap_size = (num_present + 7u) / 8u;
+    if (!ctx.enough_size(null_bitmap_size))
+        return deserialize_errc::incomplete_message;
+    const std::uint8_t* null_bitmap = ctx.first();
+    ctx.advance(null_bitmap_size);
+
+    std::size_t present_index = 0u;
+    for (std::size_t i = 0; i < num_columns; ++i)
+    {
+        storage.emplace_back();
+        if (!binlog_bitmap_get(columns_present, i))
+            continue;
+        if (!binlog_bitmap_get(null_bitmap, present_index++))
+        {
+            bool is_unsigned = !map.column_unsigned.empty() && map.column_unsigned[i];
+            auto err = deserialize_binlog_value(
+                ctx,
+                map.column_types[i],
+                map.column_meta[i],
+                is_unsigned,
+                decimal_buffer,
+                storage.back()
+            );
+            if (err != deserialize_errc::ok)
+                return err;
+        }
+    }
+    return deserialize_errc::ok;
+}
+
+// DECIMALs are stored as offsets while decoding. Convert them to views once the buffer is stable
+inline void binlog_offsets_to_string_views(std::vector<field_view>& fields, const std::string& buffer)
+{
+    for (auto& f : fields)
+    {
+        auto& impl = access::get_impl(f);
+        if (impl.is_string_offset())
+        {
+            const auto& offset = impl.repr.sv_offset_;
+            f = field_view(string_view(buffer.data() + offset.offset, offset.size));
+        }
+    }
+}
+
+// WRITE_ROWS, UPDATE_ROWS, DELETE_ROWS (v1 and v2)
+inline deserialize_errc deserialize_rows_event(
+    deserialization_context& ctx,
+    std::uint8_t event_type,
+    binlog_stream_impl& st,
+    binlog_event& output
+)
+{
+    const bool is_v2 = event_type >= static_cast<std::uint8_t>(binlog_event_type::write_rows);
+    const bool is_write = event_type == static_cast<std::uint8_t>(binlog_event_type::write_rows) ||
+                          event_type == static_cast<std::uint8_t>(binlog_event_type::write_rows_v1);
+    const bool is_update = event_type == static_cast<std::uint8_t>(binlog_event_type::update_rows) ||
+                           event_type == static_cast<std::uint8_t>(binlog_event_type::update_rows_v1);
+
+    // Post-header: table ID, flags and, for v2 events, extra data
+    if (!ctx.enough_size(8u))
+        return deserialize_errc::incomplete_message;
+    std::uint64_t table_id = binlog_load_little(ctx.first(), 6u);
+    ctx.advance(8u);
+    if (is_v2)
+    {
+        int2 extra_data_length{};  // includes its own size
+        auto err = extra_data_length.deserialize(ctx);
+        if (err != deserialize_errc::ok)
+            return err;
+        if (extra_data_length.value < 2u)
+            return deserialize_errc::protocol_value_error;
+        if (!ctx.enough_size(extra_data_length.value - 2u))
+            return deserialize_errc::incomplete_message;
+        ctx.advance(extra_data_length.value - 2u);
+    }
+
+    // Find the table definition
+    const binlog_table_map* map = st.find_table_map(table_id);
+    if (map == nullptr)
+        return deserialize_errc::protocol_value_error;
+
+    // Columns present in the image(s)
+    int_lenenc num_columns{};
+    auto err = num_columns.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    if (num_columns.value != map->column_types.size())
+        return deserialize_errc::protocol_value_error;
+    const std::size_t bitmap_size = (map->column_types.size() + 7u) / 8u;
+    if (!ctx.enough_size(bitmap_size * (is_update ? 2u : 1u)))
+        return deserialize_errc::incomplete_message;
+    const std::uint8_t* columns_before = ctx.first();
+    ctx.advance(bitmap_size);
+    const std::uint8_t* columns_after = columns_before;
+    if (is_update)
+    {
+        columns_after = ctx.first();
+        ctx.advance(bitmap_size);
+    }
+
+    // Rows
+    st.before_fields.clear();
+    st.after_fields.clear();
+    st.decimal_buffer.clear();
+    while (ctx.size() > 0u)
+    {
+        if (is_write)
+        {
+            err = deserialize_binlog_row_image(ctx, *map, columns_before, st.decimal_buffer, st.after_fields);
+        }
+        else
+        {
+            err = deserialize_binlog_row_image(
+                ctx,
+                *map,
+                columns_before,
+                st.decimal_buffer,
+                st.before_fields
+            );
+            if (err == deserialize_errc::ok && is_update)
+            {
+                err = deserialize_binlog_row_image(
+                    ctx,
+                    *map,
+                    columns_after,
+                    st.decimal_buffer,
+                    st.after_fields
+                );
+            }
+        }
+        if (err != deserialize_errc::ok)
+            return err;
+    }
+    if (!st.decimal_buffer.empty())
+    {
+        binlog_offsets_to_string_views(st.before_fields, st.decimal_buffer);
+        binlog_offsets_to_string_views(st.after_fields, st.decimal_buffer);
+    }
+
+    auto& impl = access::get_impl(output);
+    impl.database = map->database;
+    impl.table = map->table;
+    impl.rows_before = access::construct<rows_view>(
+        st.before_fields.data(),
+        st.before_fields.size(),
+        map->column_types.size()
+    );
+    impl.rows_after = access::construct<rows_view>(
+        st.after_fields.data(),
+        st.after_fields.size(),
+        map->column_types.size()
+    );
+    return deserialize_errc::ok;
+}
+
+// QUERY
+inline deserialize_errc deserialize_query_event(deserialization_context& ctx, binlog_event& output)
+{
+    // Post-header: thread ID, execution time, database length, error code, status variables length
+    int4 thread_id{};
+    int4 exec_time{};
+    int1 db_length{};
+    int2 err_code{};
+    int2 status_vars_length{};
+    auto err = ctx.deserialize(thread_id, exec_time, db_length, err_code, status_vars_length);
+    if (err != deserialize_errc::ok)
+        return err;
+
+    // Status variables, database (null-terminated) and query
+    if (!ctx.enough_size(status_vars_length.value + db_length.value + 1u))
+        return deserialize_errc::incomplete_message;
+    ctx.advance(status_vars_length.value);
+    auto& impl = access::get_impl(output);
+    impl.database = ctx.get_string(db_length.value);
+    ctx.advance(db_length.value + 1u);
+    impl.query = ctx.get_string(ctx.size());
+    ctx.advance(ctx.size());
+    return deserialize_errc::ok;
+}
+
+// Updates transaction tracking after a QUERY event. The server logs BEGIN (or XA START)
+// before transactional statements. In statement-based and mixed replication, the transaction
+// contains DML QUERY events, and is ended by COMMIT, ROLLBACK, an XID or an XA_PREPARE event.
+// Statements logged outside BEGIN (e.g. DDL, XA COMMIT) are transactions on their own.
+// ROLLBACK TO SAVEPOINT and SAVEPOINT don't end transactions
+inline void binlog_process_query(binlog_stream_impl& st, string_view query)
+{
+    if (query == "BEGIN" || query.substr(0, 8) == "XA START")
+        st.in_transaction = true;
+    else if (!st.in_transaction || query == "COMMIT" || query == "ROLLBACK")
+        st.on_transaction_end();
+}
+
+// ROTATE
+inline deserialize_errc deserialize_rotate_event(
+    deserialization_context& ctx,
+    binlog_stream_impl& st,
+    binlog_event& output
+)
+{
+    int8 position{};
+    auto err = position.deserialize(ctx);
+    if (err != deserialize_errc::ok)
+        return err;
+    auto& impl = access::get_impl(output);
+    impl.next_log_position = position.value;
+    impl.next_log_file = ctx.get_string(ctx.size());
+    ctx.advance(ctx.size());
+    st.log_file.assign(impl.next_log_file.data(), impl.next_log_file.size());
+    st.log_position = position.value;
+    return deserialize_errc::ok;
+}
+
+// GTID
+inline deserialize_errc deserialize_gtid_event(
+    deserialization_context& ctx,
+    bool is_anonymous,
+    binlog_stream_impl& st,
+    binlog_event& output
+)
+{
+    int1 flags{};
+    string_fixed<16> source_id{};
+    int8 transaction_id{};
+    auto err = ctx.deserialize(flags, source_id, transaction_id);
+    if (err != deserialize_errc::ok)
+        return err;
+    ctx.advance(ctx.size());  // logical timestamps and other fields we don't use
+
+    // The maximum ID can't be added to a gtid_set, since it's not representable in COM_BINLOG_DUMP_GTID
+    if (!is_anonymous && transaction_id.value == UINT64_MAX)
+        return deserialize_errc::protocol_value_error;
+
+    // A new transaction is starting. Any table maps from previous transactions are no longer valid
+    st.num_table_maps = 0u;
+    st.has_pending_gtid = !is_anonymous;
+    if (is_anonymous)
+        return deserialize_errc::ok;
+
+    auto& impl = access::get_impl(output);
+    std::memcpy(impl.gtid_source.data(), source_id.value.data(), 16u);
+    impl.gtid_transaction_id = transaction_id.value;
+    st.pending_gtid_source = impl.gtid_source;
+    st.pending_gtid_transaction_id = transaction_id.value;
+    return deserialize_errc::ok;
+}
+
+// Determines whether the event has a checksum trailer
+inline bool binlog_event_has_checksum(span<const std::uint8_t> msg, std::uint8_t type, binlog_stream_impl& st)
+{
+    if (type == static_cast<std::uint8_t>(binlog_event_type::format_description))
+    {
+        // The checksum algorithm is stored just before the checksum. Format description events
+        // always include the algorithm and checksum fields, even if checksums are disabled
+        if (msg.size() < binlog_event_header_size + binlog_checksum_size + 1u)
+            return false;
+        std::uint8_t alg = msg[msg.size() - binlog_checksum_size - 1u];
+        st.checksum_known = true;
+        st.has_checksum = alg == 1u;  // CRC32
+        return true;
+    }
+    else if (st.checksum_known)
+    {
+        return st.has_checksum;
+    }
+    else
+    {
+        // Events sent before the first format description (like the initial artificial rotate)
+        // carry a checksum only if the server has checksums enabled. Check whether the
+        // trailer matches the event's CRC32
+        if (msg.size() < binlog_event_header_size + binlog_checksum_size)
+            return false;
+        std::size_t data_size = msg.size() - binlog_checksum_size;
+        return endian::load_little_u32(msg.data() + data_size) == binlog_crc32(msg.data(), data_size);
+    }
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+void boost::mysql::detail::binlog_dump_gtid_command::serialize(serialization_context& ctx) const
+{
+    // Encoded GTID set size: number of sources, then for each source its ID,
+    // number of intervals and intervals, with exclusive upper bounds
+    const auto& sources = access::get_impl(*gtids);
+    std::size_t gtid_data_size = 8u;
+    for (const auto& source : sources)
+        gtid_data_size += 16u + 8u + source.intervals.size() * 16u;
+
+    ctx.serialize_fixed(
+        int1{0x1e},                                         // command
+        int2{flags},                                        // flags
+        int4{server_id},                                    // server_id
+        int4{static_cast<std::uint32_t>(log_file.size())}   // binlog name size
+    );
+    string_eof{log_file}.serialize(ctx);  // binlog name
+    ctx.serialize_fixed(
+        int8{log_position},                                // binlog position
+        int4{static_cast<std::uint32_t>(gtid_data_size)},  // GTID data size
+        int8{sources.size()}                               // number of sources
+    );
+    for (const auto& source : sources)
+    {
+        ctx.add(source.id);
+        ctx.serialize_fixed(int8{source.intervals.size()});
+        for (const auto& iv : source.intervals)
+            ctx.serialize_fixed(int8{iv.first}, int8{iv.last + 1u});
+    }
+}
+
+boost::mysql::error_code boost::mysql::detail::deserialize_binlog_event(
+    span<const std::uint8_t> msg,
+    binlog_stream_impl& st,
+    binlog_event& output
+)
+{
+    output = binlog_event();
+    auto& impl = access::get_impl(output);
+
+    // Common header
+    if (msg.size() < binlog_event_header_size)
+        return client_errc::incomplete_message;
+    deserialization_context header_ctx(msg);
+    int4 timestamp{};
+    int1 type{};
+    int4 server_id{};
+    int4 event_size{};
+    int4 log_position{};
+    int2 flags{};
+    auto err = header_ctx.deserialize(timestamp, type, server_id, event_size, log_position, flags);
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+    if (event_size.value != msg.size())
+        return client_errc::protocol_value_error;
+
+    // Strip the checksum. event_size == msg.size(), so checking one is enough
+    std::size_t body_size = msg.size() - binlog_event_header_size;
+    if (binlog_event_has_checksum(msg, type.value, st))
+    {
+        if (body_size < binlog_checksum_size)
+            return client_errc::incomplete_message;
+        body_size -= binlog_checksum_size;
+    }
+
+    impl.raw_type = type.value;
+    impl.timestamp = timestamp.value;
+    impl.server_id = server_id.value;
+    impl.log_position = log_position.value;
+    impl.data = msg.subspan(binlog_event_header_size, body_size);
+
+    // Body
+    deserialization_context ctx(impl.data);
+    switch (type.value)
+    {
+    case static_cast<std::uint8_t>(binlog_event_type::format_description):
+        impl.type = binlog_event_type::format_description;
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::rotate):
+        impl.type = binlog_event_type::rotate;
+        err = deserialize_rotate_event(ctx, st, output);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::query):
+        impl.type = binlog_event_type::query;
+        err = deserialize_query_event(ctx, output);
+        if (err == deserialize_errc::ok)
+            binlog_process_query(st, impl.query);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::xid):
+        impl.type = binlog_event_type::xid;
+        st.on_transaction_end();
+        break;
+    case binlog_xa_prepare_event_type:
+        // Not exposed as a binlog_event_type, but ends the XA START part of an XA transaction
+        st.on_transaction_end();
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::gtid):
+        impl.type = binlog_event_type::gtid;
+        err = deserialize_gtid_event(ctx, false, st, output);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::anonymous_gtid):
+        impl.type = binlog_event_type::anonymous_gtid;
+        err = deserialize_gtid_event(ctx, true, st, output);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::table_map):
+        impl.type = binlog_event_type::table_map;
+        err = deserialize_table_map_event(ctx, st, output);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::write_rows_v1):
+    case static_cast<std::uint8_t>(binlog_event_type::update_rows_v1):
+    case static_cast<std::uint8_t>(binlog_event_type::delete_rows_v1):
+    case static_cast<std::uint8_t>(binlog_event_type::write_rows):
+    case static_cast<std::uint8_t>(binlog_event_type::update_rows):
+    case static_cast<std::uint8_t>(binlog_event_type::delete_rows):
+        impl.type = static_cast<binlog_event_type>(type.value);
+        err = deserialize_rows_event(ctx, type.value, st, output);
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::heartbeat):
+        impl.type = binlog_event_type::heartbeat;
+        break;
+    case static_cast<std::uint8_t>(binlog_event_type::previous_gtids):
+        impl.type = binlog_event_type::previous_gtids;
+        break;
+    default: break;
+    }
+    if (err != deserialize_errc::ok)
+        return to_error_code(err);
+
+    // Update the position. Artificial events don't correspond to any position in the file
+    if (log_position.value != 0u && !(flags.value & binlog_artificial_event_flag) &&
+        type.value != static_cast<std::uint8_t>(binlog_event_type::rotate))
+    {
+        st.log_position = log_position.value;
+    }
+
+    return error_code();
+}
+
+#endif
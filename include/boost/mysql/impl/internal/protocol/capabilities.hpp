@@ -97,7 +97,7 @@ public:
  * CLIENT_CONNECT_ATTRS: unset //  Client supports connection attributes
  * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be
  * larger than 255 bytes CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS: unset //  Don't close the connection
- * for a user account with expired password CLIENT_SESSION_TRACK: unset //  Capable of handling
+ * for a user account with expired password CLIENT_SESSION_TRACK: optional //  Capable of handling
  * server state change information CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs
  * EOF_Packet and will use OK_Packet instead CLIENT_SSL_VERIFY_SERVER_CERT: unset //  Verify server
  * certificate CLIENT_OPTIONAL_RESULTSET_METADATA: unset //  The client can handle optional metadata
@@ -111,6 +111,7 @@ public:
  * mandatory //  Enable authentication response packet to be larger than 255 bytes
  * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet
  * instead
+ * CLIENT_SESSION_TRACK: optional //  Capable of handling server state change information
  */
 
 // clang-format off
@@ -123,7 +124,9 @@ BOOST_INLINE_CONSTEXPR capabilities mandatory_capabilities{
 };
 // clang-format on
 
-BOOST_INLINE_CONSTEXPR capabilities optional_capabilities{CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS};
+BOOST_INLINE_CONSTEXPR capabilities optional_capabilities{
+    CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS | CLIENT_SESSION_TRACK
+};
 
 }  // namespace detail
 }  // namespace mysql
@@ -17,6 +17,7 @@
 #include <boost/mysql/field_kind.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/coldef_view.hpp>
@@ -24,6 +25,7 @@
 #include <boost/mysql/detail/make_string_view.hpp>
 #include <boost/mysql/detail/ok_view.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
 
 #include <boost/mysql/impl/internal/error/server_error_to_string.hpp>
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
@@ -164,6 +166,20 @@ inline error_code deserialize_row(
     span<field_view> output  // Should point to meta.size() field_view objects
 );
 
+// Splits a binary row into its individual values, without decoding them
+inline error_code split_binary_row(
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    binary_cell* output  // Should point to meta.size() binary_cell objects
+);
+
+// Same as split_binary_row, but for text rows. Cells hold the textual representation of each value
+inline error_code split_text_row(
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    binary_cell* output  // Should point to meta.size() binary_cell objects
+);
+
 // Server hello
 struct server_hello
 {
@@ -279,8 +295,8 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
         int_lenenc last_insert_id;
         int2 status_flags;  // server_status_flags
         int2 warnings;
-        // CLIENT_SESSION_TRACK: not implemented
         string_lenenc info;
+        string_lenenc session_state;  // CLIENT_SESSION_TRACK and SERVER_SESSION_STATE_CHANGED
     } pack{};
 
     deserialization_context ctx(msg);
@@ -295,12 +311,32 @@ boost::mysql::error_code boost::mysql::detail::deserialize_ok_packet(
             return to_error_code(err);
     }
 
+    // Session state changes are only sent if we negotiated CLIENT_SESSION_TRACK.
+    // We just validate them here. They're parsed on demand by session_state_view
+    if ((pack.status_flags.value & status_flags::session_state_changed) && ctx.enough_size(1))
+    {
+        err = pack.session_state.deserialize(ctx);
+        if (err != deserialize_errc::ok)
+            return to_error_code(err);
+
+        auto first = reinterpret_cast<const std::uint8_t*>(pack.session_state.value.data());
+        auto last = first + pack.session_state.value.size();
+        session_state_change change{};
+        while (first != last)
+        {
+            first = parse_session_state_entry(first, last, change);
+            if (first == nullptr)
+                return client_errc::protocol_value_error;
+        }
+    }
+
     output = {
         pack.affected_rows.value,
         pack.last_insert_id.value,
         pack.status_flags.value,
         pack.warnings.value,
         pack.info.value,
+        to_span(pack.session_state.value),
     };
 
     return ctx.check_extra_bytes();
@@ -729,10 +765,125 @@ inline error_code deserialize_binary_row(
     return ctx.check_extra_bytes();
 }
 
+// Gets the bytes of a single non-NULL binary value
+inline deserialize_errc split_binary_field(
+    deserialization_context& ctx,
+    const metadata& meta,
+    span<const std::uint8_t>& output
+)
+{
+    // Fixed-size values
+    std::size_t size = 0;
+    switch (meta.type())
+    {
+    case column_type::tinyint: size = 1; break;
+    case column_type::smallint:
+    case column_type::year: size = 2; break;
+    case column_type::mediumint:
+    case column_type::int_:
+    case column_type::float_: size = 4; break;
+    case column_type::bigint:
+    case column_type::double_: size = 8; break;
+    case column_type::timestamp:
+    case column_type::datetime:
+    case column_type::date:
+    case column_type::time:
+        // A length byte, followed by the actual value
+        if (!ctx.enough_size(1))
+            return deserialize_errc::incomplete_message;
+        size = 1u + *ctx.first();
+        break;
+    default:
+    {
+        // Everything else is length-encoded
+        string_lenenc value;
+        auto err = value.deserialize(ctx);
+        if (err != deserialize_errc::ok)
+            return err;
+        output = to_span(value.value);
+        return deserialize_errc::ok;
+    }
+    }
+
+    if (!ctx.enough_size(size))
+        return deserialize_errc::incomplete_message;
+    output = span<const std::uint8_t>(ctx.first(), size);
+    ctx.advance(size);
+    return deserialize_errc::ok;
+}
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
 
+boost::mysql::error_code boost::mysql::detail::split_binary_row(
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    binary_cell* output
+)
+{
+    deserialization_context ctx(message);
+
+    // Skip packet header, as in deserialize_binary_row
+    if (!ctx.enough_size(1))
+        return client_errc::incomplete_message;
+    ctx.advance(1);
+
+    // Null bitmap
+    std::size_t num_fields = meta.size();
+    null_bitmap_parser null_bitmap(num_fields);
+    const std::uint8_t* null_bitmap_first = ctx.first();
+    std::size_t null_bitmap_size = null_bitmap.byte_count();
+    if (!ctx.enough_size(null_bitmap_size))
+        return client_errc::incomplete_message;
+    ctx.advance(null_bitmap_size);
+
+    // Values
+    for (std::size_t i = 0; i < num_fields; ++i)
+    {
+        output[i].is_null = null_bitmap.is_null(null_bitmap_first, i);
+        if (output[i].is_null)
+        {
+            output[i].data = {};
+        }
+        else
+        {
+            auto err = split_binary_field(ctx, meta[i], output[i].data);
+            if (err != deserialize_errc::ok)
+                return to_error_code(err);
+        }
+    }
+
+    // Check for remaining bytes
+    return ctx.check_extra_bytes();
+}
+
+boost::mysql::error_code boost::mysql::detail::split_text_row(
+    span<const std::uint8_t> message,
+    metadata_collection_view meta,
+    binary_cell* output
+)
+{
+    deserialization_context ctx(message);
+    for (std::size_t i = 0; i < meta.size(); ++i)
+    {
+        if (is_next_field_null(ctx))
+        {
+            ctx.advance(1);
+            output[i] = binary_cell{};
+        }
+        else
+        {
+            string_lenenc value_str;
+            auto err = value_str.deserialize(ctx);
+            if (err != deserialize_errc::ok)
+                return to_error_code(err);
+            output[i] = binary_cell{to_span(value_str.value), false};
+        }
+    }
+    return ctx.check_extra_bytes();
+}
+
 boost::mysql::error_code boost::mysql::detail::deserialize_row(
     resultset_encoding encoding,
     span<const std::uint8_t> buff,
@@ -138,6 +138,17 @@ public:
         add({reinterpret_cast<const std::uint8_t*>(content), size});
     }
 
+    // Reserves buffer space for size more bytes of content, plus any frame headers required by them.
+    // Used when the size of a message can be estimated, to avoid reallocations while serializing.
+    // The buffer never grows past the maximum size, so the reserved space is capped to it
+    void reserve(std::size_t size)
+    {
+        std::size_t total = buffer_.size() + size;
+        if (framing_enabled())
+            total += (size / max_frame_size_ + 1u) * frame_header_size;
+        buffer_.reserve((std::min)(total, max_buffer_size_));
+    }
+
     // Sets the error state
     void add_error(error_code ec)
     {
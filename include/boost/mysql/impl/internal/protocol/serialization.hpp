@@ -10,8 +10,11 @@
 
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/param_column.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/access.hpp>
+
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
 #include <boost/mysql/impl/internal/protocol/frame_header.hpp>
 #include <boost/mysql/impl/internal/protocol/impl/binary_protocol.hpp>
@@ -80,6 +83,16 @@ struct execute_stmt_command
     inline void serialize(serialization_context& ctx) const;
 };
 
+// execute statement, taking the parameters from a row of a set of columns
+struct execute_stmt_columns_command
+{
+    std::uint32_t statement_id;
+    span<const param_column> params;
+    std::size_t row;
+
+    inline void serialize(serialization_context& ctx) const;
+};
+
 // close statement
 struct close_stmt_command
 {
@@ -194,6 +207,33 @@ inline protocol_field_type to_protocol_field_type(field_kind kind)
     }
 }
 
+// Serializes the value of a non-NULL parameter in a column (for execute statement)
+inline void serialize_binary_param(serialization_context& ctx, const param_column& param, std::size_t row)
+{
+    const auto& impl = access::get_impl(param);
+    switch (impl.kind)
+    {
+    case field_kind::int64: sint8{static_cast<const std::int64_t*>(impl.data)[row]}.serialize(ctx); break;
+    case field_kind::uint64: int8{static_cast<const std::uint64_t*>(impl.data)[row]}.serialize(ctx); break;
+    case field_kind::string:
+        string_lenenc{static_cast<const string_view*>(impl.data)[row]}.serialize(ctx);
+        break;
+    case field_kind::blob:
+        string_lenenc{to_string(static_cast<const blob_view*>(impl.data)[row])}.serialize(ctx);
+        break;
+    case field_kind::float_: serialize_binary_float(ctx, static_cast<const float*>(impl.data)[row]); break;
+    case field_kind::double_: serialize_binary_float(ctx, static_cast<const double*>(impl.data)[row]); break;
+    case field_kind::date: serialize_binary_date(ctx, static_cast<const date*>(impl.data)[row]); break;
+    case field_kind::datetime:
+        serialize_binary_datetime(ctx, static_cast<const datetime*>(impl.data)[row]);
+        break;
+    case field_kind::time:
+        serialize_binary_time(ctx, static_cast<const boost::mysql::time*>(impl.data)[row]);
+        break;
+    default: BOOST_ASSERT(false); break;  // LCOV_EXCL_LINE
+    }
+}
+
 // Returns the collation ID's first byte (for login packets)
 inline std::uint8_t get_collation_first_byte(std::uint32_t collation_id)
 {
@@ -257,6 +297,58 @@ void boost::mysql::detail::execute_stmt_command::serialize(serialization_context
     }
 }
 
+void boost::mysql::detail::execute_stmt_columns_command::serialize(serialization_context& ctx) const
+{
+    // Same wire layout as execute_stmt_command. NULL values are sent
+    // with the NULL type, as execute_stmt_command does
+    constexpr int1 command_id{0x17};
+    constexpr int1 flags{0};
+    constexpr int4 iteration_count{1};
+    constexpr int1 new_params_bind_flag{1};
+
+    // header
+    ctx.serialize_fixed(command_id, int4{statement_id}, flags, iteration_count);
+
+    // Number of parameters
+    auto num_params = params.size();
+
+    if (num_params > 0)
+    {
+        // NULL bitmap
+        std::uint8_t null_byte = 0;
+        for (std::size_t i = 0; i < num_params; ++i)
+        {
+            BOOST_ASSERT(row < params[i].size());
+            if (params[i].is_null(row))
+                null_byte |= static_cast<std::uint8_t>(1u << (i % 8u));
+            if (i % 8u == 7u || i + 1u == num_params)
+            {
+                ctx.add(null_byte);
+                null_byte = 0;
+            }
+        }
+
+        // new parameters bind flag
+        new_params_bind_flag.serialize(ctx);
+
+        // value metadata
+        for (const param_column& param : params)
+        {
+            field_kind kind = param.is_null(row) ? field_kind::null : param.kind();
+            protocol_field_type type = to_protocol_field_type(kind);
+            std::uint8_t unsigned_flag = kind == field_kind::uint64 ? std::uint8_t(0x80) : std::uint8_t(0);
+            ctx.serialize_fixed(int1{static_cast<std::uint8_t>(type)}, int1{unsigned_flag});
+        }
+
+        // actual values
+        for (const param_column& param : params)
+        {
+            if (!param.is_null(row))
+                serialize_binary_param(ctx, param, row);
+        }
+    }
+}
+
 void boost::mysql::detail::login_request::serialize(serialization_context& ctx) const
 {
     ctx.serialize_fixed(
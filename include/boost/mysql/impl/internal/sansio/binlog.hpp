@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_INTERNAL_SANSIO_BINLOG_HPP
+#define BOOST_MYSQL_IMPL_INTERNAL_SANSIO_BINLOG_HPP
+
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/binlog_stream.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/binlog_stream_impl.hpp>
+#include <boost/mysql/detail/next_action.hpp>
+
+#include <boost/mysql/impl/internal/coroutine.hpp>
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/protocol/deserialization.hpp>
+#include <boost/mysql/impl/internal/protocol/serialization.hpp>
+#include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Makes the server send checksums (if enabled), instead of stripping them.
+// Servers older than 8.0.26 only understand the master_ prefix.
+BOOST_INLINE_CONSTEXPR const char* binlog_checksum_query =
+    "SET @master_binlog_checksum = @@global.binlog_checksum, "
+    "@source_binlog_checksum = @@global.binlog_checksum";
+
+class binlog_dump_algo
+{
+    int resume_point_{0};
+    diagnostics* diag_;
+    const binlog_dump_params* params_;
+    binlog_stream_impl* stream_;
+    std::uint8_t seqnum_{0};
+
+    binlog_dump_gtid_command make_dump_command() const
+    {
+        // GTID-based replication is used unless the user supplied a position
+        bool use_position = params_->gtids.empty() && !params_->log_file.empty();
+        std::uint16_t flags = use_position ? binlog_through_position : binlog_through_gtid;
+        if (params_->non_blocking)
+            flags |= binlog_dump_non_block;
+        return {
+            flags,
+            params_->server_id,
+            params_->log_file,
+            use_position ? params_->log_position : 4u,
+            &params_->gtids,
+        };
+    }
+
+public:
+    binlog_dump_algo(diagnostics& diag, binlog_dump_algo_params params) noexcept
+        : diag_(&diag), params_(params.params), stream_(params.stream)
+    {
+    }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        switch (resume_point_)
+        {
+        case 0:
+
+            // Clear diagnostics
+            diag_->clear();
+
+            // MariaDB uses a different GTID format and dump command
+            if (st.flavor == db_flavor::mariadb)
+                return error_code(client_errc::server_unsupported);
+
+            // Initialize the stream state
+            stream_->reset();
+            stream_->executed_gtids = params_->gtids;
+            stream_->log_file = params_->log_file;
+            stream_->log_position = params_->log_position;
+
+            // Enable checksums
+            seqnum_ = 0u;
+            BOOST_MYSQL_YIELD(resume_point_, 1, st.write(query_command{binlog_checksum_query}, seqnum_))
+            BOOST_MYSQL_YIELD(resume_point_, 2, st.read(seqnum_))
+            ec = st.deserialize_ok(*diag_);
+            if (ec)
+                return ec;
+
+            // Register as a replica
+            seqnum_ = 0u;
+            BOOST_MYSQL_YIELD(
+                resume_point_,
+                3,
+                st.write(register_replica_command{params_->server_id}, seqnum_)
+            )
+            BOOST_MYSQL_YIELD(resume_point_, 4, st.read(seqnum_))
+            ec = st.deserialize_ok(*diag_);
+            if (ec)
+                return ec;
+
+            // Request the dump. Events will follow, without any further request
+            stream_->seqnum = 0u;
+            BOOST_MYSQL_YIELD(resume_point_, 5, st.write(make_dump_command(), stream_->seqnum))
+            stream_->started = true;
+        }
+
+        return next_action();
+    }
+};
+
+class read_binlog_event_algo
+{
+    int resume_point_{0};
+    diagnostics* diag_;
+    binlog_stream_impl* stream_;
+    binlog_event event_;
+
+    error_code process_event(connection_state_data& st)
+    {
+        auto msg = st.reader.message();
+        if (msg.empty())
+            return client_errc::incomplete_message;
+        switch (msg[0])
+        {
+        case 0x00: return deserialize_binlog_event(msg.subspan(1), *stream_, event_);
+        case 0xff: return process_error_packet(msg.subspan(1), st.flavor, *diag_);
+        case 0xfe:
+            // EOF packet, sent in non-blocking mode once all events have been sent.
+            // Large events may start with 0xfe, but they're always preceded by 0x00
+            stream_->complete = true;
+            return error_code();
+        default: return client_errc::protocol_value_error;
+        }
+    }
+
+public:
+    read_binlog_event_algo(diagnostics& diag, read_binlog_event_algo_params params) noexcept
+        : diag_(&diag), stream_(params.stream)
+    {
+    }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        if (ec)
+            return ec;
+
+        switch (resume_point_)
+        {
+        case 0:
+
+            // Clear diagnostics
+            diag_->clear();
+
+            // Reading from a stream that was never started is a usage error
+            if (!stream_->started)
+                return error_code(client_errc::binlog_stream_not_started);
+
+            // If there are no more events to read, return an empty event
+            if (stream_->complete)
+                return next_action();
+
+            // Read the event. Packets are numbered consecutively for the whole stream
+            BOOST_MYSQL_YIELD(resume_point_, 1, st.read(stream_->seqnum))
+
+            // Decode it
+            return process_event(st);
+        }
+
+        return next_action();
+    }
+
+    binlog_event result(const connection_state_data&) const { return event_; }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -16,6 +16,7 @@
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/any_resumable_ref.hpp>
 
+#include <boost/mysql/impl/internal/sansio/binlog.hpp>
 #include <boost/mysql/impl/internal/sansio/close_connection.hpp>
 #include <boost/mysql/impl/internal/sansio/close_statement.hpp>
 #include <boost/mysql/impl/internal/sansio/connect.hpp>
@@ -47,15 +48,21 @@ template <class AlgoParams> struct get_algo;
 template <> struct get_algo<connect_algo_params> { using type = connect_algo; };
 template <> struct get_algo<handshake_algo_params> { using type = handshake_algo; };
 template <> struct get_algo<execute_algo_params> { using type = execute_algo; };
+template <> struct get_algo<execute_each_algo_params> { using type = execute_each_algo; };
 template <> struct get_algo<start_execution_algo_params> { using type = start_execution_algo; };
 template <> struct get_algo<read_resultset_head_algo_params> { using type = read_resultset_head_algo; };
 template <> struct get_algo<read_some_rows_algo_params> { using type = read_some_rows_algo; };
 template <> struct get_algo<read_some_rows_dynamic_algo_params> { using type = read_some_rows_dynamic_algo; };
+template <> struct get_algo<read_some_rows_batch_algo_params> { using type = read_some_rows_batch_algo; };
+template <> struct get_algo<read_some_rows_lazy_algo_params> { using type = read_some_rows_lazy_algo; };
 template <> struct get_algo<prepare_statement_algo_params> { using type = prepare_statement_algo; };
 template <> struct get_algo<set_character_set_algo_params> { using type = set_character_set_algo; };
 template <> struct get_algo<quit_connection_algo_params> { using type = quit_connection_algo; };
 template <> struct get_algo<close_connection_algo_params> { using type = close_connection_algo; };
 template <> struct get_algo<run_pipeline_algo_params> { using type = run_pipeline_algo; };
+template <> struct get_algo<run_pipeline_each_algo_params> { using type = run_pipeline_algo; };
+template <> struct get_algo<binlog_dump_algo_params> { using type = binlog_dump_algo; };
+template <> struct get_algo<read_binlog_event_algo_params> { using type = read_binlog_event_algo; };
 template <class AlgoParams> using get_algo_t = typename get_algo<AlgoParams>::type;
 // clang-format on
 
@@ -69,15 +76,20 @@ class connection_state
         connect_algo,
         handshake_algo,
         execute_algo,
+        execute_each_algo,
         start_execution_algo,
         read_resultset_head_algo,
         read_some_rows_algo,
         read_some_rows_dynamic_algo,
+        read_some_rows_batch_algo,
+        read_some_rows_lazy_algo,
         prepare_statement_algo,
         set_character_set_algo,
         quit_connection_algo,
         close_connection_algo,
-        run_pipeline_algo>;
+        run_pipeline_algo,
+        binlog_dump_algo,
+        read_binlog_event_algo>;
 
     connection_state_data st_data_;
     any_algo algo_;
@@ -12,8 +12,11 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/session_state.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/next_action.hpp>
+#include <boost/mysql/detail/ok_view.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
 
 #include <boost/mysql/impl/internal/protocol/capabilities.hpp>
@@ -111,6 +114,28 @@ struct connection_state_data
         return deserialize_ok_response(reader.message(), flavor, diag, backslash_escapes);
     }
 
+    // Updates the connection state with the information in an OK packet
+    // received as the result of executing a user-supplied statement.
+    void on_ok_packet(const ok_view& ok)
+    {
+        backslash_escapes = ok.backslash_escapes();
+
+        // If the server tracks character_set_client (the default in MySQL 8),
+        // keep current_charset up to date after statements like SET NAMES
+        for (const auto& change : access::construct<session_state_view>(ok.session_state))
+        {
+            if (change.type == session_track_type::system_variable && change.name == "character_set_client")
+            {
+                if (change.value == utf8mb4_charset.name)
+                    current_charset = utf8mb4_charset;
+                else if (change.value == ascii_charset.name)
+                    current_charset = ascii_charset;
+                else
+                    current_charset = character_set{};
+            }
+        }
+    }
+
     // Helpers for sans-io algorithms
     next_action read(std::uint8_t& seqnum, bool keep_parsing_state = false)
     {
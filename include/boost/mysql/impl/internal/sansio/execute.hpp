@@ -13,6 +13,7 @@
 
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/any_execution_request.hpp>
+#include <boost/mysql/detail/execution_processor/execute_each_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 
 #include <boost/mysql/impl/internal/coroutine.hpp>
@@ -112,6 +113,42 @@ public:
     }
 };
 
+// Like execute_algo, but resultsets are passed to a visitor as they are read
+class execute_each_algo
+{
+    int resume_point_{0};
+    diagnostics* diag_;
+    any_execution_request req_;
+    execute_each_processor proc_;
+    execute_algo execute_st_;
+
+public:
+    execute_each_algo(diagnostics& diag, execute_each_algo_params params) noexcept
+        : diag_(&diag), req_(params.req), proc_(params.visitor), execute_st_(diag, {params.req, nullptr})
+    {
+    }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        next_action act;
+
+        switch (resume_point_)
+        {
+        case 0:
+
+            // The processor lives in this object, which may have been moved since construction.
+            // Point the execute algorithm to it now that our address is stable.
+            execute_st_ = execute_algo(*diag_, {req_, &proc_});
+
+            while (!(act = execute_st_.resume(st, ec)).is_done())
+                BOOST_MYSQL_YIELD(resume_point_, 1, act)
+            return act;
+        }
+
+        return next_action();
+    }
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -174,6 +175,11 @@ public:
         }
     }
 
+    // Hands previously parsed messages to the caller, without copying them.
+    // See read_buffer::detach_reserved. The last message returned by message()
+    // remains valid in both buffers.
+    void detach_buffer(std::vector<std::uint8_t>& to) { buffer_.detach_reserved(to); }
+
     // Exposed for testing
     const read_buffer& internal_buffer() const { return buffer_; }
 
@@ -137,6 +137,26 @@ public:
         }
     }
 
+    // Hands the reserved area to the caller without copying it. The buffer's storage
+    // is swapped with other's, and the current message and pending bytes are copied
+    // to the beginning of the new storage. On return, other holds the old storage,
+    // with the reserved area at its beginning. Used by row_batch to lend row messages to the user.
+    void detach_reserved(std::vector<std::uint8_t>& other)
+    {
+        // Make the new storage as big as the current one, so we don't lose capacity
+        if (other.size() != buffer_.size())
+            other.resize(buffer_.size());
+
+        std::size_t currmsg_size = current_message_size();
+        std::size_t pend_size = pending_size();
+        if (currmsg_size + pend_size > 0u)
+            std::memcpy(other.data(), current_message_first(), currmsg_size + pend_size);
+        buffer_.swap(other);
+        current_message_offset_ = 0;
+        pending_offset_ = currmsg_size;
+        free_offset_ = currmsg_size + pend_size;
+    }
+
     // Makes sure the free size is at least n bytes long; resizes the buffer if required
     BOOST_ATTRIBUTE_NODISCARD
     error_code grow_to_fit(std::size_t n)
@@ -73,7 +73,7 @@ class read_some_rows_algo
             }
             else
             {
-                st.backslash_escapes = res.data.ok_pack.backslash_escapes();
+                st.on_ok_packet(res.data.ok_pack);
                 err = proc.on_row_ok_packet(res.data.ok_pack);
             }
 
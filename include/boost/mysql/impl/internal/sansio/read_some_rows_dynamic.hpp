@@ -10,12 +10,15 @@
 
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
+#include <boost/mysql/row_batch.hpp>
 #include <boost/mysql/rows_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
+#include <boost/mysql/detail/next_action.hpp>
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/read_some_rows.hpp>
@@ -42,6 +45,89 @@ public:
     }
 };
 
+// Like read_some_rows_dynamic_algo, but the rows are handed to a row_batch, together with
+// the read buffer region they point into. The connection keeps reading using the batch's
+// previous buffer, so no strings are copied.
+class read_some_rows_batch_algo
+{
+    read_some_rows_algo inner_;
+    row_batch_impl* output_;
+
+public:
+    read_some_rows_batch_algo(diagnostics& diag, read_some_rows_batch_algo_params params) noexcept
+        : inner_(diag, read_some_rows_algo_params{params.exec_st, output_ref()}), output_(params.output)
+    {
+    }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        // Invalidate any previous contents
+        output_->fields.clear();
+        output_->num_columns = 0u;
+
+        auto act = inner_.resume(st, ec);
+        if (!act.success())
+            return act;
+
+        // If we read rows, lend the buffer they point into to the batch.
+        // This must be done after all rows have been processed, since the reader
+        // may hold a partial message, which is moved to the new buffer.
+        if (inner_.result(st) > 0u)
+        {
+            st.reader.detach_buffer(output_->buffer);
+            output_->fields.swap(st.shared_fields);
+            output_->num_columns = static_cast<const execution_state_impl&>(inner_.processor()).meta().size();
+        }
+        return act;
+    }
+
+    void result(const connection_state_data&) const {}
+};
+
+// Like read_some_rows_batch_algo, but rows are only split into cells, rather than decoded.
+// The batch gets a copy of the metadata, required to decode them later.
+class read_some_rows_lazy_algo
+{
+    read_some_rows_algo inner_;
+    lazy_row_batch_impl* output_;
+
+public:
+    read_some_rows_lazy_algo(diagnostics& diag, read_some_rows_lazy_algo_params params) noexcept
+        : inner_(diag, read_some_rows_algo_params{params.exec_st, output_ref(params.output->cells)}),
+          output_(params.output)
+    {
+    }
+
+    next_action resume(connection_state_data& st, error_code ec)
+    {
+        // Invalidate any previous contents
+        output_->clear();
+
+        auto act = inner_.resume(st, ec);
+        if (!act.success())
+        {
+            // Don't leave cells for partially processed rows behind
+            if (act.is_done())
+                output_->clear();
+            return act;
+        }
+
+        // Cells point into the read buffer, so we lend it to the batch, as in read_some_rows_batch_algo
+        if (inner_.result(st) > 0u)
+        {
+            const auto& proc = static_cast<const execution_state_impl&>(inner_.processor());
+            st.reader.detach_buffer(output_->buffer);
+            output_->meta.assign(proc.meta().begin(), proc.meta().end());
+            output_->encoding = proc.encoding();
+            output_->fields.resize(output_->cells.size());
+            output_->decoded.assign(output_->cells.size(), 0u);
+        }
+        return act;
+    }
+
+    void result(const connection_state_data&) const {}
+};
+
 }  // namespace detail
 }  // namespace mysql
 }  // namespace boost
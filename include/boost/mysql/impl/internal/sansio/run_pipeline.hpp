@@ -16,8 +16,10 @@
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/algo_params.hpp>
+#include <boost/mysql/detail/execution_processor/execute_each_processor.hpp>
 #include <boost/mysql/detail/next_action.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
+#include <boost/mysql/detail/pipeline_visitor_ref.hpp>
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
 #include <boost/mysql/impl/internal/sansio/execute.hpp>
@@ -54,6 +56,7 @@ class run_pipeline_algo
     span<const std::uint8_t> request_buffer_;
     span<const pipeline_request_stage> stages_;
     std::vector<stage_response>* response_;
+    pipeline_visitor_ref visitor_;  // If set, responses are streamed to the visitor instead of stored
 
     int resume_point_{0};
     std::size_t current_stage_index_{0};
@@ -61,6 +64,21 @@ class run_pipeline_algo
     bool has_hatal_error_{};  // If true, fail further stages with pipeline_ec_
     any_read_algo read_response_algo_;
     diagnostics temp_diag_;
+    execute_each_processor each_processor_;  // When streaming, used by all execution stages
+    stage_response stage_response_;          // When streaming, the response for the current stage
+
+    bool is_streaming() const { return visitor_.has_value(); }
+
+    // Where to store the response of the current stage, if any
+    stage_response* current_response()
+    {
+        if (response_)
+            return &(*response_)[current_stage_index_];
+        else if (is_streaming())
+            return &stage_response_;
+        else
+            return nullptr;
+    }
 
     void setup_response()
     {
@@ -87,6 +105,8 @@ class run_pipeline_algo
     {
         // Reset previous data
         temp_diag_.clear();
+        if (is_streaming())
+            access::get_impl(stage_response_).emplace_error();
 
         // Setup read algo
         auto stage = stages_[current_stage_index_];
@@ -94,11 +114,14 @@ class run_pipeline_algo
         {
         case pipeline_stage_kind::execute:
         {
-            BOOST_ASSERT(response_ != nullptr);  // we don't support execution ignoring the response
-            auto& processor = access::get_impl((*response_)[current_stage_index_]).get_processor();
-            processor.reset(stage.stage_specific.enc, st.meta_mode);
-            processor.sequence_number() = stage.seqnum;
-            read_response_algo_.execute = {temp_diag_, &processor};
+            // We don't support execution ignoring the response
+            BOOST_ASSERT(response_ != nullptr || is_streaming());
+            execution_processor* processor = &each_processor_.get_interface();
+            if (response_)
+                processor = &access::get_impl((*response_)[current_stage_index_]).get_processor();
+            processor->reset(stage.stage_specific.enc, st.meta_mode);
+            processor->sequence_number() = stage.seqnum;
+            read_response_algo_.execute = {temp_diag_, processor};
             break;
         }
         case pipeline_stage_kind::prepare_statement:
@@ -121,12 +144,20 @@ class run_pipeline_algo
 
     void set_stage_error(error_code ec, diagnostics&& diag)
     {
-        if (response_)
+        auto* resp = current_response();
+        if (resp)
         {
-            access::get_impl((*response_)[current_stage_index_]).set_error(ec, std::move(diag));
+            access::get_impl(*resp).set_error(ec, std::move(diag));
         }
     }
 
+    // When streaming, hand the stage's response to the visitor as soon as it's complete
+    void notify_stage_finished()
+    {
+        if (is_streaming())
+            visitor_.on_stage_finished(current_stage_index_, std::move(stage_response_));
+    }
+
     void on_stage_finished(const connection_state_data& st, error_code stage_ec)
     {
         if (stage_ec)
@@ -147,19 +178,16 @@ class run_pipeline_algo
             }
 
             // Propagate the error
-            if (response_ != nullptr)
-            {
-                set_stage_error(stage_ec, std::move(temp_diag_));
-            }
+            set_stage_error(stage_ec, std::move(temp_diag_));
         }
         else
         {
             if (stages_[current_stage_index_].kind == pipeline_stage_kind::prepare_statement)
             {
                 // Propagate results. We don't support prepare statements ignoring the response
-                BOOST_ASSERT(response_ != nullptr);
-                access::get_impl((*response_)[current_stage_index_])
-                    .set_result(read_response_algo_.prepare_statement.result(st));
+                auto* resp = current_response();
+                BOOST_ASSERT(resp != nullptr);
+                access::get_impl(*resp).set_result(read_response_algo_.prepare_statement.result(st));
             }
         }
     }
@@ -190,6 +218,16 @@ public:
     {
     }
 
+    run_pipeline_algo(diagnostics& diag, run_pipeline_each_algo_params params) noexcept
+        : diag_(&diag),
+          request_buffer_(params.request_buffer),
+          stages_(params.request_stages),
+          response_(nullptr),
+          visitor_(params.visitor),
+          each_processor_(params.visitor.resultsets())
+    {
+    }
+
     next_action resume(connection_state_data& st, error_code ec)
     {
         next_action act;
@@ -223,6 +261,7 @@ public:
                 if (has_hatal_error_)
                 {
                     set_stage_error(pipeline_ec_, diagnostics(*diag_));
+                    notify_stage_finished();
                     continue;
                 }
 
@@ -236,6 +275,7 @@ public:
 
                 // Process the stage's result
                 on_stage_finished(st, act.error());
+                notify_stage_finished();
             }
         }
 
@@ -46,6 +46,11 @@ struct query_with_params
         // Create a format context
         auto fmt_ctx = access::construct<format_context_base>(output_string_ref::create(ctx), opts);
 
+        // Reserve space for the query, to avoid reallocating while formatting big arguments.
+        // This is just an estimate: a full sizing pass would cost more than it saves,
+        // since the write buffer is re-used between operations
+        ctx.reserve(1u + estimate_formatted_size(opts, query.get(), args));
+
         // Serialize the query header
         ctx.add(0x03);
 
@@ -57,6 +62,23 @@ struct query_with_params
     }
 };
 
+// Like query_with_params, but with a format string that has already been parsed
+struct query_with_compiled_params
+{
+    compiled_format_ref query;
+    span<const format_arg> args;
+    format_options opts;
+
+    void serialize(serialization_context& ctx) const
+    {
+        auto fmt_ctx = access::construct<format_context_base>(output_string_ref::create(ctx), opts);
+        ctx.reserve(1u + estimate_formatted_size(opts, query.format_str, args));
+        ctx.add(0x03);
+        vformat_sql_to(fmt_ctx, query, args);
+        ctx.add_error(fmt_ctx.error_state());
+    }
+};
+
 class start_execution_algo
 {
     int resume_point_{0};
@@ -72,7 +94,8 @@ class start_execution_algo
         switch (type)
         {
         case any_execution_request::type_t::query:
-        case any_execution_request::type_t::query_with_params: return resultset_encoding::text;
+        case any_execution_request::type_t::query_with_params:
+        case any_execution_request::type_t::query_with_compiled_params: return resultset_encoding::text;
         case any_execution_request::type_t::stmt: return resultset_encoding::binary;
         default: BOOST_ASSERT(false); return resultset_encoding::text;  // LCOV_EXCL_LINE
         }
@@ -94,6 +117,19 @@ class start_execution_algo
         return st.write(query_with_params{data.query, data.args, opts}, seqnum());
     }
 
+    next_action write_query_with_compiled_params(
+        connection_state_data& st,
+        any_execution_request::data_t::query_with_compiled_params_t data
+    )
+    {
+        if (st.current_charset.name == nullptr)
+        {
+            return error_code(client_errc::unknown_character_set);
+        }
+        format_options opts{st.current_charset, st.backslash_escapes};
+        return st.write(query_with_compiled_params{data.query, data.args, opts}, seqnum());
+    }
+
     next_action write_stmt(connection_state_data& st, any_execution_request::data_t::stmt_t data)
     {
         if (data.num_params != data.params.size())
@@ -108,6 +144,8 @@ class start_execution_algo
         case any_execution_request::type_t::query: return st.write(query_command{req_.data.query}, seqnum());
         case any_execution_request::type_t::query_with_params:
             return write_query_with_params(st, req_.data.query_with_params);
+        case any_execution_request::type_t::query_with_compiled_params:
+            return write_query_with_compiled_params(st, req_.data.query_with_compiled_params);
         case any_execution_request::type_t::stmt: return write_stmt(st, req_.data.stmt);
         default: BOOST_ASSERT(false); return next_action();  // LCOV_EXCL_LINE
         }
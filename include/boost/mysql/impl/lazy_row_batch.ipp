@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_LAZY_ROW_BATCH_IPP
+#define BOOST_MYSQL_IMPL_LAZY_ROW_BATCH_IPP
+
+#pragma once
+
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
+
+#include <boost/mysql/detail/throw_on_error_loc.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/deserialization_context.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/span_string.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/text_protocol.hpp>
+
+#include <boost/throw_exception.hpp>
+
+#include <stdexcept>
+
+const boost::mysql::field_view& boost::mysql::lazy_row_batch::decode(std::size_t index) const
+{
+    BOOST_ASSERT(index < impl_.cells.size());
+    if (impl_.decoded[index])
+        return impl_.fields[index];
+
+    const auto& cell = impl_.cells[index];
+    const auto& meta = impl_.meta[index % num_columns()];
+    field_view res;
+    error_code err;
+    if (impl_.encoding == detail::resultset_encoding::binary)
+    {
+        err = detail::binary_cell_to_field_view(cell, meta, res);
+    }
+    else if (!cell.is_null)
+    {
+        err = detail::to_error_code(detail::deserialize_text_field(detail::to_string(cell.data), meta, res));
+    }
+    detail::throw_on_error_loc(err, diagnostics(), BOOST_CURRENT_LOCATION);
+
+    impl_.fields[index] = res;
+    impl_.decoded[index] = 1u;
+    return impl_.fields[index];
+}
+
+boost::mysql::field_view boost::mysql::lazy_row_batch::at(std::size_t row, std::size_t column) const
+{
+    if (row >= size() || column >= num_columns())
+        BOOST_THROW_EXCEPTION(std::out_of_range("lazy_row_batch::at"));
+    return decode(row * num_columns() + column);
+}
+
+boost::mysql::row_view boost::mysql::lazy_row_batch::row(std::size_t i) const
+{
+    if (i >= size())
+        BOOST_THROW_EXCEPTION(std::out_of_range("lazy_row_batch::row"));
+    std::size_t first = i * num_columns();
+    for (std::size_t j = 0; j < num_columns(); ++j)
+        decode(first + j);
+    return detail::access::construct<row_view>(impl_.fields.data() + first, num_columns());
+}
+
+void boost::mysql::lazy_row_batch::decode_rows(std::size_t first_row, std::size_t num_rows) const
+{
+    BOOST_ASSERT(first_row + num_rows <= size());
+
+    // Only touches the cache entries for the given rows, so disjoint ranges can be
+    // decoded concurrently
+    std::size_t first = first_row * num_columns();
+    std::size_t last = first + num_rows * num_columns();
+    for (std::size_t i = first; i < last; ++i)
+        decode(i);
+}
+
+boost::mysql::rows_view boost::mysql::lazy_row_batch::rows() const
+{
+    decode_rows(0u, size());
+    return detail::access::construct<rows_view>(impl_.fields.data(), impl_.fields.size(), num_columns());
+}
+
+#endif
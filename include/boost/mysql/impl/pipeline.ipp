@@ -12,6 +12,7 @@
 
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/param_column.hpp>
 #include <boost/mysql/pipeline.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -24,6 +25,7 @@
 #include <boost/core/span.hpp>
 #include <boost/throw_exception.hpp>
 
+#include <cstddef>
 #include <stdexcept>
 
 boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute(string_view query)
@@ -57,6 +59,53 @@ boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute_rang
     return *this;
 }
 
+boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_execute_columns(
+    statement stmt,
+    span<const param_column> params
+)
+{
+    if (params.size() != stmt.num_params())
+    {
+        BOOST_THROW_EXCEPTION(
+            std::invalid_argument("Wrong number of actual parameters supplied to a prepared statement")
+        );
+    }
+    std::size_t num_rows = params.empty() ? 0u : params[0].size();
+    for (const param_column& param : params)
+    {
+        if (param.size() != num_rows)
+        {
+            BOOST_THROW_EXCEPTION(std::invalid_argument("All param_column objects should have the same size"));
+        }
+    }
+
+    // Several messages are serialized, so we need to undo the partial work if an allocation fails
+    impl_.stages_.reserve(impl_.stages_.size() + num_rows);  // strong guarantee
+    std::size_t initial_buffer_size = impl_.buffer_.size();
+    std::size_t initial_num_stages = impl_.stages_.size();
+    try
+    {
+        for (std::size_t row = 0; row < num_rows; ++row)
+        {
+            impl_.stages_.push_back({
+                detail::pipeline_stage_kind::execute,
+                detail::serialize_top_level_checked(
+                    detail::execute_stmt_columns_command{stmt.id(), params, row},
+                    impl_.buffer_
+                ),
+                detail::resultset_encoding::binary,
+            });
+        }
+    }
+    catch (...)
+    {
+        impl_.buffer_.resize(initial_buffer_size);
+        impl_.stages_.erase(impl_.stages_.begin() + initial_num_stages, impl_.stages_.end());
+        throw;
+    }
+    return *this;
+}
+
 boost::mysql::pipeline_request& boost::mysql::pipeline_request::add_prepare_statement(string_view stmt_sql)
 {
     impl_.stages_.reserve(impl_.stages_.size() + 1);  // strong guarantee
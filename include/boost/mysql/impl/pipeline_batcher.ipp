@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_PIPELINE_BATCHER_IPP
+#define BOOST_MYSQL_IMPL_PIPELINE_BATCHER_IPP
+
+#pragma once
+
+#include <boost/mysql/pipeline_batcher.hpp>
+
+#include <boost/mysql/impl/internal/pipeline_batcher.hpp>
+
+#include <memory>
+
+boost::mysql::pipeline_batcher::pipeline_batcher(any_connection& conn, const pipeline_batcher_params& params)
+    : impl_(std::make_shared<detail::pipeline_batcher_impl>(conn, params))
+{
+}
+
+boost::mysql::pipeline_batcher::executor_type boost::mysql::pipeline_batcher::get_executor() noexcept
+{
+    return impl_->get_executor();
+}
+
+void boost::mysql::pipeline_batcher::async_run_erased(
+    std::shared_ptr<detail::pipeline_batcher_impl> self,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    self->async_run(std::move(handler));
+}
+
+void boost::mysql::pipeline_batcher::async_execute_query_erased(
+    std::shared_ptr<detail::pipeline_batcher_impl> self,
+    string_view query,
+    results* result,
+    diagnostics* diag,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    self->add_query(query, result, diag, std::move(handler));
+}
+
+void boost::mysql::pipeline_batcher::async_execute_statement_erased(
+    std::shared_ptr<detail::pipeline_batcher_impl> self,
+    statement stmt,
+    span<const field_view> params,
+    results* result,
+    diagnostics* diag,
+    asio::any_completion_handler<void(error_code)> handler
+)
+{
+    self->add_statement(stmt, params, result, diag, std::move(handler));
+}
+
+void boost::mysql::pipeline_batcher::cancel() { impl_->cancel(); }
+
+#endif
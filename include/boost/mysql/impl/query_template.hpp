@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_QUERY_TEMPLATE_HPP
+#define BOOST_MYSQL_IMPL_QUERY_TEMPLATE_HPP
+
+#pragma once
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/query_template.hpp>
+
+#include <boost/mysql/detail/any_execution_request.hpp>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+void boost::mysql::format_sql_to(
+    format_context_base& ctx,
+    const query_template& format_str,
+    Formattable&&... args
+)
+{
+    std::initializer_list<format_arg> args_il{
+        {string_view(), std::forward<Formattable>(args)}
+        ...
+    };
+    detail::vformat_sql_to(ctx, format_str.to_ref(), args_il);
+}
+
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::string boost::mysql::format_sql(
+    format_options opts,
+    const query_template& format_str,
+    Formattable&&... args
+)
+{
+    std::initializer_list<format_arg> args_il{
+        {string_view(), std::forward<Formattable>(args)}
+        ...
+    };
+    return format_sql(opts, format_str, args_il);
+}
+
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::size_t boost::mysql::format_sql_size_hint(
+    format_options opts,
+    const query_template& format_str,
+    Formattable&&... args
+)
+{
+    std::initializer_list<format_arg> args_il{
+        {string_view(), std::forward<Formattable>(args)}
+        ...
+    };
+    return detail::vformat_sql_size_hint(opts, format_str.to_ref(), args_il);
+}
+
+// Execution request traits
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <class... T>
+struct execution_request_traits<with_template_params_t<T...>>
+{
+    template <class WithParamsType, std::size_t... I>
+    static compiled_params_proxy<sizeof...(T)> make_request_impl(
+        WithParamsType&& input,
+        mp11::index_sequence<I...>
+    )
+    {
+        boost::ignore_unused(input);  // MSVC gets confused for tuples of size 0
+        // clang-format off
+        return {
+            input.query.to_ref(),
+            {{
+                {
+                    string_view(),
+                    formattable_ref(std::get<I>(std::forward<WithParamsType>(input).args))
+                }...
+            }}
+        };
+        // clang-format on
+    }
+
+    // Allow the value category of the object to be deduced
+    template <class WithParamsType>
+    static compiled_params_proxy<sizeof...(T)> make_request(WithParamsType&& input, std::vector<field_view>&)
+    {
+        return make_request_impl(
+            std::forward<WithParamsType>(input),
+            mp11::make_index_sequence<sizeof...(T)>()
+        );
+    }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_QUERY_TEMPLATE_IPP
+#define BOOST_MYSQL_IMPL_QUERY_TEMPLATE_IPP
+
+#pragma once
+
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/query_template.hpp>
+
+#include <boost/mysql/detail/compiled_format_parser.hpp>
+
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+struct vector_step_writer
+{
+    std::vector<compiled_format_step>& steps;
+
+    void operator()(const compiled_format_step& step) { steps.push_back(step); }
+};
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::query_template::query_template(constant_string_view format_str)
+    : format_str_(format_str.get()), has_non_ascii_(detail::has_non_ascii_chars(format_str.get()))
+{
+    detail::vector_step_writer writer{steps_};
+    detail::parse_compiled_format(format_str_, writer);
+    steps_.shrink_to_fit();
+}
+
+std::string boost::mysql::format_sql(
+    format_options opts,
+    const query_template& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    format_context ctx(opts);
+    format_sql_to(ctx, format_str, args);
+    return std::move(ctx).get().value();
+}
+
+#endif
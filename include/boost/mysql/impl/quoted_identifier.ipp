@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_QUOTED_IDENTIFIER_IPP
+#define BOOST_MYSQL_IMPL_QUOTED_IDENTIFIER_IPP
+
+#pragma once
+
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/quoted_identifier.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/compiled_format_parser.hpp>
+#include <boost/mysql/detail/escape_string.hpp>
+#include <boost/mysql/detail/output_string.hpp>
+
+#include <boost/system/system_error.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <string>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+inline void append_quoted_identifier_part(string_view name, const format_options& opts, std::string& to)
+{
+    to.push_back('`');
+    auto ec = detail::escape_string(name, opts, '`', output_string_ref::create(to));
+    if (ec)
+        BOOST_THROW_EXCEPTION(system::system_error(ec));
+    to.push_back('`');
+}
+
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+boost::mysql::quoted_identifier::quoted_identifier(format_options opts, string_view name)
+    : charset_(opts.charset), has_non_ascii_(detail::has_non_ascii_chars(name))
+{
+    value_.reserve(name.size() + 2u);
+    detail::append_quoted_identifier_part(name, opts, value_);
+}
+
+boost::mysql::quoted_identifier::quoted_identifier(
+    format_options opts,
+    string_view qualifier,
+    string_view name
+)
+    : charset_(opts.charset),
+      has_non_ascii_(detail::has_non_ascii_chars(qualifier) || detail::has_non_ascii_chars(name))
+{
+    value_.reserve(qualifier.size() + name.size() + 5u);
+    detail::append_quoted_identifier_part(qualifier, opts, value_);
+    value_.push_back('.');
+    detail::append_quoted_identifier_part(name, opts, value_);
+}
+
+#endif
@@ -48,6 +48,7 @@ void boost::mysql::detail::results_impl::reset_impl() noexcept
     meta_.clear();
     per_result_.clear();
     info_.clear();
+    session_state_.clear();
     rows_.clear();
     num_fields_at_batch_start_ = no_batch;
 }
@@ -110,10 +111,7 @@ void boost::mysql::detail::results_impl::finish_batch()
 {
     if (has_active_batch())
     {
-        rows_.copy_strings_as_offsets(
-            num_fields_at_batch_start_,
-            rows_.fields().size() - num_fields_at_batch_start_
-        );
+        rows_.copy_strings(num_fields_at_batch_start_, rows_.fields().size() - num_fields_at_batch_start_);
         num_fields_at_batch_start_ = no_batch;
     }
 }
@@ -125,6 +123,7 @@ boost::mysql::detail::per_resultset_data& boost::mysql::detail::results_impl::ad
     resultset_data.meta_offset = meta_.size();
     resultset_data.field_offset = rows_.fields().size();
     resultset_data.info_offset = info_.size();
+    resultset_data.session_state_offset = session_state_.size();
     return resultset_data;
 }
 
@@ -135,14 +134,13 @@ void boost::mysql::detail::results_impl::on_ok_packet_impl(const ok_view& pack)
     resultset_data.last_insert_id = pack.last_insert_id;
     resultset_data.warnings = pack.warnings;
     resultset_data.info_size = pack.info.size();
+    resultset_data.session_state_size = pack.session_state.size();
     resultset_data.has_ok_packet_data = true;
     resultset_data.is_out_params = pack.is_out_params();
     info_.insert(info_.end(), pack.info.begin(), pack.info.end());
+    session_state_.insert(session_state_.end(), pack.session_state.begin(), pack.session_state.end());
     if (!pack.more_results())
-    {
         finish_batch();
-        rows_.offsets_to_string_views();
-    }
 }
 
 #endif
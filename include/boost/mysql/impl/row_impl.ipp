@@ -12,6 +12,8 @@
 
 #include <boost/mysql/detail/row_impl.hpp>
 
+#include <cstring>
+
 namespace boost {
 namespace mysql {
 namespace detail {
@@ -26,113 +28,90 @@ inline std::size_t get_string_size(field_view f)
     }
 }
 
-inline unsigned char* copy_string(unsigned char* buffer_it, field_view& f)
+// Copies the string or blob in f, if any, into the storage, and makes f point to it
+inline void copy_string(row_string_storage& storage, field_view& f)
 {
-    auto str = f.get_string();
-    if (!str.empty())
+    switch (f.kind())
     {
-        std::memcpy(buffer_it, str.data(), str.size());
-        f = field_view(string_view(reinterpret_cast<const char*>(buffer_it), str.size()));
-        buffer_it += str.size();
-    }
-    return buffer_it;
-}
-
-inline unsigned char* copy_blob(unsigned char* buffer_it, field_view& f)
-{
-    auto b = f.get_blob();
-    if (!b.empty())
+    case field_kind::string:
     {
-        std::memcpy(buffer_it, b.data(), b.size());
-        f = field_view(blob_view(buffer_it, b.size()));
-        buffer_it += b.size();
+        auto str = f.get_string();
+        if (!str.empty())
+        {
+            unsigned char* buff = storage.allocate(str.size());
+            std::memcpy(buff, str.data(), str.size());
+            f = field_view(string_view(reinterpret_cast<const char*>(buff), str.size()));
+        }
+        break;
     }
-    return buffer_it;
-}
-
-inline std::size_t copy_string_as_offset(unsigned char* buffer_first, std::size_t offset, field_view& f)
-{
-    auto str = f.get_string();
-    if (!str.empty())
+    case field_kind::blob:
     {
-        std::memcpy(buffer_first + offset, str.data(), str.size());
-        f = detail::access::construct<field_view>(detail::string_view_offset{offset, str.size()}, false);
-        return str.size();
+        auto b = f.get_blob();
+        if (!b.empty())
+        {
+            unsigned char* buff = storage.allocate(b.size());
+            std::memcpy(buff, b.data(), b.size());
+            f = field_view(blob_view(buff, b.size()));
+        }
+        break;
     }
-    return 0;
-}
-
-inline std::size_t copy_blob_as_offset(unsigned char* buffer_first, std::size_t offset, field_view& f)
-{
-    auto str = f.get_blob();
-    if (!str.empty())
-    {
-        std::memcpy(buffer_first + offset, str.data(), str.size());
-        f = detail::access::construct<field_view>(detail::string_view_offset{offset, str.size()}, true);
-        return str.size();
+    default: break;
     }
-    return 0;
 }
 
-inline void copy_strings(std::vector<field_view>& fields, std::vector<unsigned char>& string_buffer)
+// Used when copying complete rows. Strings are placed in a single chunk
+inline void copy_strings(field_vector& fields, row_string_storage& storage)
 {
-    // Calculate the required size for the new strings
     std::size_t size = 0;
     for (auto f : fields)
-    {
         size += get_string_size(f);
-    }
-
-    // Make space. The previous fields should be in offset form
-    string_buffer.resize(string_buffer.size() + size);
-
-    // Copy strings and blobs
-    unsigned char* buffer_it = string_buffer.data();
+    storage.reserve(size);
     for (auto& f : fields)
-    {
-        switch (f.kind())
-        {
-        case field_kind::string: buffer_it = copy_string(buffer_it, f); break;
-        case field_kind::blob: buffer_it = copy_blob(buffer_it, f); break;
-        default: break;
-        }
-    }
-    BOOST_ASSERT(buffer_it == string_buffer.data() + size);
+        copy_string(storage, f);
 }
 
-inline field_view offset_to_string_view(field_view fv, const std::uint8_t* buffer_first)
+}  // namespace detail
+}  // namespace mysql
+}  // namespace boost
+
+void boost::mysql::detail::row_string_storage::add_chunk(std::size_t capacity)
 {
-    auto& impl = detail::access::get_impl(fv);
-    if (impl.is_string_offset())
-    {
-        return field_view(string_view(
-            reinterpret_cast<const char*>(buffer_first) + impl.repr.sv_offset_.offset,
-            impl.repr.sv_offset_.size
-        ));
-    }
-    else if (impl.is_blob_offset())
+    erased_allocator<unsigned char> alloc(full_.get_allocator());
+    if (current_.data)
     {
-        return field_view(blob_view(buffer_first + impl.repr.sv_offset_.offset, impl.repr.sv_offset_.size));
+        // Retire the current chunk. Make space first, so we don't leak if allocate throws
+        full_.reserve(full_.size() + 1u);
+        unsigned char* data = alloc.allocate(capacity);
+        full_.push_back(current_);
+        current_ = chunk{data, capacity};
     }
     else
     {
-        return fv;
+        current_ = chunk{alloc.allocate(capacity), capacity};
     }
+    size_ = 0u;
 }
 
-}  // namespace detail
-}  // namespace mysql
-}  // namespace boost
+void boost::mysql::detail::row_string_storage::deallocate_full_chunks() noexcept
+{
+    erased_allocator<unsigned char> alloc(full_.get_allocator());
+    for (const auto& c : full_)
+        alloc.deallocate(c.data, c.capacity);
+}
 
-boost::mysql::detail::row_impl::row_impl(const field_view* fields, std::size_t size)
-    : fields_(fields, fields + size)
+boost::mysql::detail::row_impl::row_impl(
+    const field_view* fields,
+    std::size_t size,
+    const erased_allocator<char>& alloc
+)
+    : fields_(fields, fields + size, alloc), strings_(alloc)
 {
-    copy_strings(fields_, string_buffer_);
+    ::boost::mysql::detail::copy_strings(fields_, strings_);
 }
 
 boost::mysql::detail::row_impl::row_impl(const row_impl& rhs) : fields_(rhs.fields_)
 {
-    copy_strings(fields_, string_buffer_);
+    ::boost::mysql::detail::copy_strings(fields_, strings_);
 }
 
 boost::mysql::detail::row_impl& boost::mysql::detail::row_impl::operator=(const row_impl& rhs)
@@ -152,47 +131,21 @@ void boost::mysql::detail::row_impl::assign(const field_view* fields, std::size_
     else
     {
         fields_.assign(fields, fields + size);
-        string_buffer_.clear();
-        copy_strings(fields_, string_buffer_);
+        strings_.clear();
+        ::boost::mysql::detail::copy_strings(fields_, strings_);
     }
 }
 
-void boost::mysql::detail::row_impl::copy_strings_as_offsets(std::size_t first, std::size_t num_fields)
+void boost::mysql::detail::row_impl::copy_strings(std::size_t first, std::size_t num_fields)
 {
     // Preconditions
     BOOST_ASSERT(first <= fields_.size());
     BOOST_ASSERT(first + num_fields <= fields_.size());
 
-    // Calculate the required size for the new strings
-    std::size_t size = 0;
-    for (std::size_t i = first; i < first + num_fields; ++i)
-    {
-        size += get_string_size(fields_[i]);
-    }
-
-    // Make space. The previous fields should be in offset form
-    std::size_t old_string_buffer_size = string_buffer_.size();
-    string_buffer_.resize(old_string_buffer_size + size);
-
-    // Copy strings and blobs
-    std::size_t offset = old_string_buffer_size;
+    // Strings are copied in a single pass. Chunks are never reallocated, so
+    // the string_views in previous fields are never invalidated
     for (std::size_t i = first; i < first + num_fields; ++i)
-    {
-        auto& f = fields_[i];
-        switch (f.kind())
-        {
-        case field_kind::string: offset += copy_string_as_offset(string_buffer_.data(), offset, f); break;
-        case field_kind::blob: offset += copy_blob_as_offset(string_buffer_.data(), offset, f); break;
-        default: break;
-        }
-    }
-    BOOST_ASSERT(offset == string_buffer_.size());
-}
-
-void boost::mysql::detail::row_impl::offsets_to_string_views()
-{
-    for (auto& f : fields_)
-        f = offset_to_string_view(f, string_buffer_.data());
+        copy_string(strings_, fields_[i]);
 }
 
 #endif
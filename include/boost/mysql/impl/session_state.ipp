@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_IMPL_SESSION_STATE_IPP
+#define BOOST_MYSQL_IMPL_SESSION_STATE_IPP
+
+#pragma once
+
+#include <boost/mysql/session_state.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/deserialization_context.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/protocol_types.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/span_string.hpp>
+
+#include <boost/core/span.hpp>
+
+#include <cstdint>
+
+const std::uint8_t* boost::mysql::detail::parse_session_state_entry(
+    const std::uint8_t* first,
+    const std::uint8_t* last,
+    session_state_change& output
+) noexcept
+{
+    // Each entry is composed of the type and a length-encoded payload,
+    // whose contents depend on the type
+    int1 type{};
+    string_lenenc data{};
+    deserialization_context ctx(span<const std::uint8_t>(first, last));
+    if (ctx.deserialize(type, data) != deserialize_errc::ok)
+        return nullptr;
+
+    output.type = static_cast<session_track_type>(type.value);
+    output.name = string_view();
+    output.value = string_view();
+
+    // Servers may append fields to the payload in the future, so we don't check for extra bytes
+    deserialization_context data_ctx(to_span(data.value));
+    deserialize_errc err = deserialize_errc::ok;
+    switch (output.type)
+    {
+    case session_track_type::system_variable:
+    {
+        string_lenenc name, value;
+        err = data_ctx.deserialize(name, value);
+        output.name = name.value;
+        output.value = value.value;
+        break;
+    }
+    case session_track_type::gtids:
+    {
+        int1 encoding_spec{};  // always 0
+        string_lenenc gtids;
+        err = data_ctx.deserialize(encoding_spec, gtids);
+        output.value = gtids.value;
+        break;
+    }
+    case session_track_type::schema:
+    case session_track_type::state_change:
+    case session_track_type::transaction_characteristics:
+    case session_track_type::transaction_state:
+    {
+        string_lenenc value;
+        err = value.deserialize(data_ctx);
+        output.value = value.value;
+        break;
+    }
+    default:
+        // Unknown type. Expose the payload as-is
+        output.value = data.value;
+        break;
+    }
+
+    return err == deserialize_errc::ok ? ctx.first() : nullptr;
+}
+
+#endif
@@ -21,6 +21,7 @@ void boost::mysql::detail::static_execution_state_erased_impl::reset_impl() noex
     resultset_index_ = 0;
     ok_data_ = ok_packet_data();
     info_.clear();
+    session_state_.clear();
     meta_.clear();
 }
 
@@ -55,7 +56,13 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     meta_.push_back(create_meta(coldef));
 
     // Record its position
-    pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
+    pos_map_add_field(
+        current_pos_map(),
+        current_name_table(),
+        current_name_index(),
+        meta_index,
+        coldef.name
+    );
 
     return is_last ? meta_check(diag) : error_code();
 }
@@ -71,6 +78,18 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     if (ref.type_index() != ext_.type_index(resultset_index_ - 1))
         return client_errc::row_type_mismatch;
 
+    // Binary rows are parsed directly into the output ref
+    if (encoding() == resultset_encoding::binary)
+    {
+        cells_.resize(meta_.size());
+        auto err = split_binary_row(msg, meta_, cells_.data());
+        if (err)
+            return err;
+        auto fn = ref.is_columnar() ? ext_.columns_direct_parse_fn(resultset_index_ - 1)
+                                    : ext_.direct_parse_fn(resultset_index_ - 1);
+        return fn(current_pos_map(), cells_, meta_, ref);
+    }
+
     // Allocate temporary space
     fields.clear();
     span<field_view> storage = add_fields(fields, meta_.size());
@@ -81,7 +100,9 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
         return err;
 
     // parse it into the output ref
-    err = ext_.parse_fn(resultset_index_ - 1)(current_pos_map(), storage, ref);
+    auto fn = ref.is_columnar() ? ext_.columns_parse_fn(resultset_index_ - 1)
+                                : ext_.parse_fn(resultset_index_ - 1);
+    err = fn(current_pos_map(), storage, ref);
     if (err)
         return err;
 
@@ -100,6 +121,7 @@ void boost::mysql::detail::static_execution_state_erased_impl::on_new_resultset(
     ++resultset_index_;
     ok_data_ = ok_packet_data{};
     info_.clear();
+    session_state_.clear();
     meta_.clear();
     pos_map_reset(current_pos_map());
 }
@@ -114,6 +136,7 @@ boost::mysql::error_code boost::mysql::detail::static_execution_state_erased_imp
     ok_data_.warnings = pack.warnings;
     ok_data_.is_out_params = pack.is_out_params();
     info_.assign(pack.info.begin(), pack.info.end());
+    session_state_.assign(pack.session_state.begin(), pack.session_state.end());
     bool should_be_last = resultset_index_ == ext_.num_resultsets();
     bool is_last = !pack.more_results();
     return should_be_last == is_last ? error_code() : client_errc::num_resultsets_mismatch;
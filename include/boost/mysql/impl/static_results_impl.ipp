@@ -21,6 +21,7 @@ void boost::mysql::detail::static_results_erased_impl::reset_impl() noexcept
 {
     ext_.reset_fn()(ext_.rows());
     info_.clear();
+    session_state_.clear();
     meta_.clear();
     resultset_index_ = 0;
 }
@@ -57,7 +58,13 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_me
     meta_.push_back(create_meta(coldef));
 
     // Fill the pos map entry for this field, if any
-    pos_map_add_field(current_pos_map(), current_name_table(), meta_index, coldef.name);
+    pos_map_add_field(
+        current_pos_map(),
+        current_name_table(),
+        current_name_index(),
+        meta_index,
+        coldef.name
+    );
 
     return is_last ? meta_check(diag) : error_code();
 }
@@ -71,6 +78,17 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_ro
 {
     auto meta = current_resultset_meta();
 
+    // Binary rows are parsed directly into the destination object,
+    // without creating intermediate field_view objects
+    if (encoding() == resultset_encoding::binary)
+    {
+        cells_.resize(meta.size());
+        auto err = split_binary_row(msg, meta, cells_.data());
+        if (err)
+            return err;
+        return ext_.direct_parse_fn(resultset_index_ - 1)(current_pos_map(), cells_, meta, ext_.rows());
+    }
+
     // Allocate temporary storage
     fields.clear();
     span<field_view> storage = add_fields(fields, meta.size());
@@ -99,6 +117,7 @@ boost::mysql::detail::static_per_resultset_data& boost::mysql::detail::static_re
     resultset_data = static_per_resultset_data();
     resultset_data.meta_offset = meta_.size();
     resultset_data.info_offset = info_.size();
+    resultset_data.session_state_offset = session_state_.size();
     pos_map_reset(current_pos_map());
     return resultset_data;
 }
@@ -112,9 +131,11 @@ boost::mysql::error_code boost::mysql::detail::static_results_erased_impl::on_ok
     resultset_data.last_insert_id = pack.last_insert_id;
     resultset_data.warnings = pack.warnings;
     resultset_data.info_size = pack.info.size();
+    resultset_data.session_state_size = pack.session_state.size();
     resultset_data.has_ok_packet_data = true;
     resultset_data.is_out_params = pack.is_out_params();
     info_.insert(info_.end(), pack.info.begin(), pack.info.end());
+    session_state_.insert(session_state_.end(), pack.session_state.begin(), pack.session_state.end());
     bool should_be_last = resultset_index_ == ext_.num_resultsets();
     bool is_last = !pack.more_results();
     return should_be_last == is_last ? error_code() : client_errc::num_resultsets_mismatch;
@@ -0,0 +1,241 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_LAZY_ROW_BATCH_HPP
+#define BOOST_MYSQL_LAZY_ROW_BATCH_HPP
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/row_view.hpp>
+#include <boost/mysql/rows_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+struct lazy_row_batch_impl
+{
+    // The read buffer the rows were read into. Cells point into it
+    std::vector<std::uint8_t> buffer;
+
+    // The bytes of each field, as they appear in the row messages. Not decoded
+    std::vector<binary_cell> cells;
+
+    // Required to decode the cells
+    std::vector<metadata> meta;
+    resultset_encoding encoding{resultset_encoding::text};
+
+    // Decoded fields, populated on first access. decoded[i] != 0 if fields[i] is valid
+    std::vector<field_view> fields;
+    std::vector<unsigned char> decoded;
+
+    void clear() noexcept
+    {
+        cells.clear();
+        meta.clear();
+        fields.clear();
+        decoded.clear();
+    }
+};
+
+}  // namespace detail
+
+/**
+ * \brief A batch of rows whose fields are decoded on first access.
+ * \details
+ * Filled by \ref any_connection::read_some_rows overloads taking a `lazy_row_batch`.
+ * Like \ref row_batch, the region of the connection's read buffer containing the row messages
+ * is handed to the batch, so no strings are copied. Additionally, fields are not decoded
+ * when the rows are read. Rows are just scanned once to record where each field is,
+ * and each field is decoded when it's accessed for the first time. This is useful when only a
+ * few columns of a wide resultset are used, since the cost of parsing numbers and dates
+ * in the text protocol is only paid for the fields that are accessed.
+ * \n
+ * Decoding errors are reported by the accessor functions, rather than by `read_some_rows`.
+ * The framing of each row message is still validated when reading.
+ * \n
+ * Views obtained from this object are valid until the batch is cleared, filled again or destroyed.
+ * They are not affected by further operations on the connection. Moving a batch doesn't
+ * invalidate them, either.
+ * \n
+ * Accessor functions cache decoded fields, so they modify the object's internal state, even
+ * if they are `const`. Concurrent access to the same batch is not safe, even for `const`
+ * functions. The only exception is \ref decode_rows, which can be called concurrently
+ * for disjoint row ranges. This allows decoding large batches using several threads.
+ * \n
+ * This type is move-only.
+ */
+class lazy_row_batch
+{
+public:
+    /**
+     * \brief Constructs an empty batch.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    lazy_row_batch() = default;
+
+    lazy_row_batch(const lazy_row_batch&) = delete;
+    lazy_row_batch& operator=(const lazy_row_batch&) = delete;
+
+    /**
+     * \brief Move constructor.
+     * \details
+     * Views obtained from `other` remain valid, and now point into `*this`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    lazy_row_batch(lazy_row_batch&& other) = default;
+
+    /**
+     * \brief Move assignment.
+     * \details
+     * Views obtained from `other` remain valid, and now point into `*this`.
+     * Views obtained from `*this` are invalidated.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    lazy_row_batch& operator=(lazy_row_batch&& other) = default;
+
+    /// Destructor.
+    ~lazy_row_batch() = default;
+
+    /**
+     * \brief Returns the number of rows in the batch.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return impl_.meta.empty() ? 0u : impl_.cells.size() / num_columns(); }
+
+    /**
+     * \brief Returns whether the batch contains any rows.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return impl_.cells.empty(); }
+
+    /**
+     * \brief Returns the number of fields in each row.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t num_columns() const noexcept { return impl_.meta.size(); }
+
+    /**
+     * \brief Returns the field at the given row and column, decoding it if required.
+     * \details
+     * Only the requested field is decoded. Subsequent calls for the same field return the
+     * cached value.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws `std::out_of_range` if `row >= this->size()` or
+     * `column >= this->num_columns()`. Throws \ref error_with_diagnostics if the field
+     * can't be decoded.
+     *
+     * \par Object lifetimes
+     * The returned view is valid until `*this` is cleared, filled again or destroyed.
+     */
+    BOOST_MYSQL_DECL
+    field_view at(std::size_t row, std::size_t column) const;
+
+    /**
+     * \brief Returns a row, decoding all its fields if required.
+     * \details
+     * Fields that were already decoded are not decoded again.
+     *
+     * \par Exception safety
+     * Basic guarantee. Throws `std::out_of_range` if `i >= this->size()`.
+     * Throws \ref error_with_diagnostics if any of the fields can't be decoded.
+     *
+     * \par Object lifetimes
+     * The returned view is valid until `*this` is cleared, filled again or destroyed.
+     */
+    BOOST_MYSQL_DECL
+    row_view row(std::size_t i) const;
+
+    /**
+     * \brief Decodes all the fields in a range of rows.
+     * \details
+     * Decodes the fields in rows `[first_row, first_row + num_rows)` that haven't been decoded yet.
+     * Subsequent accesses to these rows won't perform any decoding.
+     * \n
+     * This function may be called concurrently from several threads, as long as the ranges
+     * of rows passed to each call don't overlap, and no other function is called on
+     * `*this` at the same time. Use it to split the decoding cost of a large batch
+     * between several threads, while the connection reads the next batch.
+     *
+     * \par Preconditions
+     * `first_row + num_rows <= this->size()`.
+     *
+     * \par Exception safety
+     * Basic guarantee. Throws \ref error_with_diagnostics if any of the fields can't be decoded.
+     */
+    BOOST_MYSQL_DECL
+    void decode_rows(std::size_t first_row, std::size_t num_rows) const;
+
+    /**
+     * \brief Returns a view to all the rows in the batch, decoding them if required.
+     * \details
+     * Fields that were already decoded are not decoded again. If all rows were
+     * decoded using \ref decode_rows, this function doesn't perform any decoding.
+     * The returned view can be used to copy the rows into other containers, like
+     * `boost::mysql::rows` or \ref compact_rows.
+     *
+     * \par Exception safety
+     * Basic guarantee. Throws \ref error_with_diagnostics if any of the fields can't be decoded.
+     *
+     * \par Object lifetimes
+     * The returned view is valid until `*this` is cleared, filled again or destroyed.
+     */
+    BOOST_MYSQL_DECL
+    rows_view rows() const;
+
+    /**
+     * \brief Removes all rows from the batch.
+     * \details
+     * Invalidates any views obtained from `*this`. Memory is kept, so it can be
+     * recycled by the next `read_some_rows` operation.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void clear() noexcept { impl_.clear(); }
+
+private:
+    // Decoding modifies the cache
+    mutable detail::lazy_row_batch_impl impl_;
+
+    BOOST_MYSQL_DECL
+    const field_view& decode(std::size_t index) const;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/lazy_row_batch.ipp>
+#endif
+
+#endif
@@ -14,8 +14,11 @@
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/coldef_view.hpp>
 #include <boost/mysql/detail/flags.hpp>
+#include <boost/mysql/detail/metadata_arena.hpp>
 
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace boost {
 namespace mysql {
@@ -51,9 +54,11 @@ public:
 
     /**
      * \brief Copy constructor.
+     * \details
+     * String data is shared between copies, so copying doesn't allocate.
      *
      * \par Exception safety
-     * Strong guarantee. Internal allocations may throw.
+     * No-throw guarantee.
      */
     metadata(const metadata& other) = default;
 
@@ -71,9 +76,11 @@ public:
 
     /**
      * \brief Copy assignment.
+     * \details
+     * String data is shared between copies, so copying doesn't allocate.
      *
      * \par Exception safety
-     * Basic guarantee. Internal allocations may throw.
+     * No-throw guarantee.
      *
      * \par Object lifetimes
      * `string_view`s obtained by calling accessor functions on `*this`
@@ -265,25 +272,23 @@ public:
     bool is_set_to_now_on_update() const noexcept { return flag_set(detail::column_flags::on_update_now); }
 
 private:
-    std::string schema_;
-    std::string table_;      // virtual table
-    std::string org_table_;  // physical table
-    std::string name_;       // virtual column name
-    std::string org_name_;   // physical column name
-    std::uint16_t character_set_;
-    std::uint32_t column_length_;  // maximum length of the field
-    column_type type_;             // type of the column
-    std::uint16_t flags_;          // Flags as defined in Column Definition Flags
-    std::uint8_t decimals_;        // max shown decimal digits. 0x00 for int/static strings; 0x1f for
-                                   // dynamic strings, double, float
-
-    metadata(const detail::coldef_view& coldef, bool copy_strings)
-        : schema_(copy_strings ? coldef.database : string_view()),
-          table_(copy_strings ? coldef.table : string_view()),
-          org_table_(copy_strings ? coldef.org_table : string_view()),
-          name_(copy_strings ? coldef.name : string_view()),
-          org_name_(copy_strings ? coldef.org_name : string_view()),
-          character_set_(coldef.collation_id),
+    // Keeps alive the memory the string_views below point to.
+    // Shared with the other metadata objects of the resultset
+    detail::metadata_block_ref strings_;
+    string_view schema_;
+    string_view table_;      // virtual table
+    string_view org_table_;  // physical table
+    string_view name_;       // virtual column name
+    string_view org_name_;   // physical column name
+    std::uint16_t character_set_{};
+    std::uint32_t column_length_{};  // maximum length of the field
+    column_type type_{};             // type of the column
+    std::uint16_t flags_{};          // Flags as defined in Column Definition Flags
+    std::uint8_t decimals_{};        // max shown decimal digits. 0x00 for int/static strings; 0x1f for
+                                     // dynamic strings, double, float
+
+    explicit metadata(const detail::coldef_view& coldef) noexcept
+        : character_set_(coldef.collation_id),
           column_length_(coldef.column_length),
           type_(coldef.type),
           flags_(coldef.flags),
@@ -291,6 +296,49 @@ private:
     {
     }
 
+    metadata(const detail::coldef_view& coldef, bool copy_strings, detail::metadata_arena& arena)
+        : metadata(coldef)
+    {
+        if (copy_strings)
+            assign_strings(coldef, arena);
+    }
+
+    // Standalone objects get a block of their own
+    metadata(const detail::coldef_view& coldef, bool copy_strings) : metadata(coldef)
+    {
+        if (copy_strings)
+        {
+            detail::metadata_arena arena;
+            assign_strings(coldef, arena);
+        }
+    }
+
+    // All strings are placed contiguously in the same block, with at most one allocation
+    void assign_strings(const detail::coldef_view& coldef, detail::metadata_arena& arena)
+    {
+        std::size_t size = coldef.database.size() + coldef.table.size() + coldef.org_table.size() +
+                           coldef.name.size() + coldef.org_name.size();
+        if (size == 0u)
+            return;
+        char* ptr = arena.allocate(size);
+        schema_ = copy_string(coldef.database, ptr);
+        table_ = copy_string(coldef.table, ptr);
+        org_table_ = copy_string(coldef.org_table, ptr);
+        name_ = copy_string(coldef.name, ptr);
+        org_name_ = copy_string(coldef.org_name, ptr);
+        strings_ = arena.current_block();
+    }
+
+    static string_view copy_string(string_view from, char*& to) noexcept
+    {
+        if (from.empty())
+            return string_view();
+        std::memcpy(to, from.data(), from.size());
+        string_view res(to, from.size());
+        to += from.size();
+        return res;
+    }
+
     bool flag_set(std::uint16_t flag) const noexcept { return flags_ & flag; }
 
 #ifndef BOOST_MYSQL_DOXYGEN
@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_PARAM_COLUMN_HPP
+#define BOOST_MYSQL_PARAM_COLUMN_HPP
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief (EXPERIMENTAL) A column of prepared statement parameters (structure of arrays).
+ * \details
+ * References a typed array of values, to be used as the actual parameter of a statement
+ * for several executions. Pass a collection of these to \ref pipeline_request::add_execute_columns
+ * to execute a statement once per row, serializing values directly from the arrays,
+ * without creating intermediate \ref field_view objects.
+ * \n
+ * Columns can optionally have a NULL bitmap, containing a bit per value: if the bit for
+ * row `r` is set, the parameter is sent as NULL, and the `r`-th value is ignored.
+ * Bits are numbered starting from the least significant bit of the first byte.
+ * If the bitmap is empty, no value is NULL.
+ * \n
+ * This is a view type: it doesn't own the memory it references.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class param_column
+{
+public:
+    /**
+     * \brief Constructs a column of signed integers.
+     * \details
+     * If not empty, `null_bitmap` should have space for a bit per value.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The memory referenced by `values` and `null_bitmap` must be kept alive while `*this` is used.
+     */
+    param_column(span<const std::int64_t> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::int64, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const std::uint64_t> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::uint64, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const float> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::float_, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const double> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::double_, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const string_view> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::string, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const blob_view> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::blob, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const date> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::date, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const datetime> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::datetime, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /// \copydoc param_column(span<const std::int64_t>,span<const unsigned char>)
+    param_column(span<const time> values, span<const unsigned char> null_bitmap = {}) noexcept
+        : param_column(field_kind::time, values.data(), values.size(), null_bitmap)
+    {
+    }
+
+    /**
+     * \brief Returns the type of the values in the column.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    field_kind kind() const noexcept { return impl_.kind; }
+
+    /**
+     * \brief Returns the number of values in the column.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept { return impl_.size; }
+
+    /**
+     * \brief Returns whether the value at the given row is NULL.
+     * \details
+     * Always returns `false` if the column doesn't have a NULL bitmap.
+     *
+     * \par Preconditions
+     * `row < this->size()`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_null(std::size_t row) const noexcept
+    {
+        BOOST_ASSERT(row < impl_.size);
+        return impl_.null_bitmap != nullptr && ((impl_.null_bitmap[row / 8u] >> (row % 8u)) & 1u);
+    }
+
+private:
+    struct impl_t
+    {
+        field_kind kind;
+        const void* data;
+        std::size_t size;
+        const unsigned char* null_bitmap;  // nullptr if not supplied
+    } impl_;
+
+    param_column(
+        field_kind kind,
+        const void* data,
+        std::size_t size,
+        span<const unsigned char> null_bitmap
+    ) noexcept
+        : impl_{kind, data, size, null_bitmap.empty() ? nullptr : null_bitmap.data()}
+    {
+        BOOST_ASSERT(null_bitmap.empty() || null_bitmap.size() * 8u >= size);
+    }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -12,6 +12,7 @@
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/param_column.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/statement.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -350,6 +351,32 @@ public:
     BOOST_MYSQL_DECL
     pipeline_request& add_execute_range(statement stmt, span<const field_view> params);
 
+    /**
+     * \brief Adds stages that execute a prepared statement once per row of a set of columns.
+     * \details
+     * `params` contains a column per statement parameter, all with the same number of rows.
+     * For each row `r`, creates a stage that runs `stmt` bound to the `r`-th value of each column.
+     * The effect is equivalent to calling \ref add_execute_range once per row,
+     * but values are serialized directly from the columns, without creating
+     * intermediate \ref field_view objects. If the columns are empty, no stage is added.
+     *
+     * \par Exception safety
+     * Strong guarantee. Throws if the number of columns doesn't match the number
+     * of parameters expected by the statement, or if the columns have different sizes.
+     * Additionally, memory allocations may throw.
+     * \throws std::invalid_argument If `params.size() != stmt.num_params()`, or if
+     *         the columns have different sizes.
+     *
+     * \par Preconditions
+     * The passed statement should be valid (`stmt.valid() == true`).
+     *
+     * \par Object lifetimes
+     * The values referenced by `params` are copied into the request and
+     * need not be kept alive after this function returns.
+     */
+    BOOST_MYSQL_DECL
+    pipeline_request& add_execute_columns(statement stmt, span<const param_column> params);
+
     /**
      * \brief Adds a prepare statement stage.
      * \details
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_PIPELINE_BATCHER_HPP
+#define BOOST_MYSQL_PIPELINE_BATCHER_HPP
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/results.hpp>
+#include <boost/mysql/statement.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/with_diagnostics.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/initiation_base.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/core/span.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+class pipeline_batcher_impl;
+}
+
+/**
+ * \brief (EXPERIMENTAL) Configuration parameters for \ref pipeline_batcher.
+ */
+struct pipeline_batcher_params
+{
+    /**
+     * \brief The maximum number of requests sent together in a single pipeline.
+     * \details
+     * Once this many requests are waiting, they are sent without waiting for
+     * \ref batch_window to elapse. Requests above this limit are sent in subsequent pipelines.
+     * Must be greater than zero.
+     */
+    std::size_t max_batch_size{64};
+
+    /**
+     * \brief How long to wait for more requests before sending a pipeline.
+     * \details
+     * Measured from the moment the first request of a pipeline is submitted.
+     * Longer windows increase batching, at the expense of latency.
+     * If zero, requests are sent as soon as the batcher gets to run, which still
+     * coalesces all the requests submitted within the same executor turn.
+     */
+    std::chrono::steady_clock::duration batch_window{};
+};
+
+/**
+ * \brief (EXPERIMENTAL) Coalesces independent executions into pipelines.
+ * \details
+ * Gathers the executions submitted using \ref async_execute by independent tasks
+ * and sends them to the server using a single pipeline, running on a single connection.
+ * When the pipeline completes, each submitter receives its own results.
+ * Under fan-out workloads, this turns many network round-trips into a single one.
+ * \n
+ * This is an opt-in front-end over \ref any_connection::async_run_pipeline. Batching is
+ * performed by a long-running task, launched by calling \ref async_run.
+ * Requests may be submitted before calling \ref async_run. They will be queued until the batcher runs.
+ * \n
+ * Requests in a batch are independent: a request failing with a non-fatal error (like a syntax error)
+ * doesn't affect the others. If a fatal error (like a network error) happens, \ref async_run
+ * completes with the error, and the requests in the current batch and all the queued requests
+ * fail with it. The connection should then be re-established before running the batcher again.
+ *
+ * \par Thread safety
+ * This class is not thread-safe. All functions must be called, and all operations
+ * must be run from the connection's executor (or a strand wrapping it).
+ *
+ * \par Object lifetimes
+ * The connection passed to the constructor must be kept alive until the batcher and
+ * any outstanding operations are destroyed. The connection shouldn't be used
+ * by other code while the batcher is running.
+ *
+ * \par Experimental
+ * This part of the API is experimental, and may change in successive
+ * releases without previous notice.
+ */
+class pipeline_batcher
+{
+    std::shared_ptr<detail::pipeline_batcher_impl> impl_;
+
+    struct initiate_run : detail::initiation_base
+    {
+        using detail::initiation_base::initiation_base;
+
+        // Having diagnostics* here makes async_run compatible with with_diagnostics
+        template <class Handler>
+        void operator()(Handler&& h, diagnostics*, std::shared_ptr<detail::pipeline_batcher_impl> self)
+        {
+            async_run_erased(std::move(self), std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_run_erased(
+        std::shared_ptr<detail::pipeline_batcher_impl> self,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+    struct initiate_execute_query : detail::initiation_base
+    {
+        using detail::initiation_base::initiation_base;
+
+        template <class Handler>
+        void operator()(
+            Handler&& h,
+            diagnostics* diag,
+            std::shared_ptr<detail::pipeline_batcher_impl> self,
+            string_view query,
+            results* result
+        )
+        {
+            async_execute_query_erased(std::move(self), query, result, diag, std::forward<Handler>(h));
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_execute_query_erased(
+        std::shared_ptr<detail::pipeline_batcher_impl> self,
+        string_view query,
+        results* result,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+    struct initiate_execute_statement : detail::initiation_base
+    {
+        using detail::initiation_base::initiation_base;
+
+        template <class Handler>
+        void operator()(
+            Handler&& h,
+            diagnostics* diag,
+            std::shared_ptr<detail::pipeline_batcher_impl> self,
+            statement stmt,
+            span<const field_view> params,
+            results* result
+        )
+        {
+            async_execute_statement_erased(
+                std::move(self),
+                stmt,
+                params,
+                result,
+                diag,
+                std::forward<Handler>(h)
+            );
+        }
+    };
+
+    BOOST_MYSQL_DECL
+    static void async_execute_statement_erased(
+        std::shared_ptr<detail::pipeline_batcher_impl> self,
+        statement stmt,
+        span<const field_view> params,
+        results* result,
+        diagnostics* diag,
+        asio::any_completion_handler<void(error_code)> handler
+    );
+
+public:
+    /**
+     * \brief Constructs a batcher that will send requests using `conn`.
+     * \details
+     * The connection should be connected before calling \ref async_run.
+     *
+     * \par Preconditions
+     * `params.max_batch_size > 0`
+     *
+     * \par Exception safety
+     * Strong guarantee. Exceptions may be thrown by memory allocations.
+     */
+    BOOST_MYSQL_DECL
+    pipeline_batcher(any_connection& conn, const pipeline_batcher_params& params = {});
+
+    /// The executor type associated to this object.
+    using executor_type = asio::any_io_executor;
+
+    /**
+     * \brief Retrieves the executor associated to this object.
+     * \details Returns the connection's executor.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    BOOST_MYSQL_DECL
+    executor_type get_executor() noexcept;
+
+    /**
+     * \brief Runs the batcher task.
+     * \details
+     * Waits for requests to be submitted, groups them in batches and sends them to the server.
+     * This operation runs until \ref cancel is called, or a fatal error is encountered.
+     * In the first case, the operation completes successfully, and any request
+     * that hadn't been sent yet fails with `asio::error::operation_aborted`.
+     * \n
+     * At most one `async_run` operation can be outstanding at any given time.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_run(CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            std::declval<initiate_run>(),
+            token,
+            static_cast<diagnostics*>(nullptr),
+            impl_
+        )))
+    {
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_run{get_executor()},
+            token,
+            static_cast<diagnostics*>(nullptr),
+            impl_
+        );
+    }
+
+    /**
+     * \brief Submits a text query for execution in the next batch.
+     * \details
+     * The query is serialized when the operation is initiated, so `query` only needs to be
+     * valid until then. The operation completes once the batch containing the query
+     * has been executed. `result` is then populated with the query's results,
+     * and `diag` with any server-supplied diagnostics.
+     *
+     * \par Object lifetimes
+     * `result` and `diag` must be kept alive until the operation completes.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Per-operation cancellation
+     * This operation doesn't support per-operation cancellation. Use \ref cancel
+     * to stop the batcher instead.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_execute(string_view query, results& result, diagnostics& diag, CompletionToken&& token = {})
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            std::declval<initiate_execute_query>(),
+            token,
+            &diag,
+            impl_,
+            query,
+            &result
+        )))
+    {
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute_query{get_executor()},
+            token,
+            &diag,
+            impl_,
+            query,
+            &result
+        );
+    }
+
+    /**
+     * \brief Submits a prepared statement for execution in the next batch.
+     * \details
+     * Like the text query overload, but executes `stmt` with the parameters in `params`.
+     * Parameters are serialized when the operation is initiated, so the objects pointed
+     * by `params` only need to be valid until then.
+     *
+     * \par Object lifetimes
+     * `result` and `diag` must be kept alive until the operation completes.
+     *
+     * \par Exceptions
+     * Throws `std::invalid_argument` at initiation if `params.size() != stmt.num_params()`.
+     *
+     * \par Handler signature
+     * The handler signature for this operation is `void(boost::mysql::error_code)`.
+     *
+     * \par Per-operation cancellation
+     * This operation doesn't support per-operation cancellation. Use \ref cancel
+     * to stop the batcher instead.
+     */
+    template <
+        BOOST_ASIO_COMPLETION_TOKEN_FOR(void(::boost::mysql::error_code))
+            CompletionToken = with_diagnostics_t<asio::deferred_t>>
+    auto async_execute(
+        statement stmt,
+        span<const field_view> params,
+        results& result,
+        diagnostics& diag,
+        CompletionToken&& token = {}
+    )
+        BOOST_MYSQL_RETURN_TYPE(decltype(asio::async_initiate<CompletionToken, void(error_code)>(
+            std::declval<initiate_execute_statement>(),
+            token,
+            &diag,
+            impl_,
+            stmt,
+            params,
+            &result
+        )))
+    {
+        return asio::async_initiate<CompletionToken, void(error_code)>(
+            initiate_execute_statement{get_executor()},
+            token,
+            &diag,
+            impl_,
+            stmt,
+            params,
+            &result
+        );
+    }
+
+    /**
+     * \brief Stops the batcher.
+     * \details
+     * Causes the outstanding \ref async_run operation to complete once the batch
+     * currently being executed (if any) completes. Requests that haven't been sent yet
+     * fail with `asio::error::operation_aborted`. If the batcher is not running,
+     * any queued request fails immediately.
+     *
+     * \par Exception safety
+     * Basic guarantee. Memory allocations may throw.
+     */
+    BOOST_MYSQL_DECL
+    void cancel();
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/pipeline_batcher.ipp>
+#endif
+
+#endif
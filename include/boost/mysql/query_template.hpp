@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_QUERY_TEMPLATE_HPP
+#define BOOST_MYSQL_QUERY_TEMPLATE_HPP
+
+#include <boost/mysql/constant_string_view.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/with_params.hpp>
+
+#include <boost/mysql/detail/compiled_format_ref.hpp>
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/format_sql.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A format string parsed once at runtime, to be formatted many times.
+ * \details
+ * Stores a copy of a format string, as accepted by \ref format_sql, split into a sequence of
+ * literal segments and argument slots. Formatting with a `query_template` appends the cached
+ * segments and formats the arguments, without parsing the format string again.
+ * Use it for queries that are built at runtime (e.g. a multi-row `INSERT` with a
+ * runtime-determined number of rows) and executed many times. For format strings known
+ * at compile time, \ref compiled_format is usually more convenient.
+ * \n
+ * Query templates can be used with \ref format_sql, \ref format_sql_to and \ref with_params.
+ * When passed to \ref with_params and executed, the literal segments and the formatted arguments
+ * are written directly into the connection's write buffer.
+ * Formatting produces the same output and errors as the equivalent format string,
+ * except for format string syntax errors, which are reported by the constructor.
+ * \n
+ * As with \ref compiled_format, format strings containing non-ASCII characters
+ * are not split by the constructor. They're parsed when formatting, using the character set in use.
+ * \n
+ * Copying and moving a `query_template` is safe, since segments are stored as offsets.
+ */
+class query_template
+{
+    std::string format_str_;
+    std::vector<detail::compiled_format_step> steps_;
+    bool has_non_ascii_{};
+
+public:
+    /**
+     * \brief Parses a format string.
+     * \details
+     * `format_str` is copied into the object.
+     * \n
+     * As with \ref format_sql, format strings must be known at compile time, to prevent
+     * SQL injection. If your format string is composed at runtime (e.g. a multi-row `INSERT`
+     * with a variable number of rows), make sure it doesn't contain untrusted input,
+     * and wrap it using \ref runtime.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw. Throws `boost::system::system_error` with
+     * one of the following codes if `format_str` is not a valid format string: \n
+     *   \li \ref client_errc::format_string_invalid_syntax if `format_str` can't be parsed.
+     *   \li \ref client_errc::format_string_manual_auto_mix if `format_str` contains a mix of automatic
+     *       (`{}`) and manual indexed (`{1}`) replacement fields.
+     */
+    BOOST_MYSQL_DECL
+    explicit query_template(constant_string_view format_str);
+
+    /**
+     * \brief Returns the format string this object was created from.
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view is valid until `*this` is modified or destroyed.
+     */
+    string_view format_string() const noexcept { return format_str_; }
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    detail::compiled_format_ref to_ref() const noexcept { return {format_str_, steps_, has_non_ascii_}; }
+#endif
+};
+
+/**
+ * \brief Composes a SQL query client-side using a query template.
+ * \details
+ * Behaves like the \ref format_sql_to overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Basic guarantee. Memory allocations may throw.
+ *
+ * \par Errors
+ * The same as the overload taking a \ref constant_string_view. Syntax errors in the format string
+ * are detected by the \ref query_template constructor, instead.
+ */
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+void format_sql_to(format_context_base& ctx, const query_template& format_str, Formattable&&... args);
+
+/**
+ * \copydoc format_sql_to(format_context_base&,const query_template&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+inline void format_sql_to(
+    format_context_base& ctx,
+    const query_template& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    detail::vformat_sql_to(ctx, format_str.to_ref(), args);
+}
+
+/**
+ * \brief Composes a SQL query client-side using a query template.
+ * \details
+ * Behaves like the \ref format_sql overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Strong guarantee. Memory allocations may throw. `boost::system::system_error` is thrown if an error
+ * is found while formatting.
+ *
+ * \par Errors
+ * The same as the overload taking a \ref constant_string_view. Syntax errors in the format string
+ * are detected by the \ref query_template constructor, instead.
+ */
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::string format_sql(format_options opts, const query_template& format_str, Formattable&&... args);
+
+/**
+ * \copydoc format_sql(format_options,const query_template&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+BOOST_MYSQL_DECL
+std::string format_sql(
+    format_options opts,
+    const query_template& format_str,
+    std::initializer_list<format_arg> args
+);
+
+/**
+ * \brief Computes an upper bound for the size of a SQL query composed using a query template.
+ * \details
+ * Behaves like the \ref format_sql_size_hint overload taking a \ref constant_string_view,
+ * but doesn't parse the format string.
+ *
+ * \par Exception safety
+ * Basic guarantee. Exceptions thrown by custom formatters are propagated.
+ */
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+std::size_t format_sql_size_hint(
+    format_options opts,
+    const query_template& format_str,
+    Formattable&&... args
+);
+
+/**
+ * \copydoc format_sql_size_hint(format_options,const query_template&,Formattable&&...)
+ * \details
+ * \n
+ * This overload allows using named arguments.
+ */
+inline std::size_t format_sql_size_hint(
+    format_options opts,
+    const query_template& format_str,
+    std::initializer_list<format_arg> args
+)
+{
+    return detail::vformat_sql_size_hint(opts, format_str.to_ref(), args);
+}
+
+/**
+ * \brief A query template and format arguments that can be executed.
+ * \details
+ * Like \ref with_params_t, but using a \ref query_template. Satisfies `ExecutionRequest`.
+ * When executed, the query is generated as if \ref format_sql was called with the query template
+ * and the connection's current format options. The literal segments of the template
+ * and the formatted arguments are written directly into the connection's write buffer.
+ * \n
+ * Objects of this type are usually created using \ref with_params.
+ *
+ * \par Object lifetimes
+ * The query template is stored by reference, to avoid copying it on every execution.
+ * It must be kept alive until the operation using `*this` completes. `args` has the same
+ * semantics as in \ref with_params_t.
+ *
+ * \par Errors
+ * The same as \ref with_params_t.
+ */
+template <BOOST_MYSQL_FORMATTABLE... Formattable>
+struct with_template_params_t
+{
+    /// The query template to be expanded and executed.
+    const query_template& query;
+
+    /// The arguments to use to expand the query.
+    std::tuple<Formattable...> args;
+};
+
+/**
+ * \brief Creates a query with parameters from a query template.
+ * \details
+ * Creates a \ref with_template_params_t object by packing the supplied arguments into a tuple,
+ * with the same semantics as the \ref with_params overload taking a \ref constant_string_view.
+ * `query` is stored by reference.
+ *
+ * \par Exception safety
+ * Strong guarantee. Any exception thrown when copying `args` will be propagated.
+ *
+ * \par Object lifetimes
+ * `query` must be kept alive until the operation using the returned object completes.
+ */
+template <class... FormattableOrRefWrapper>
+auto with_params(const query_template& query, FormattableOrRefWrapper&&... args)
+    -> with_template_params_t<make_tuple_element_t<FormattableOrRefWrapper>...>
+{
+    return {query, std::make_tuple(std::forward<FormattableOrRefWrapper>(args)...)};
+}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+// The returned object would reference a temporary
+template <class... FormattableOrRefWrapper>
+void with_params(query_template&& query, FormattableOrRefWrapper&&... args) = delete;
+#endif
+
+}  // namespace mysql
+}  // namespace boost
+
+#include <boost/mysql/impl/query_template.hpp>
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/query_template.ipp>
+#endif
+
+#endif
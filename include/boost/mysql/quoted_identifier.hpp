@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_QUOTED_IDENTIFIER_HPP
+#define BOOST_MYSQL_QUOTED_IDENTIFIER_HPP
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/constant_string_view.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+
+#include <string>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A SQL identifier, quoted and escaped once, to be formatted many times.
+ * \details
+ * Stores an identifier (like a table or column name) in its quoted form
+ * (e.g. `` `my``table` ``), as generated by the `{:i}` format specifier.
+ * Escaping is performed by the constructor, so formatting a `quoted_identifier`
+ * just copies the stored string. Use it for identifiers that are formatted many times,
+ * like the column names used by dynamic filters.
+ * \n
+ * A `quoted_identifier` can be passed to \ref format_sql, \ref format_sql_to and
+ * \ref format_context_base::append_value like any other formattable type. It doesn't
+ * accept any format specifiers.
+ * \n
+ * Escaping depends on the character set. If the identifier contains non-ASCII characters,
+ * formatting it using a character set other than the one it was created with
+ * fails with \ref client_errc::invalid_encoding.
+ * Identifiers containing only ASCII characters can be used with any character set.
+ */
+class quoted_identifier
+{
+    std::string value_;
+    character_set charset_;
+    bool has_non_ascii_;
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct formatter<quoted_identifier>;
+#endif
+
+public:
+    /**
+     * \brief Quotes and escapes an unqualified identifier.
+     * \details
+     * The resulting identifier is formatted as if `name` was passed to \ref format_sql
+     * using the `{:i}` specifier and `opts`.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw. Throws `boost::system::system_error` with
+     * \ref client_errc::invalid_encoding if `name` contains byte sequences that can't be decoded
+     * with `opts.charset`.
+     */
+    BOOST_MYSQL_DECL
+    quoted_identifier(format_options opts, string_view name);
+
+    /**
+     * \brief Quotes and escapes a qualified identifier.
+     * \details
+     * The resulting identifier has the form `` `qualifier`.`name` ``.
+     * Use it for column names qualified by table names, or table names qualified by database names.
+     *
+     * \par Exception safety
+     * Strong guarantee. Memory allocations may throw. Throws `boost::system::system_error` with
+     * \ref client_errc::invalid_encoding if `qualifier` or `name` contain byte sequences
+     * that can't be decoded with `opts.charset`.
+     */
+    BOOST_MYSQL_DECL
+    quoted_identifier(format_options opts, string_view qualifier, string_view name);
+
+    /**
+     * \brief Returns the quoted identifier, including the enclosing backticks.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view is valid until `*this` is modified or destroyed.
+     */
+    string_view str() const noexcept { return value_; }
+};
+
+template <>
+struct formatter<quoted_identifier>
+{
+    const char* parse(const char* begin, const char*) { return begin; }
+
+    void format(const quoted_identifier& value, format_context_base& ctx) const
+    {
+        // Backticks within multi-byte characters are not escaped, so the escaped
+        // string is only valid for the character set used to create it
+        if (value.has_non_ascii_ && ctx.format_opts().charset.next_char != value.charset_.next_char)
+            ctx.add_error(client_errc::invalid_encoding);
+        else
+            ctx.append_raw(runtime(value.value_));
+    }
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/quoted_identifier.ipp>
+#endif
+
+#endif
@@ -12,9 +12,11 @@
 #include <boost/mysql/resultset.hpp>
 #include <boost/mysql/resultset_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/results_impl.hpp>
 #include <boost/mysql/detail/results_iterator.hpp>
 
@@ -22,6 +24,7 @@
 #include <boost/throw_exception.hpp>
 
 #include <stdexcept>
+#include <type_traits>
 
 namespace boost {
 namespace mysql {
@@ -77,6 +80,36 @@ public:
      */
     results() = default;
 
+    /**
+     * \brief Constructs an empty results object that allocates memory using `alloc`.
+     * \details
+     * Rows, metadata and any other data read into this object are allocated using a copy of `alloc`.
+     * This allows using per-request arenas, like `std::pmr::monotonic_buffer_resource`.
+     * The constructed object has `this->has_value() == false`.
+     * \n
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    explicit results(const Allocator& alloc) noexcept : impl_(detail::erased_allocator<char>(alloc))
+    {
+    }
+
     /**
      * \brief Copy constructor.
      * \par Exception safety
@@ -283,6 +316,40 @@ public:
         return impl_.get_info(0);
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     * \n
+     * For operations returning more than one resultset, returns the
+     * first resultset's session state changes.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_state_view session_state() const noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return impl_.get_session_state(0);
+    }
+
     /**
      * \brief Returns an iterator pointing to the first resultset that this object contains.
      * \par Preconditions
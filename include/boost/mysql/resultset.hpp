@@ -13,7 +13,9 @@
 #include <boost/mysql/resultset_view.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows.hpp>
+#include <boost/mysql/session_state.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/config.hpp>
 
 #include <boost/assert.hpp>
@@ -263,6 +265,36 @@ public:
         return string_view(info_.data(), info_.size());
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view is valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_state_view session_state() const noexcept
+    {
+        BOOST_ASSERT(has_value_);
+        return detail::access::construct<session_state_view>(span<const std::uint8_t>(session_state_));
+    }
+
     /**
      * \brief Returns whether this resultset represents a procedure OUT params.
      * \par Preconditions
@@ -288,6 +320,7 @@ private:
     std::uint64_t last_insert_id_{};
     std::uint16_t warnings_{};
     std::vector<char> info_;
+    std::vector<std::uint8_t> session_state_;
     bool is_out_params_{false};
 
     BOOST_MYSQL_DECL
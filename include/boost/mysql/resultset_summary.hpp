@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_RESULTSET_SUMMARY_HPP
+#define BOOST_MYSQL_RESULTSET_SUMMARY_HPP
+
+#include <boost/mysql/session_state.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/ok_view.hpp>
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief The information sent by the server once a resultset has been fully read.
+ * \details
+ * Objects of this type are passed to the visitor supplied to \ref any_connection::execute_each
+ * when a resultset ends. They don't own the data they point to: the object and any
+ * reference obtained from it are only valid during the visitor call they are passed to.
+ */
+class resultset_summary
+{
+public:
+    /**
+     * \brief Returns the number of affected rows for this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t affected_rows() const noexcept { return impl_.affected_rows; }
+
+    /**
+     * \brief Returns the last insert ID for this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::uint64_t last_insert_id() const noexcept { return impl_.last_insert_id; }
+
+    /**
+     * \brief Returns the number of warnings for this resultset.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    unsigned warning_count() const noexcept { return impl_.warnings; }
+
+    /**
+     * \brief Returns additional information for this resultset.
+     * \details
+     * The format of this information is documented by MySQL <a
+     * href="https://dev.mysql.com/doc/c-api/8.0/en/mysql-info.html">here</a>.
+     * \n
+     * The returned string always uses ASCII encoding, regardless of the connection's character set.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    string_view info() const noexcept { return impl_.info; }
+
+    /**
+     * \brief Returns whether this resultset represents a procedure OUT params.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool is_out_params() const noexcept { return impl_.is_out_params(); }
+
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    session_state_view session_state() const noexcept
+    {
+        return detail::access::construct<session_state_view>(impl_.session_state);
+    }
+
+private:
+    detail::ok_view impl_;
+
+    resultset_summary(const detail::ok_view& ok) noexcept : impl_(ok) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
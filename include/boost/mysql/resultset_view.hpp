@@ -10,6 +10,7 @@
 
 #include <boost/mysql/metadata_collection_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_state.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/execution_processor/results_impl.hpp>
@@ -169,6 +170,35 @@ public:
         return impl_->get_info(index_);
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server for this resultset.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * The returned view is valid as long as the object that `*this` points to is alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    session_state_view session_state() const noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return impl_->get_session_state(index_);
+    }
+
     /**
      * \brief Returns whether this resultset represents a procedure OUT params.
      * \par Preconditions
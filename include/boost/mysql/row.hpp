@@ -12,9 +12,11 @@
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/row_view.hpp>
 
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/row_impl.hpp>
 
 #include <cstddef>
+#include <type_traits>
 #include <vector>
 
 namespace boost {
@@ -134,6 +136,61 @@ public:
      */
     ~row() = default;
 
+    /**
+     * \brief Constructs an empty object that allocates memory using `alloc`.
+     * \details
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    explicit row(const Allocator& alloc) noexcept : impl_(detail::erased_allocator<char>(alloc))
+    {
+    }
+
+    /**
+     * \brief Creates a row object from a view, allocating memory using `alloc`.
+     * \details
+     * Copies the fields pointed to by `r`, using a copy of `alloc` to allocate memory.
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * Strong guarantee. Exceptions may be thrown by `alloc`.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     * `*this` lifetime will be independent of `r`'s (the contents of `r` will be copied).
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    row(row_view r, const Allocator& alloc)
+        : impl_(r.begin(), r.size(), detail::erased_allocator<char>(alloc))
+    {
+    }
+
     /**
      * \brief Constructs a row from a \ref row_view.
      * \par Exception safety
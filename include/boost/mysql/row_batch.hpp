@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_ROW_BATCH_HPP
+#define BOOST_MYSQL_ROW_BATCH_HPP
+
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/rows_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+struct row_batch_impl
+{
+    // The read buffer the rows were parsed from. Strings and blobs point into it
+    std::vector<std::uint8_t> buffer;
+
+    // The fields that make up the rows
+    std::vector<field_view> fields;
+
+    std::size_t num_columns{};
+};
+
+}  // namespace detail
+
+/**
+ * \brief A batch of rows that borrows its strings from the connection's read buffer.
+ * \details
+ * Filled by \ref any_connection::read_some_rows overloads taking a `row_batch`.
+ * When reading into a `row_batch`, the connection hands the region of its read buffer
+ * containing the row messages to the batch, instead of copying them. String and blob
+ * fields point directly into the row messages, as received from the server.
+ * The connection continues reading using a different buffer.
+ * \n
+ * Views obtained by calling \ref rows, and any \ref row_view or \ref field_view obtained from them,
+ * are valid until the batch is cleared, filled again or destroyed.
+ * They are not affected by further operations on the connection, or by the connection being
+ * destroyed. Moving a batch doesn't invalidate them, either.
+ * \n
+ * Memory is recycled: passing a batch to `read_some_rows` invalidates its contents and gives
+ * its previous buffer back to the connection. Reading in a loop into the same batch
+ * doesn't allocate after the first iteration.
+ * \n
+ * This type is move-only.
+ */
+class row_batch
+{
+public:
+    /**
+     * \brief Constructs an empty batch.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    row_batch() = default;
+
+    row_batch(const row_batch&) = delete;
+    row_batch& operator=(const row_batch&) = delete;
+
+    /**
+     * \brief Move constructor.
+     * \details
+     * Views obtained from `other` remain valid, and now point into `*this`.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    row_batch(row_batch&& other) = default;
+
+    /**
+     * \brief Move assignment.
+     * \details
+     * Views obtained from `other` remain valid, and now point into `*this`.
+     * Views obtained from `*this` are invalidated.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    row_batch& operator=(row_batch&& other) = default;
+
+    /// Destructor.
+    ~row_batch() = default;
+
+    /**
+     * \brief Returns a view to the rows in the batch.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    rows_view rows() const noexcept
+    {
+        return detail::access::construct<rows_view>(
+            impl_.fields.data(),
+            impl_.fields.size(),
+            impl_.num_columns
+        );
+    }
+
+    /**
+     * \brief Returns the number of rows in the batch.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    std::size_t size() const noexcept
+    {
+        return impl_.num_columns ? impl_.fields.size() / impl_.num_columns : 0u;
+    }
+
+    /**
+     * \brief Returns whether the batch contains any rows.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return impl_.fields.empty(); }
+
+    /**
+     * \brief Removes all rows from the batch.
+     * \details
+     * Invalidates any views obtained from `*this`. Memory is kept, so it can be
+     * recycled by the next `read_some_rows` operation.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    void clear() noexcept
+    {
+        impl_.fields.clear();
+        impl_.num_columns = 0u;
+    }
+
+private:
+    detail::row_batch_impl impl_;
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#endif
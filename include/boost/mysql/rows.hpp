@@ -13,12 +13,14 @@
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows_view.hpp>
 
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/row_impl.hpp>
 #include <boost/mysql/detail/rows_iterator.hpp>
 
 #include <boost/throw_exception.hpp>
 
 #include <stdexcept>
+#include <type_traits>
 
 namespace boost {
 namespace mysql {
@@ -142,6 +144,61 @@ public:
      */
     ~rows() = default;
 
+    /**
+     * \brief Constructs an empty object that allocates memory using `alloc`.
+     * \details
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    explicit rows(const Allocator& alloc) noexcept : impl_(detail::erased_allocator<char>(alloc))
+    {
+    }
+
+    /**
+     * \brief Creates a rows object from a view, allocating memory using `alloc`.
+     * \details
+     * Copies the fields pointed to by `r`, using a copy of `alloc` to allocate memory.
+     * `Allocator` must satisfy the Allocator requirements, be nothrow copy constructible
+     * and be at most as big as two pointers (like `std::pmr::polymorphic_allocator`).
+     * The allocator is propagated on move construction and move assignment,
+     * but copies use the default allocator.
+     *
+     * \par Exception safety
+     * Strong guarantee. Exceptions may be thrown by `alloc`.
+     *
+     * \par Object lifetimes
+     * Any memory resource referenced by `alloc` must be kept alive until `*this`
+     * and any object it's moved into are destroyed.
+     * `*this` lifetime will be independent of `r`'s (the contents of `r` will be copied).
+     */
+    template <
+        class Allocator
+#ifndef BOOST_MYSQL_DOXYGEN
+        ,
+        class = typename std::enable_if<detail::is_allocator<Allocator>::value>::type
+#endif
+        >
+    rows(const rows_view& r, const Allocator& alloc)
+        : impl_(r.fields_, r.num_fields_, detail::erased_allocator<char>(alloc)), num_columns_(r.num_columns_)
+    {
+    }
+
     /**
      * \brief Constructs a rows object from a \ref rows_view.
      * \par Exception safety
@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_SESSION_STATE_HPP
+#define BOOST_MYSQL_SESSION_STATE_HPP
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/config.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief The type of a session state change reported by the server.
+ * \details
+ * Which changes get reported is controlled by the `session_track_system_variables`,
+ * `session_track_schema`, `session_track_state_change`, `session_track_gtids` and
+ * `session_track_transaction_info` server variables.
+ */
+enum class session_track_type : std::uint8_t
+{
+    /// A session system variable was assigned. The change's name and value are populated.
+    system_variable = 0,
+
+    /// The default schema changed. The change's value contains the new schema name.
+    schema = 1,
+
+    /// Some piece of session state changed. The change's value is always `"1"`.
+    state_change = 2,
+
+    /**
+     * \brief GTIDs were generated by the statement.
+     * \details The change's value contains the GTID set in textual form. It can be parsed using
+     * \ref gtid_set::parse.
+     */
+    gtids = 3,
+
+    /**
+     * \brief The characteristics of the current transaction changed.
+     * \details The change's value contains SQL statements that can be used to restart
+     * the transaction with the same characteristics (e.g. `START TRANSACTION READ ONLY;`).
+     */
+    transaction_characteristics = 4,
+
+    /**
+     * \brief The state of the current transaction changed.
+     * \details The change's value contains an 8 character string describing the transaction state,
+     * as described in the `session_track_transaction_info` documentation.
+     */
+    transaction_state = 5,
+};
+
+/**
+ * \brief A single session state change reported by the server.
+ * \details
+ * The string views point into the \ref session_state_view this change was obtained from.
+ */
+struct session_state_change
+{
+    /**
+     * \brief The type of the change.
+     * \details Servers may send types not listed in \ref session_track_type.
+     * In this case, \ref value contains the raw data for the change.
+     */
+    session_track_type type;
+
+    /// The system variable name, for \ref session_track_type::system_variable. Empty otherwise.
+    string_view name;
+
+    /// The change value. Its meaning depends on \ref type.
+    string_view value;
+};
+
+namespace detail {
+
+// Parses a single session state entry from [first, last). Returns a pointer
+// past the parsed entry, or nullptr if the entry is malformed.
+BOOST_MYSQL_DECL
+const std::uint8_t* parse_session_state_entry(
+    const std::uint8_t* first,
+    const std::uint8_t* last,
+    session_state_change& output
+) noexcept;
+
+class session_state_iterator
+{
+    const std::uint8_t* current_{nullptr};
+    const std::uint8_t* next_{nullptr};
+    const std::uint8_t* last_{nullptr};
+    session_state_change value_{};
+
+    void parse_current() noexcept
+    {
+        if (current_ != last_)
+        {
+            // Session state is validated when the OK packet is deserialized
+            next_ = parse_session_state_entry(current_, last_, value_);
+            BOOST_ASSERT(next_ != nullptr);
+        }
+    }
+
+public:
+    using value_type = session_state_change;
+    using reference = const session_state_change&;
+    using pointer = const session_state_change*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    session_state_iterator() = default;
+    session_state_iterator(const std::uint8_t* first, const std::uint8_t* last) noexcept
+        : current_(first), next_(first), last_(last)
+    {
+        parse_current();
+    }
+
+    session_state_iterator& operator++() noexcept
+    {
+        current_ = next_;
+        parse_current();
+        return *this;
+    }
+    session_state_iterator operator++(int) noexcept
+    {
+        auto res = *this;
+        ++(*this);
+        return res;
+    }
+
+    reference operator*() const noexcept { return value_; }
+    pointer operator->() const noexcept { return &value_; }
+
+    bool operator==(const session_state_iterator& rhs) const noexcept { return current_ == rhs.current_; }
+    bool operator!=(const session_state_iterator& rhs) const noexcept { return !(*this == rhs); }
+};
+
+}  // namespace detail
+
+/**
+ * \brief A non-owning view over the session state changes reported by the server.
+ * \details
+ * When the server tracks session state changes, OK packets contain a list of the changes
+ * caused by the executed statement. These include assigned system variables,
+ * schema changes, generated GTIDs, and transaction state. This class is a forward range
+ * of \ref session_state_change objects over these raw bytes.
+ * \n
+ * Changes are decoded lazily while iterating, so no memory is allocated.
+ * Iterating the same view several times decodes the changes again.
+ * \n
+ * Objects of this type are obtained using functions like \ref results::session_state
+ * and \ref execution_state::session_state. A default-constructed view is empty.
+ *
+ * \par Object lifetimes
+ * A view points to memory owned by the object it was obtained from. Its iterators
+ * and the string views it contains are invalidated when that object is modified or destroyed.
+ */
+class session_state_view
+{
+public:
+#ifdef BOOST_MYSQL_DOXYGEN
+    /**
+     * \brief A forward iterator to \ref session_state_change objects.
+     * \details Dereferencing it yields a `const session_state_change&`.
+     */
+    using iterator = __see_below__;
+#else
+    using iterator = detail::session_state_iterator;
+#endif
+
+    /// \copydoc iterator
+    using const_iterator = iterator;
+
+    /// The value type.
+    using value_type = session_state_change;
+
+    /// The reference type.
+    using reference = const session_state_change&;
+
+    /// \copydoc reference
+    using const_reference = const session_state_change&;
+
+    /**
+     * \brief Constructs an empty view.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    session_state_view() = default;
+
+    /**
+     * \brief Returns an iterator to the first change.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    iterator begin() const noexcept { return iterator(impl_.data(), impl_.data() + impl_.size()); }
+
+    /**
+     * \brief Returns an iterator past the last change.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    iterator end() const noexcept
+    {
+        auto last = impl_.data() + impl_.size();
+        return iterator(last, last);
+    }
+
+    /**
+     * \brief Returns `true` if the server didn't report any change.
+     * \par Exception safety
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept { return impl_.empty(); }
+
+private:
+    span<const std::uint8_t> impl_;
+
+    session_state_view(span<const std::uint8_t> data) noexcept : impl_(data) {}
+
+#ifndef BOOST_MYSQL_DOXYGEN
+    friend struct detail::access;
+#endif
+};
+
+}  // namespace mysql
+}  // namespace boost
+
+#ifdef BOOST_MYSQL_HEADER_ONLY
+#include <boost/mysql/impl/session_state.ipp>
+#endif
+
+#endif
@@ -19,28 +19,38 @@
 #endif
 
 #include <boost/mysql/impl/any_connection.ipp>
+#include <boost/mysql/impl/bulk_insert.ipp>
 #include <boost/mysql/impl/character_set.ipp>
 #include <boost/mysql/impl/column_type.ipp>
+#include <boost/mysql/impl/compact_rows.ipp>
 #include <boost/mysql/impl/connection_impl.ipp>
 #include <boost/mysql/impl/connection_pool.ipp>
 #include <boost/mysql/impl/date.ipp>
 #include <boost/mysql/impl/datetime.ipp>
+#include <boost/mysql/impl/direct_field_parser.ipp>
 #include <boost/mysql/impl/engine_impl_instantiations.ipp>
 #include <boost/mysql/impl/error_categories.ipp>
 #include <boost/mysql/impl/escape_string.ipp>
+#include <boost/mysql/impl/execute_each_processor.ipp>
 #include <boost/mysql/impl/execution_state_impl.ipp>
 #include <boost/mysql/impl/field.ipp>
 #include <boost/mysql/impl/field_kind.ipp>
 #include <boost/mysql/impl/field_view.ipp>
 #include <boost/mysql/impl/format_sql.ipp>
+#include <boost/mysql/impl/gtid_set.ipp>
 #include <boost/mysql/impl/internal/auth/auth.ipp>
 #include <boost/mysql/impl/internal/error/server_error_to_string.ipp>
 #include <boost/mysql/impl/is_fatal_error.ipp>
+#include <boost/mysql/impl/lazy_row_batch.ipp>
 #include <boost/mysql/impl/meta_check_context.ipp>
 #include <boost/mysql/impl/pipeline.ipp>
+#include <boost/mysql/impl/pipeline_batcher.ipp>
+#include <boost/mysql/impl/query_template.ipp>
+#include <boost/mysql/impl/quoted_identifier.ipp>
 #include <boost/mysql/impl/results_impl.ipp>
 #include <boost/mysql/impl/resultset.ipp>
 #include <boost/mysql/impl/row_impl.ipp>
+#include <boost/mysql/impl/session_state.ipp>
 #include <boost/mysql/impl/static_execution_state_impl.ipp>
 #include <boost/mysql/impl/static_results_impl.ipp>
 
@@ -14,6 +14,7 @@
 
 #include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
 #include <boost/mysql/detail/access.hpp>
@@ -209,6 +210,33 @@ public:
      */
     string_view info() const noexcept { return impl_.get_interface().get_info(); }
 
+    /**
+     * \brief Returns the session state changes reported by the server for the current resultset.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Preconditions
+     * `this->complete() == true || this->should_read_head() == true`
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     */
+    session_state_view session_state() const noexcept
+    {
+        return impl_.get_interface().get_session_state();
+    }
+
     /**
      * \brief Returns whether the current resultset represents a procedure OUT params.
      * \par Preconditions
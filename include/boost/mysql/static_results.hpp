@@ -13,6 +13,7 @@
 #ifdef BOOST_MYSQL_CXX14
 
 #include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 #include <boost/mysql/underlying_row.hpp>
 
@@ -282,6 +283,43 @@ public:
         return impl_.get_interface().get_info(I);
     }
 
+    /**
+     * \brief Returns the session state changes reported by the server.
+     * \details
+     * Contains the session state changes caused by the executed statement, like assigned
+     * system variables, a changed default schema or generated GTIDs. Which changes are reported
+     * is controlled by the `session_track_*` server variables. Using this information
+     * avoids issuing additional statements (like `SELECT @@character_set_client`) to query the session state.
+     * \n
+     * The returned view is empty if the server doesn't support session tracking
+     * or didn't report any change.
+     *
+     * \tparam I Resultset index. For operations returning more than one resultset, you can explicitly
+     * specify this parameter to obtain the value for the i-th resultset. If left unspecified,
+     * the value for the first resultset is returned.
+     *
+     * \par Preconditions
+     * `this->has_value() == true`
+     *
+     * \par Exception safety
+     * No-throw guarantee.
+     *
+     * \par Object lifetimes
+     * This function returns a view object, with reference semantics. The returned view points into
+     * memory owned by `*this`, and will be valid as long as `*this` or an object move-constructed
+     * from `*this` are alive.
+     *
+     * \par Complexity
+     * Constant.
+     */
+    template <std::size_t I = 0>
+    session_state_view session_state() const noexcept
+    {
+        static_assert(I < sizeof...(StaticRow), "I index out of range");
+        BOOST_ASSERT(has_value());
+        return impl_.get_interface().get_session_state(I);
+    }
+
 private:
     detail::static_results_impl<StaticRow...> impl_;
 #ifndef BOOST_MYSQL_DOXYGEN
@@ -34,6 +34,9 @@ std::ostream& operator<<(std::ostream& os, metadata_mode v);
 enum class ssl_mode;
 std::ostream& operator<<(std::ostream& os, ssl_mode v);
 
+enum class binlog_event_type : unsigned char;
+std::ostream& operator<<(std::ostream& os, binlog_event_type v);
+
 struct character_set;
 bool operator==(const character_set& lhs, const character_set& rhs);
 std::ostream& operator<<(std::ostream& os, const character_set& v);
@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/mysql/binlog_event.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/common_server_errc.hpp>
@@ -137,6 +138,32 @@ static const char* to_string(ssl_mode v)
 
 std::ostream& boost::mysql::operator<<(std::ostream& os, ssl_mode v) { return os << ::to_string(v); }
 
+static const char* to_string(binlog_event_type v)
+{
+    switch (v)
+    {
+    case binlog_event_type::unknown: return "binlog_event_type::unknown";
+    case binlog_event_type::query: return "binlog_event_type::query";
+    case binlog_event_type::rotate: return "binlog_event_type::rotate";
+    case binlog_event_type::format_description: return "binlog_event_type::format_description";
+    case binlog_event_type::xid: return "binlog_event_type::xid";
+    case binlog_event_type::table_map: return "binlog_event_type::table_map";
+    case binlog_event_type::write_rows_v1: return "binlog_event_type::write_rows_v1";
+    case binlog_event_type::update_rows_v1: return "binlog_event_type::update_rows_v1";
+    case binlog_event_type::delete_rows_v1: return "binlog_event_type::delete_rows_v1";
+    case binlog_event_type::heartbeat: return "binlog_event_type::heartbeat";
+    case binlog_event_type::write_rows: return "binlog_event_type::write_rows";
+    case binlog_event_type::update_rows: return "binlog_event_type::update_rows";
+    case binlog_event_type::delete_rows: return "binlog_event_type::delete_rows";
+    case binlog_event_type::gtid: return "binlog_event_type::gtid";
+    case binlog_event_type::anonymous_gtid: return "binlog_event_type::anonymous_gtid";
+    case binlog_event_type::previous_gtids: return "binlog_event_type::previous_gtids";
+    default: return "<unknown binlog_event_type>";
+    }
+}
+
+std::ostream& boost::mysql::operator<<(std::ostream& os, binlog_event_type v) { return os << ::to_string(v); }
+
 // character set
 bool boost::mysql::operator==(const character_set& lhs, const character_set& rhs)
 {
@@ -12,17 +12,99 @@
 #include <boost/mysql/string_view.hpp>
 #include <boost/mysql/time.hpp>
 
+#include <boost/charconv/to_chars.hpp>
 #include <boost/endian/conversion.hpp>
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 using namespace boost::mysql;
 
 namespace {
 
+// Reference implementations for integers, dates and times, using charconv.
+// format_sql uses specialized routines for these, which are cross-checked against these
+template <class T>
+void reference_int(T value, std::string& to)
+{
+    char buff[32];
+    auto res = boost::charconv::to_chars(buff, buff + sizeof(buff), value);
+    to.append(buff, res.ptr);
+}
+
+void reference_padded(std::uint64_t value, std::size_t width, std::string& to)
+{
+    std::string digits;
+    reference_int(value, digits);
+    if (digits.size() < width)
+        to.append(width - digits.size(), '0');
+    to += digits;
+}
+
+std::string reference_date(date d)
+{
+    std::string res = "'";
+    reference_padded(d.year(), 4, res);
+    res += '-';
+    reference_padded(d.month(), 2, res);
+    res += '-';
+    reference_padded(d.day(), 2, res);
+    res += '\'';
+    return res;
+}
+
+std::string reference_datetime(datetime d)
+{
+    std::string res = "'";
+    reference_padded(d.year(), 4, res);
+    res += '-';
+    reference_padded(d.month(), 2, res);
+    res += '-';
+    reference_padded(d.day(), 2, res);
+    res += ' ';
+    reference_padded(d.hour(), 2, res);
+    res += ':';
+    reference_padded(d.minute(), 2, res);
+    res += ':';
+    reference_padded(d.second(), 2, res);
+    res += '.';
+    reference_padded(d.microsecond(), 6, res);
+    res += '\'';
+    return res;
+}
+
+std::string reference_time(boost::mysql::time t)
+{
+    // Avoid negating the minimum value, which is UB
+    std::uint64_t total = t.count() < 0 ? 0u - static_cast<std::uint64_t>(t.count())
+                                        : static_cast<std::uint64_t>(t.count());
+    std::string res = "'";
+    if (t.count() < 0)
+        res += '-';
+    reference_padded(total / 3600000000u, 2, res);
+    res += ':';
+    reference_padded(total / 60000000u % 60u, 2, res);
+    res += ':';
+    reference_padded(total / 1000000u % 60u, 2, res);
+    res += '.';
+    reference_padded(total % 1000000u, 6, res);
+    res += '\'';
+    return res;
+}
+
+template <class T>
+std::string reference_int(T value)
+{
+    std::string res;
+    reference_int(value, res);
+    return res;
+}
+
 // Helper for parsing the input sample from the binary string provided by the fuzzer
 // This follows a "never fail" approach
 class sample_parser
@@ -75,58 +157,100 @@ class sample_parser
 
     boost::mysql::time get_time() { return boost::mysql::time(get<int64_t>()); }
 
-    format_arg get_format_arg(uint8_t type)
+    // If the argument uses one of the specialized formatting routines,
+    // sets expected to the output of the reference implementation
+    format_arg get_format_arg(uint8_t type, std::string& expected)
     {
         switch (type % 10)
         {
         case 0:
         default: return format_arg("", nullptr);
-        case 1: return format_arg("", get<int64_t>());
-        case 2: return format_arg("", get<uint64_t>());
+        case 1:
+        {
+            auto v = get<int64_t>();
+            expected = reference_int(v);
+            return format_arg("", v);
+        }
+        case 2:
+        {
+            auto v = get<uint64_t>();
+            expected = reference_int(v);
+            return format_arg("", v);
+        }
         case 3: return format_arg("", get<float>());
         case 4: return format_arg("", get<double>());
         case 5: return format_arg("", get_string());
         case 6: return format_arg("", get_blob());
-        case 7: return format_arg("", get_date());
-        case 8: return format_arg("", get_datetime());
-        case 9: return format_arg("", get_time());
+        case 7:
+        {
+            auto v = get_date();
+            expected = reference_date(v);
+            return format_arg("", v);
+        }
+        case 8:
+        {
+            auto v = get_datetime();
+            expected = reference_datetime(v);
+            return format_arg("", v);
+        }
+        case 9:
+        {
+            auto v = get_time();
+            expected = reference_time(v);
+            return format_arg("", v);
+        }
         }
     }
 
 public:
     sample_parser(const uint8_t* data, size_t size) noexcept : it_(data), end_(data + size) {}
 
-    std::array<format_arg, 2> parse()
+    // Sets expected to the output of the reference implementation, for the arguments that have one
+    std::array<format_arg, 2> parse(std::array<std::string, 2>& expected)
     {
         // Types
         uint8_t type_code = get<uint8_t>();
         uint8_t type0 = type_code & 0x0f;
         uint8_t type1 = type_code & 0xf0 >> 4;
 
-        // Arguments
+        // Arguments. Braced initializers are evaluated in order
         return {
-            {get_format_arg(type0), get_format_arg(type1)}
+            {get_format_arg(type0, expected[0]), get_format_arg(type1, expected[1])}
         };
     }
 };
 
 }  // namespace
 
-static bool call_format_sql(const uint8_t* data, size_t size) noexcept
+static bool call_format_sql(const uint8_t* data, size_t size)
 {
     // Parse the sample
-    auto sample = sample_parser(data, size).parse();
+    std::array<std::string, 2> expected;
+    auto sample = sample_parser(data, size).parse(expected);
 
     // Use a format context so we can avoid exceptions
     format_context ctx({utf8mb4_charset, true});
     format_sql_to(ctx, "{}, {}", {sample[0], sample[1]});
 
+    // Cross-check the specialized formatting routines against the reference implementations
+    for (std::size_t i = 0; i < 2u; ++i)
+    {
+        if (!expected[i].empty())
+        {
+            format_context single_ctx({utf8mb4_charset, true});
+            format_sql_to(single_ctx, "{}", {sample[i]});
+            if (std::move(single_ctx).get().value() != expected[i])
+                throw std::runtime_error("Formatted value doesn't match the reference implementation");
+        }
+    }
+
     return std::move(ctx).get().has_value();
 }
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
 {
-    // Note: this code should never throw exceptions, for any kind of input
+    // Note: this code should never throw exceptions, for any kind of input.
+    // An exception is thrown if a mismatch with the reference implementation is found
     call_format_sql(data, size);
     return 0;
 }
@@ -13,6 +13,10 @@
 #include <boost/mysql/detail/flags.hpp>
 #include <boost/mysql/detail/ok_view.hpp>
 
+#include <boost/core/span.hpp>
+
+#include <cstdint>
+
 namespace boost {
 namespace mysql {
 namespace test {
@@ -71,6 +75,12 @@ public:
         ok_.info = v;
         return *this;
     }
+    ok_builder& session_state(span<const std::uint8_t> v) noexcept
+    {
+        flag(detail::status_flags::session_state_changed, true);
+        ok_.session_state = v;
+        return *this;
+    }
     detail::ok_view build() const noexcept { return ok_; }
 };
 
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_CREATE_SESSION_STATE_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_CREATE_SESSION_STATE_HPP
+
+#include <boost/mysql/session_state.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/protocol_types.hpp>
+#include <boost/mysql/impl/internal/protocol/impl/serialization_context.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "test_unit/serialize_to_vector.hpp"
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+// Creates the session state information contained in OK packets
+class session_state_builder
+{
+    std::vector<std::uint8_t> buff_;
+
+public:
+    session_state_builder() = default;
+
+    // Adds an entry with an arbitrary payload
+    session_state_builder& raw_entry(std::uint8_t type, const std::vector<std::uint8_t>& payload)
+    {
+        auto entry = serialize_to_vector([&](detail::serialization_context& ctx) {
+            ctx.serialize(detail::int1{type}, detail::string_lenenc{detail::to_string(payload)});
+        });
+        buff_.insert(buff_.end(), entry.begin(), entry.end());
+        return *this;
+    }
+
+    // Adds an entry whose payload is a single string
+    session_state_builder& entry(session_track_type type, string_view value)
+    {
+        return raw_entry(
+            static_cast<std::uint8_t>(type),
+            serialize_to_vector([&](detail::serialization_context& ctx) {
+                detail::string_lenenc{value}.serialize(ctx);
+            })
+        );
+    }
+
+    session_state_builder& system_variable(string_view name, string_view value)
+    {
+        return raw_entry(
+            static_cast<std::uint8_t>(session_track_type::system_variable),
+            serialize_to_vector([&](detail::serialization_context& ctx) {
+                ctx.serialize(detail::string_lenenc{name}, detail::string_lenenc{value});
+            })
+        );
+    }
+
+    session_state_builder& gtids(string_view value)
+    {
+        return raw_entry(
+            static_cast<std::uint8_t>(session_track_type::gtids),
+            serialize_to_vector([&](detail::serialization_context& ctx) {
+                ctx.serialize(detail::int1{0}, detail::string_lenenc{value});
+            })
+        );
+    }
+
+    std::vector<std::uint8_t> build() { return std::move(buff_); }
+};
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
@@ -49,6 +49,54 @@ constexpr bool operator!=(const custom_allocator<T>&, const custom_allocator<U>&
     return false;
 }
 
+// Counts allocations and outstanding bytes, to check that memory is obtained through
+// user-supplied allocators and properly returned
+struct allocation_counter
+{
+    std::size_t num_allocations{};
+    std::size_t bytes_outstanding{};
+};
+
+template <class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    allocation_counter* counter;
+
+    counting_allocator(allocation_counter& c) noexcept : counter(&c) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : counter(other.counter)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++counter->num_allocations;
+        counter->bytes_outstanding += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        counter->bytes_outstanding -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+template <class T, class U>
+bool operator==(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs) noexcept
+{
+    return lhs.counter == rhs.counter;
+}
+
+template <class T, class U>
+bool operator!=(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs) noexcept
+{
+    return lhs.counter != rhs.counter;
+}
+
 }  // namespace test
 }  // namespace mysql
 }  // namespace boost
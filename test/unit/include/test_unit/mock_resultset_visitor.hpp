@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_MOCK_RESULTSET_VISITOR_HPP
+#define BOOST_MYSQL_TEST_UNIT_INCLUDE_TEST_UNIT_MOCK_RESULTSET_VISITOR_HPP
+
+#include <boost/mysql/metadata.hpp>
+#include <boost/mysql/metadata_collection_view.hpp>
+#include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/resultset_summary.hpp>
+#include <boost/mysql/rows.hpp>
+#include <boost/mysql/rows_view.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace test {
+
+// A visitor for execute_each that copies everything it receives.
+// Views are only valid during the callbacks, so we store owning copies.
+class mock_resultset_visitor
+{
+public:
+    struct resultset_data
+    {
+        std::vector<metadata> meta;
+        std::vector<rows> batches;
+        bool ended{false};
+        std::uint64_t affected_rows{};
+        std::uint64_t last_insert_id{};
+        unsigned warning_count{};
+        std::string info;
+        bool is_out_params{};
+    };
+
+    std::vector<resultset_data> resultsets;
+
+    void on_resultset_head(metadata_collection_view meta)
+    {
+        BOOST_TEST((resultsets.empty() || resultsets.back().ended));
+        resultsets.emplace_back();
+        resultsets.back().meta.assign(meta.begin(), meta.end());
+    }
+
+    void on_rows(rows_view rws)
+    {
+        BOOST_TEST_REQUIRE(!resultsets.empty());
+        BOOST_TEST(!resultsets.back().ended);
+        BOOST_TEST(!rws.empty());
+        BOOST_TEST(rws.num_columns() == resultsets.back().meta.size());
+        resultsets.back().batches.emplace_back(rws);
+    }
+
+    void on_resultset_end(const resultset_summary& summary)
+    {
+        BOOST_TEST_REQUIRE(!resultsets.empty());
+        auto& rs = resultsets.back();
+        BOOST_TEST(!rs.ended);
+        rs.ended = true;
+        rs.affected_rows = summary.affected_rows();
+        rs.last_insert_id = summary.last_insert_id();
+        rs.warning_count = summary.warning_count();
+        rs.info = summary.info();
+        rs.is_out_params = summary.is_out_params();
+    }
+};
+
+// A visitor for run_pipeline_each. Records stage responses, together with
+// the number of resultsets received when each stage finished
+class mock_pipeline_visitor : public mock_resultset_visitor
+{
+public:
+    struct stage_data
+    {
+        stage_response response;
+        std::size_t num_resultsets;
+    };
+
+    std::vector<stage_data> stages;
+
+    void on_stage_finished(std::size_t stage_index, stage_response&& response)
+    {
+        // Stages that fail may leave a resultset half-read
+        BOOST_TEST(stage_index == stages.size());
+        BOOST_TEST((resultsets.empty() || resultsets.back().ended || response.error()));
+        stages.push_back({std::move(response), resultsets.size()});
+    }
+};
+
+}  // namespace test
+}  // namespace mysql
+}  // namespace boost
+
+#endif
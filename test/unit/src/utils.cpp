@@ -216,11 +216,16 @@ std::vector<std::uint8_t> boost::mysql::test::serialize_ok_impl(
             detail::int2{pack.status_flags},
             detail::int2{pack.warnings}
         );
-        // When info is empty, it's actually omitted in the ok_packet
-        if (!pack.info.empty())
+        // When info is empty, it's actually omitted in the ok_packet,
+        // unless it's followed by session state
+        if (!pack.info.empty() || !pack.session_state.empty())
         {
             detail::string_lenenc{pack.info}.serialize(ctx);
         }
+        if (!pack.session_state.empty())
+        {
+            detail::string_lenenc{detail::to_string(pack.session_state)}.serialize(ctx);
+        }
     });
 }
 
@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/bulk_insert.hpp>
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/error_with_diagnostics.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "test_common/assert_buffer_equals.hpp"
+#include "test_common/buffer_concat.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/io_context_fixture.hpp"
+#include "test_common/network_result.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_query_frame.hpp"
+#include "test_unit/test_any_connection.hpp"
+#include "test_unit/test_stream.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_bulk_insert)
+
+// Formatting requires a known character set
+void set_charset(any_connection& conn)
+{
+    get_stream(conn).add_bytes(create_ok_frame(1, ok_builder().build()));
+    conn.async_set_character_set(utf8mb4_charset, as_netresult).validate_no_error();
+}
+
+std::vector<std::uint8_t> create_ok_affected(std::uint64_t affected_rows)
+{
+    return create_ok_frame(1, ok_builder().affected_rows(affected_rows).build());
+}
+
+const std::vector<std::tuple<int>> rows{{1}, {2}, {3}, {4}, {5}};
+
+// Statements are composed and split in pipelines according to params,
+// and affected rows are added up
+BOOST_FIXTURE_TEST_CASE(success, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    get_stream(conn).add_bytes(create_ok_affected(2)).add_bytes(create_ok_affected(2)).add_bytes(
+        create_ok_affected(1)
+    );
+    bulk_insert_params params;
+    params.max_statement_size = 30u;
+    params.max_pipeline_size = 35u;
+    diagnostics diag;
+
+    // Run
+    auto res = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, params, diag, as_netresult).get();
+
+    // Check
+    BOOST_TEST(res == 5u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        buffer_builder()
+            .add(create_query_frame(0, "SET NAMES 'utf8mb4'"))
+            .add(create_query_frame(0, "INSERT INTO t VALUES (1), (2)"))
+            .add(create_query_frame(0, "INSERT INTO t VALUES (3), (4)"))
+            .add(create_query_frame(0, "INSERT INTO t VALUES (5)"))
+            .build()
+    );
+}
+
+// The sync and throwing versions work the same way
+BOOST_FIXTURE_TEST_CASE(success_sync, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    get_stream(conn).add_bytes(create_ok_affected(5)).add_bytes(create_ok_affected(5));
+    error_code ec;
+    diagnostics diag;
+
+    // Run
+    auto res = bulk_insert(conn, "INSERT INTO t VALUES ", rows, {}, ec, diag);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(diag == diagnostics());
+    BOOST_TEST(res == 5u);
+    res = bulk_insert(conn, "INSERT INTO t VALUES ", rows);
+    BOOST_TEST(res == 5u);
+
+    // Check
+    auto stmt = create_query_frame(0, "INSERT INTO t VALUES (1), (2), (3), (4), (5)");
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        buffer_builder().add(create_query_frame(0, "SET NAMES 'utf8mb4'")).add(stmt).add(stmt).build()
+    );
+}
+
+// An empty range doesn't send anything
+BOOST_FIXTURE_TEST_CASE(empty_range, io_context_fixture)
+{
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    std::vector<std::tuple<int>> empty_rows;
+    diagnostics diag;
+
+    auto res = async_bulk_insert(conn, "INSERT INTO t VALUES ", empty_rows, {}, diag, as_netresult).get();
+
+    BOOST_TEST(res == 0u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        create_query_frame(0, "SET NAMES 'utf8mb4'")
+    );
+}
+
+// A failed statement makes the operation fail after the current pipeline finishes.
+// Rows inserted until then are reported
+BOOST_FIXTURE_TEST_CASE(statement_error, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    get_stream(conn)
+        .add_bytes(create_ok_affected(2))
+        .add_bytes(err_builder()
+                       .seqnum(1)
+                       .code(common_server_errc::er_dup_entry)
+                       .message("my_message")
+                       .build_frame())
+        .add_bytes(create_ok_affected(1));
+    bulk_insert_params params;
+    params.max_statement_size = 30u;
+    diagnostics diag;
+
+    // Run
+    auto netres = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, params, diag, as_netresult).run();
+
+    // Check
+    netres.validate_error(common_server_errc::er_dup_entry, create_server_diag("my_message"));
+    BOOST_TEST(netres.value == 3u);
+}
+
+// The overload without diagnostics uses the connection's shared diagnostics
+BOOST_FIXTURE_TEST_CASE(statement_error_shared_diag, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    get_stream(conn)
+        .add_bytes(create_ok_affected(2))
+        .add_bytes(err_builder()
+                       .seqnum(1)
+                       .code(common_server_errc::er_dup_entry)
+                       .message("my_message")
+                       .build_frame());
+    bulk_insert_params params;
+    params.max_statement_size = 30u;
+    params.max_pipeline_size = 1u;
+
+    // Run
+    auto netres = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, params, as_netresult).run();
+
+    // Check
+    netres.validate_error(common_server_errc::er_dup_entry, create_server_diag("my_message"));
+    BOOST_TEST(netres.value == 2u);
+}
+
+// No more statements are sent after a pipeline fails
+BOOST_FIXTURE_TEST_CASE(statement_error_stops, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    get_stream(conn)
+        .add_bytes(create_ok_affected(2))
+        .add_bytes(err_builder()
+                       .seqnum(1)
+                       .code(common_server_errc::er_dup_entry)
+                       .message("my_message")
+                       .build_frame());
+    bulk_insert_params params;
+    params.max_statement_size = 30u;
+    params.max_pipeline_size = 1u;
+    diagnostics diag;
+
+    // Run
+    auto netres = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, params, diag, as_netresult).run();
+
+    // Check
+    netres.validate_error(common_server_errc::er_dup_entry, create_server_diag("my_message"));
+    BOOST_TEST(netres.value == 2u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        buffer_builder()
+            .add(create_query_frame(0, "SET NAMES 'utf8mb4'"))
+            .add(create_query_frame(0, "INSERT INTO t VALUES (1), (2)"))
+            .add(create_query_frame(0, "INSERT INTO t VALUES (3), (4)"))
+            .build()
+    );
+}
+
+// Formatting requires a known character set
+BOOST_FIXTURE_TEST_CASE(error_unknown_charset, io_context_fixture)
+{
+    auto conn = create_test_any_connection(ctx);
+    diagnostics diag;
+
+    auto netres = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, {}, diag, as_netresult).run();
+
+    netres.validate_error(client_errc::unknown_character_set);
+    BOOST_TEST(netres.value == 0u);
+    BOOST_TEST(get_stream(conn).bytes_written().empty());
+
+    // The throwing version reports the error, too
+    BOOST_CHECK_THROW(bulk_insert(conn, "INSERT INTO t VALUES ", rows), error_with_diagnostics);
+}
+
+// Errors composing statements are reported without sending anything
+BOOST_FIXTURE_TEST_CASE(error_row_too_large, io_context_fixture)
+{
+    auto conn = create_test_any_connection(ctx);
+    set_charset(conn);
+    bulk_insert_params params;
+    params.max_statement_size = 10u;
+    diagnostics diag;
+
+    auto netres = async_bulk_insert(conn, "INSERT INTO t VALUES ", rows, params, diag, as_netresult).run();
+
+    netres.validate_error(client_errc::bulk_insert_row_too_large);
+    BOOST_TEST(netres.value == 0u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        create_query_frame(0, "SET NAMES 'utf8mb4'")
+    );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+
+#endif
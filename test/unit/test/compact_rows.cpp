@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/compact_rows.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/rows.hpp>
+#include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "test_common/create_basic.hpp"
+#include "test_unit/custom_allocator.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+
+BOOST_AUTO_TEST_SUITE(test_compact_rows)
+
+// Checks that all the fields in c equal the ones in expected
+static void check_equal(const compact_rows& c, rows_view expected)
+{
+    BOOST_TEST_REQUIRE(c.size() == expected.size());
+    BOOST_TEST_REQUIRE(c.num_columns() == expected.num_columns());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        for (std::size_t j = 0; j < expected.num_columns(); ++j)
+        {
+            BOOST_TEST(c.at(i, j) == expected[i][j]);
+            BOOST_TEST(c(i, j) == expected[i][j]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(default_ctor)
+{
+    compact_rows c;
+    BOOST_TEST(c.empty());
+    BOOST_TEST(c.size() == 0u);
+    BOOST_TEST(c.num_columns() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(all_types)
+{
+    const unsigned char blob_data[] = {0x01, 0x00, 0xff};
+    auto r = makerows(
+        3,
+        nullptr,
+        std::int64_t(-42),
+        std::uint64_t(42),
+        "abc",
+        blob_view(blob_data),
+        4.2f,
+        4.2,
+        date(2020, 10, 5),
+        datetime(2020, 10, 5, 23, 59, 59, 999999),
+        maket(-838, 59, 58, 999999),
+        "",
+        blob_view()
+    );
+
+    compact_rows c(r);
+    BOOST_TEST(!c.empty());
+    check_equal(c, r);
+}
+
+BOOST_AUTO_TEST_CASE(extreme_values)
+{
+    auto r = makerows(
+        4,
+        (std::numeric_limits<std::int64_t>::min)(),
+        (std::numeric_limits<std::int64_t>::max)(),
+        (std::numeric_limits<std::uint64_t>::max)(),
+        -0.0,
+        date(),
+        date(9999, 12, 31),
+        datetime(),
+        datetime(9999, 12, 31, 23, 59, 59, 999999)
+    );
+
+    compact_rows c(r);
+    check_equal(c, r);
+}
+
+BOOST_AUTO_TEST_CASE(datetime_doesnt_fit)
+{
+    // These don't fit in the bit-packed representation, and go into the side table
+    auto r = makerows(
+        1,
+        datetime(0xffff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xffffffff),
+        datetime(2020, 1, 1, 10, 20, 30, 2000000),
+        datetime(2020, 1, 1, 10, 20, 30)
+    );
+
+    compact_rows c(r);
+    check_equal(c, r);
+}
+
+BOOST_AUTO_TEST_CASE(strings_point_into_object)
+{
+    std::string s = "some_string";
+    auto r = makerows(1, s);
+
+    compact_rows c(r);
+    s = "other_value";
+    BOOST_TEST(c.at(0, 0) == field_view("some_string"));
+}
+
+BOOST_AUTO_TEST_CASE(append)
+{
+    auto r1 = makerows(2, 1, "abc", nullptr, 4.2);
+    auto r2 = makerows(2, 3, "defghi", datetime(2020, 1, 1), "");
+    auto expected = makerows(2, 1, "abc", nullptr, 4.2, 3, "defghi", datetime(2020, 1, 1), "");
+
+    compact_rows c;
+    c.append(r1);
+    c.append(rows_view());
+    c.append(r2);
+    check_equal(c, expected);
+}
+
+BOOST_AUTO_TEST_CASE(append_num_columns_mismatch)
+{
+    compact_rows c(makerows(2, 1, "abc"));
+    BOOST_CHECK_THROW(c.append(makerows(3, 1, 2, 3)), std::invalid_argument);
+
+    // Strong guarantee
+    check_equal(c, makerows(2, 1, "abc"));
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    compact_rows c(makerows(2, 1, "abc"));
+    c.clear();
+    BOOST_TEST(c.empty());
+    BOOST_TEST(c.num_columns() == 0u);
+
+    // Can be reused with a different number of columns
+    auto r = makerows(1, "def", 42);
+    c.append(r);
+    check_equal(c, r);
+}
+
+BOOST_AUTO_TEST_CASE(at_out_of_range)
+{
+    compact_rows c(makerows(2, 1, "abc", 2, "def"));
+    BOOST_CHECK_THROW(c.at(2, 0), std::out_of_range);
+    BOOST_CHECK_THROW(c.at(0, 2), std::out_of_range);
+    BOOST_CHECK_THROW(compact_rows().at(0, 0), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(copy_move)
+{
+    auto r = makerows(2, 1, "abc", 2, "def");
+    compact_rows c(r);
+
+    // Copies hold their own strings
+    compact_rows c2(c);
+    c.clear();
+    check_equal(c2, r);
+
+    // Moving keeps string views valid
+    auto fv = c2.at(1, 1);
+    compact_rows c3(std::move(c2));
+    BOOST_TEST(
+        static_cast<const void*>(fv.get_string().data()) ==
+        static_cast<const void*>(c3.at(1, 1).get_string().data())
+    );
+    check_equal(c3, r);
+}
+
+BOOST_AUTO_TEST_CASE(custom_allocator)
+{
+    auto r = makerows(2, 1, "abc", 2, "def");
+    allocation_counter counter;
+    {
+        compact_rows c{counting_allocator<char>(counter)};
+        c.append(r);
+        check_equal(c, r);
+        BOOST_TEST(counter.num_allocations > 0u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
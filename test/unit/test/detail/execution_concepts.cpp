@@ -5,6 +5,8 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/mysql/compiled_format.hpp>
+#include <boost/mysql/query_template.hpp>
 #include <boost/mysql/with_params.hpp>
 
 #include <boost/mysql/detail/config.hpp>
@@ -82,6 +84,20 @@ static_assert(is_execution_request<const with_params_t<int>&>::value, "");
 static_assert(is_execution_request<with_params_t<int>&&>::value, "");
 static_assert(is_execution_request<with_params_t<const std::string&>&&>::value, "");
 
+// with_params, compiled format strings
+static_assert(is_execution_request<with_compiled_params_t<1>>::value, "");
+static_assert(is_execution_request<with_compiled_params_t<2, int>>::value, "");
+static_assert(is_execution_request<with_compiled_params_t<2, const std::string&, float>>::value, "");
+static_assert(is_execution_request<with_compiled_params_t<2, int>&>::value, "");
+static_assert(is_execution_request<const with_compiled_params_t<2, int>&>::value, "");
+static_assert(is_execution_request<with_compiled_params_t<2, int>&&>::value, "");
+
+// with_params, query templates
+static_assert(is_execution_request<with_template_params_t<>>::value, "");
+static_assert(is_execution_request<with_template_params_t<int, float>>::value, "");
+static_assert(is_execution_request<const with_template_params_t<int>&>::value, "");
+static_assert(is_execution_request<with_template_params_t<const std::string&>&&>::value, "");
+
 // Other stuff
 static_assert(!is_execution_request<field_view>::value, "");
 static_assert(!is_execution_request<int>::value, "");
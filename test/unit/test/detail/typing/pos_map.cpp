@@ -23,6 +23,7 @@ using namespace boost::mysql::test;
 using boost::span;
 using boost::mysql::detail::map_field_view;
 using boost::mysql::detail::map_metadata;
+using boost::mysql::detail::name_index_t;
 using boost::mysql::detail::name_table_t;
 using boost::mysql::detail::pos_absent;
 using boost::mysql::detail::pos_map_add_field;
@@ -54,7 +55,7 @@ BOOST_AUTO_TEST_CASE(add_field_empty)
 {
     span<std::size_t> map{};
     name_table_t name_table{};
-    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, 0, "f1"));
+    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, name_index_t(), 0, "f1"));
 }
 
 BOOST_AUTO_TEST_CASE(add_field_unnamed)
@@ -67,26 +68,26 @@ BOOST_AUTO_TEST_CASE(add_field_unnamed)
     pos_map_reset(map);
 
     // Add first field
-    pos_map_add_field(map, name_table, 0, "f1");
+    pos_map_add_field(map, name_table, name_index_t(), 0, "f1");
     BOOST_TEST(map[0] == 0u);
     BOOST_TEST(map[1] == pos_absent);
     BOOST_TEST(map[2] == pos_absent);
 
     // Add second field
-    pos_map_add_field(map, name_table, 1, "f2");
+    pos_map_add_field(map, name_table, name_index_t(), 1, "f2");
     BOOST_TEST(map[0] == 0u);
     BOOST_TEST(map[1] == 1u);
     BOOST_TEST(map[2] == pos_absent);
 
     // Add third field
-    pos_map_add_field(map, name_table, 2, "f3");
+    pos_map_add_field(map, name_table, name_index_t(), 2, "f3");
     BOOST_TEST(map[0] == 0u);
     BOOST_TEST(map[1] == 1u);
     BOOST_TEST(map[2] == 2u);
 
     // Any further trailing fields are discarded
-    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, 3, "f3"));
-    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, 4, "f4"));
+    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, name_index_t(), 3, "f3"));
+    BOOST_CHECK_NO_THROW(pos_map_add_field(map, name_table, name_index_t(), 4, "f4"));
     BOOST_TEST(map[0] == 0u);
     BOOST_TEST(map[1] == 1u);
     BOOST_TEST(map[2] == 2u);
@@ -100,34 +101,69 @@ BOOST_AUTO_TEST_CASE(add_field_named)
     pos_map_reset(map);
 
     // Add first field
-    pos_map_add_field(map, name_table, 0, "f2");
+    pos_map_add_field(map, name_table, name_index_t(), 0, "f2");
     BOOST_TEST(map[0] == pos_absent);
     BOOST_TEST(map[1] == 0u);
     BOOST_TEST(map[2] == pos_absent);
     BOOST_TEST(map[3] == pos_absent);
 
     // Add second field
-    pos_map_add_field(map, name_table, 1, "f4");
+    pos_map_add_field(map, name_table, name_index_t(), 1, "f4");
     BOOST_TEST(map[0] == pos_absent);
     BOOST_TEST(map[1] == 0u);
     BOOST_TEST(map[2] == pos_absent);
     BOOST_TEST(map[3] == 1u);
 
     // Add a non-existing field
-    pos_map_add_field(map, name_table, 2, "fnonexistent");
+    pos_map_add_field(map, name_table, name_index_t(), 2, "fnonexistent");
     BOOST_TEST(map[0] == pos_absent);
     BOOST_TEST(map[1] == 0u);
     BOOST_TEST(map[2] == pos_absent);
     BOOST_TEST(map[3] == 1u);
 
     // Add third field
-    pos_map_add_field(map, name_table, 3, "f1");
+    pos_map_add_field(map, name_table, name_index_t(), 3, "f1");
     BOOST_TEST(map[0] == 3u);
     BOOST_TEST(map[1] == 0u);
     BOOST_TEST(map[2] == pos_absent);
     BOOST_TEST(map[3] == 1u);
 }
 
+BOOST_AUTO_TEST_CASE(add_field_named_index)
+{
+    // Setup. The index contains the positions in the name table, sorted by name
+    const string_view name_table[] = {"f3", "f10", "f1", "f2"};
+    const std::size_t name_index[] = {2, 1, 3, 0};
+    std::array<std::size_t, 4> map{{}};
+    pos_map_reset(map);
+
+    // Add first field
+    pos_map_add_field(map, name_table, name_index, 0, "f2");
+    BOOST_TEST(map[0] == pos_absent);
+    BOOST_TEST(map[1] == pos_absent);
+    BOOST_TEST(map[2] == pos_absent);
+    BOOST_TEST(map[3] == 0u);
+
+    // Add non-existing fields, before, after and between the existing ones
+    pos_map_add_field(map, name_table, name_index, 1, "a");
+    pos_map_add_field(map, name_table, name_index, 2, "z");
+    pos_map_add_field(map, name_table, name_index, 3, "f11");
+    pos_map_add_field(map, name_table, name_index, 4, "");
+    BOOST_TEST(map[0] == pos_absent);
+    BOOST_TEST(map[1] == pos_absent);
+    BOOST_TEST(map[2] == pos_absent);
+    BOOST_TEST(map[3] == 0u);
+
+    // Add the remaining fields
+    pos_map_add_field(map, name_table, name_index, 5, "f1");
+    pos_map_add_field(map, name_table, name_index, 6, "f3");
+    pos_map_add_field(map, name_table, name_index, 7, "f10");
+    BOOST_TEST(map[0] == 6u);
+    BOOST_TEST(map[1] == 7u);
+    BOOST_TEST(map[2] == 5u);
+    BOOST_TEST(map[3] == 0u);
+}
+
 BOOST_AUTO_TEST_CASE(map_metadata_)
 {
     const std::array<std::size_t, 3> map{
@@ -10,6 +10,7 @@
 #ifdef BOOST_MYSQL_CXX14
 
 #include <boost/mysql/column_type.hpp>
+#include <boost/mysql/date.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata.hpp>
@@ -21,10 +22,14 @@
 
 #include <boost/core/span.hpp>
 #include <boost/describe/class.hpp>
+#include <boost/optional/optional.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "test_common/create_basic.hpp"
 #include "test_common/printing.hpp"
@@ -34,6 +39,7 @@
 using namespace boost::mysql;
 using namespace boost::mysql::test;
 using boost::span;
+using detail::get_row_name_index;
 using detail::get_row_name_table;
 using detail::get_row_size;
 using detail::get_type_index;
@@ -135,6 +141,22 @@ static void compare_name_tables(name_table_t lhs, name_table_t rhs)
     BOOST_TEST(lhsvec == rhsvec);
 }
 
+//
+// name_less: used to sort name tables at compile time
+//
+BOOST_AUTO_TEST_CASE(name_less_)
+{
+    BOOST_TEST(!detail::name_less("", ""));
+    BOOST_TEST(detail::name_less("", "a"));
+    BOOST_TEST(!detail::name_less("a", ""));
+    BOOST_TEST(detail::name_less("abc", "abd"));
+    BOOST_TEST(!detail::name_less("abd", "abc"));
+    BOOST_TEST(detail::name_less("ab", "abc"));
+    BOOST_TEST(!detail::name_less("abc", "abc"));
+    BOOST_TEST(detail::name_less("Z", "a"));
+    BOOST_TEST(detail::name_less("a", "\xc3\xa1"));  // compares as unsigned
+}
+
 //
 // is_row_type concept: doesn't inspect individual fields
 //
@@ -410,6 +432,148 @@ BOOST_AUTO_TEST_CASE(no_fields)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+//
+// parse_direct: same as parse, but with binary protocol cells
+//
+BOOST_AUTO_TEST_SUITE(parse_direct_)
+
+using detail::binary_cell;
+using detail::parse_direct;
+
+binary_cell make_cell(span<const std::uint8_t> data) { return {data, false}; }
+
+// 3.10e-10, 3.14f, 42, "abc"
+constexpr std::uint8_t double_bytes[] = {0x71, 0x99, 0x6d, 0xe2, 0x93, 0x4d, 0xf5, 0x3d};
+constexpr std::uint8_t float_bytes[] = {0xc3, 0xf5, 0x48, 0x40};
+constexpr std::uint8_t int_bytes[] = {0x2a, 0x00, 0x00, 0x00};
+constexpr std::uint8_t string_bytes[] = {0x61, 0x62, 0x63};
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // int, float, double
+    const binary_cell cells[] = {
+        make_cell(double_bytes),
+        make_cell(string_bytes),
+        make_cell(int_bytes),
+        make_cell(float_bytes),
+    };
+    const auto meta = create_metas(
+        {column_type::double_, column_type::varchar, column_type::int_, column_type::float_}
+    );
+    const std::size_t pos_map[] = {2, 3, 0};
+    test_row value;
+    auto err = parse_direct<row_identity<test_row>>(pos_map, cells, meta, value);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(value.i == 42);
+    BOOST_TEST(value.f == 3.14f);
+    BOOST_TEST(value.double_field == 3.10e-10);
+}
+
+BOOST_AUTO_TEST_CASE(null_error)
+{
+    // int, float, double
+    const binary_cell cells[] = {make_cell(double_bytes), binary_cell{}, make_cell(float_bytes)};
+    const auto meta = create_metas({column_type::double_, column_type::int_, column_type::float_});
+    const std::size_t pos_map[] = {1, 2, 0};
+    test_row value;
+    auto err = parse_direct<row_identity<test_row>>(pos_map, cells, meta, value);
+    BOOST_TEST(err == client_errc::static_row_parsing_error);
+}
+
+BOOST_AUTO_TEST_CASE(out_of_range)
+{
+    // The int doesn't fit in an int32_t. Range checks are performed as in parse()
+    constexpr std::uint8_t bigint_bytes[] = {0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+    const binary_cell cells[] = {make_cell(bigint_bytes), make_cell(float_bytes), make_cell(double_bytes)};
+    const auto meta = create_metas({column_type::bigint, column_type::float_, column_type::double_});
+    const std::size_t pos_map[] = {0, 1, 2};
+    test_row value;
+    auto err = parse_direct<row_identity<test_row>>(pos_map, cells, meta, value);
+    BOOST_TEST(err == client_errc::static_row_parsing_error);
+}
+
+BOOST_AUTO_TEST_CASE(unsigned_and_small_ints)
+{
+    // An unsigned tinyint and a signed smallint
+    constexpr std::uint8_t tinyint_bytes[] = {0xfe};
+    constexpr std::uint8_t smallint_bytes[] = {0xfe, 0xff};
+    const binary_cell cells[] = {make_cell(tinyint_bytes), make_cell(smallint_bytes)};
+    const std::vector<metadata> meta{
+        meta_builder().type(column_type::tinyint).unsigned_flag(true).build(),
+        create_meta(column_type::smallint),
+    };
+    const std::size_t pos_map[] = {0, 1};
+    std::tuple<std::uint8_t, std::int16_t> value;
+    auto err = parse_direct<std::tuple<std::uint8_t, std::int16_t>>(pos_map, cells, meta, value);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(std::get<0>(value) == 254u);
+    BOOST_TEST(std::get<1>(value) == -2);
+}
+
+BOOST_AUTO_TEST_CASE(nan)
+{
+    // NaNs are rejected, as in deserialize_row()
+    constexpr std::uint8_t nan_bytes[] = {0x00, 0x00, 0xc0, 0x7f};
+    const binary_cell cells[] = {make_cell(nan_bytes)};
+    const auto meta = create_metas({column_type::float_});
+    const std::size_t pos_map[] = {0};
+    std::tuple<float> value;
+    auto err = parse_direct<std::tuple<float>>(pos_map, cells, meta, value);
+    BOOST_TEST(err == client_errc::protocol_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(strings_optionals_fallback)
+{
+    // Dates go through field_view
+    constexpr std::uint8_t date_bytes[] = {0x04, 0xe2, 0x07, 0x0a, 0x05};
+    constexpr std::uint8_t blob_bytes[] = {0x00, 0xff};
+    const binary_cell cells[] = {
+        make_cell(string_bytes),
+        binary_cell{},
+        make_cell(int_bytes),
+        make_cell(date_bytes),
+        make_cell(blob_bytes),
+    };
+    const auto meta = create_metas({
+        column_type::varchar,
+        column_type::int_,
+        column_type::int_,
+        column_type::date,
+        column_type::blob,
+    });
+    const std::size_t pos_map[] = {0, 1, 2, 3, 4};
+    using row_t = std::tuple<
+        std::string,
+        boost::optional<std::int32_t>,
+        boost::optional<std::int32_t>,
+        date,
+        std::vector<unsigned char>>;
+    row_t value;
+    std::get<0>(value) = "other";
+    std::get<1>(value) = 10;  // NULL cells reset optionals
+    auto err = parse_direct<row_t>(pos_map, cells, meta, value);
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(std::get<0>(value) == "abc");
+    BOOST_TEST(!std::get<1>(value).has_value());
+    BOOST_TEST(std::get<2>(value).value() == 42);
+    BOOST_TEST(std::get<3>(value) == date(2018u, 10u, 5u));
+    BOOST_TEST((std::get<4>(value) == std::vector<unsigned char>{0x00, 0xff}));
+}
+
+BOOST_AUTO_TEST_CASE(no_fields)
+{
+    test_empty_row value;
+    auto err = parse_direct<row_identity<test_empty_row>>(
+        span<const std::size_t>(),
+        span<const binary_cell>(),
+        metadata_collection_view(),
+        value
+    );
+    BOOST_TEST(err == error_code());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 //
 // Describe structs
 //
@@ -473,6 +637,18 @@ BOOST_AUTO_TEST_CASE(get_row_name_table_)
     compare_name_tables(get_row_name_table<sinherit>(), expected_sinherit);
 }
 
+// name index: computed at compile time, sorted by name
+static_assert(get_row_name_index<sempty>().size() == 0u, "");
+static_assert(get_row_name_index<s1>().size() == 1u, "");
+static_assert(get_row_name_index<s1>()[0] == 0u, "");
+static_assert(get_row_name_index<s2>().size() == 2u, "");
+static_assert(get_row_name_index<s2>()[0] == 1u, "");  // f
+static_assert(get_row_name_index<s2>()[1] == 0u, "");  // i
+static_assert(get_row_name_index<sinherit>().size() == 3u, "");
+static_assert(get_row_name_index<sinherit>()[0] == 2u, "");  // double_field
+static_assert(get_row_name_index<sinherit>()[1] == 1u, "");  // f
+static_assert(get_row_name_index<sinherit>()[2] == 0u, "");  // i
+
 // meta check
 BOOST_AUTO_TEST_CASE(meta_check_ok)
 {
@@ -580,6 +756,10 @@ BOOST_AUTO_TEST_CASE(get_row_name_table_)
     compare_name_tables(get_row_name_table<t3>(), name_table_t());
 }
 
+// name index: empty, since tuples are mapped by position
+static_assert(get_row_name_index<tempty>().size() == 0u, "");
+static_assert(get_row_name_index<t3>().size() == 0u, "");
+
 // meta check
 BOOST_AUTO_TEST_CASE(meta_check_ok)
 {
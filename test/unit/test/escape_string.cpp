@@ -279,6 +279,81 @@ BOOST_AUTO_TEST_CASE(parameter_coverage)
     }
 }
 
+// utf8mb4 and ascii use specialized algorithms. These wrap the same functions, but don't compare
+// equal to the built-in charsets, so they use the generic algorithm
+std::size_t wrapped_next_char_utf8mb4(boost::span<const unsigned char> r) { return utf8mb4_charset.next_char(r); }
+std::size_t wrapped_next_char_ascii(boost::span<const unsigned char> r) { return ascii_charset.next_char(r); }
+
+BOOST_AUTO_TEST_CASE(specialized_charsets)
+{
+    // clang-format off
+    struct
+    {
+        string_view name;
+        character_set specialized;
+        character_set generic;
+    } charsets[] = {
+        {"utf8mb4", utf8mb4_charset, {"utf8mb4", wrapped_next_char_utf8mb4}},
+        {"ascii",   ascii_charset,   {"ascii",   wrapped_next_char_ascii}  },
+    };
+    // clang-format on
+
+    const string_view inputs[] = {
+        "",
+        "abc",
+        R"(A "string" that 'contains' some `quotes` \'"`)",
+        test::makesv("With \0 null, \n, \r and \x1a"),
+        "2byte \" \xc3\xb1 UTF-8\\ \xc3\xb2 \\",
+        "4byte \r'\xf0\x90\x80\x80 UTF-8\n",
+        "\xc3\xb1",
+        "invalid \xc3\\ chars",
+        "This 'has' invalid \xc0\x80 chars",
+        "truncated \xf0\x90\x80",
+        "\xff",
+    };
+
+    const quoting_context quot_ctxs[] = {
+        quoting_context::double_quote,
+        quoting_context::single_quote,
+        quoting_context::backtick,
+    };
+
+    for (const auto& cs : charsets)
+    {
+        for (auto input : inputs)
+        {
+            for (auto quot_ctx : quot_ctxs)
+            {
+                for (bool backslash_escapes : {true, false})
+                {
+                    BOOST_TEST_CONTEXT(
+                        cs.name << ", " << input << ", " << static_cast<char>(quot_ctx) << ", "
+                                << backslash_escapes
+                    )
+                    {
+                        std::string expected = "abc", actual = "abc";
+                        auto expected_ec = escape_string(
+                            input,
+                            {cs.generic, backslash_escapes},
+                            quot_ctx,
+                            expected
+                        );
+                        auto actual_ec = escape_string(
+                            input,
+                            {cs.specialized, backslash_escapes},
+                            quot_ctx,
+                            actual
+                        );
+                        BOOST_TEST(actual_ec == expected_ec);
+                        if (!expected_ec)
+                            BOOST_TEST(actual == expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(other_string_types)
 {
     // Spotcheck: escape_string can be used with string types != std::string
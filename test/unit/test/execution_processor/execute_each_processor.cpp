@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_mode.hpp>
+
+#include <boost/mysql/detail/execution_processor/execute_each_processor.hpp>
+#include <boost/mysql/detail/execution_processor/execution_processor.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "execution_processor_helpers.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_meta.hpp"
+#include "test_unit/create_row_message.hpp"
+#include "test_unit/mock_resultset_visitor.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::mysql::detail::execute_each_processor;
+using boost::mysql::detail::output_ref;
+using boost::mysql::detail::resultset_encoding;
+using boost::mysql::detail::resultset_visitor_ref;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_execute_each_processor)
+
+struct fixture
+{
+    mock_resultset_visitor visitor;
+    execute_each_processor proc{resultset_visitor_ref(visitor)};
+    std::vector<field_view> shared_fields;
+    diagnostics diag;
+
+    fixture() { proc.reset(resultset_encoding::text, metadata_mode::full); }
+
+    void row(const std::vector<std::uint8_t>& body)
+    {
+        auto err = proc.on_row(body, output_ref(), shared_fields);
+        throw_on_error(err, diag);
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(one_resultset_data, fixture)
+{
+    // Head is notified once all metadata has been read
+    proc.on_num_meta(2);
+    auto err = proc.on_meta(create_meta_r1_0(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(visitor.resultsets.size() == 0u);
+    err = proc.on_meta(create_meta_r1_1(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST_REQUIRE(visitor.resultsets.size() == 1u);
+    check_meta_r1(visitor.resultsets[0].meta);
+
+    // Rows are delivered when the batch finishes
+    proc.on_row_batch_start();
+    row(create_text_row_body(10, "abc"));
+    row(create_text_row_body(20, "cdef"));
+    BOOST_TEST(visitor.resultsets[0].batches.size() == 0u);
+    proc.on_row_batch_finish();
+    BOOST_TEST_REQUIRE(visitor.resultsets[0].batches.size() == 1u);
+    BOOST_TEST((visitor.resultsets[0].batches[0] == makerows(2, 10, "abc", 20, "cdef")));
+
+    // Rows are kept by the processor, so shared fields are not used
+    BOOST_TEST(shared_fields.empty());
+
+    // A batch containing rows and the OK packet. Rows are delivered before the end
+    proc.on_row_batch_start();
+    row(create_text_row_body(30, "d"));
+    err = proc.on_row_ok_packet(create_ok_r1());
+    throw_on_error(err, diag);
+    proc.on_row_batch_finish();
+    BOOST_TEST(proc.is_complete());
+
+    // Check
+    const auto& rs = visitor.resultsets[0];
+    BOOST_TEST_REQUIRE(rs.batches.size() == 2u);
+    BOOST_TEST((rs.batches[1] == makerows(2, 30, "d")));
+    BOOST_TEST(rs.ended);
+    BOOST_TEST(rs.affected_rows == 1u);
+    BOOST_TEST(rs.last_insert_id == 2u);
+    BOOST_TEST(rs.warning_count == 4u);
+    BOOST_TEST(rs.info == "Information");
+    BOOST_TEST(!rs.is_out_params);
+}
+
+BOOST_FIXTURE_TEST_CASE(one_resultset_empty, fixture)
+{
+    // Resultsets without rows get both head and end notifications
+    auto err = proc.on_head_ok_packet(create_ok_r2(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(proc.is_complete());
+
+    BOOST_TEST_REQUIRE(visitor.resultsets.size() == 1u);
+    const auto& rs = visitor.resultsets[0];
+    check_meta_empty(rs.meta);
+    BOOST_TEST(rs.batches.size() == 0u);
+    BOOST_TEST(rs.ended);
+    BOOST_TEST(rs.affected_rows == 5u);
+    BOOST_TEST(rs.info == "more_info");
+    BOOST_TEST(rs.is_out_params);
+}
+
+BOOST_FIXTURE_TEST_CASE(one_resultset_no_rows, fixture)
+{
+    // A SELECT that matched no rows
+    add_meta(proc, create_meta_r2());
+    proc.on_row_batch_start();
+    auto err = proc.on_row_ok_packet(create_ok_r1());
+    throw_on_error(err, diag);
+    proc.on_row_batch_finish();
+
+    BOOST_TEST_REQUIRE(visitor.resultsets.size() == 1u);
+    check_meta_r2(visitor.resultsets[0].meta);
+    BOOST_TEST(visitor.resultsets[0].batches.size() == 0u);
+    BOOST_TEST(visitor.resultsets[0].ended);
+}
+
+BOOST_FIXTURE_TEST_CASE(several_resultsets, fixture)
+{
+    // Resultset r1, with rows
+    add_meta(proc, create_meta_r1());
+    proc.on_row_batch_start();
+    row(create_text_row_body(10, "abc"));
+    auto err = proc.on_row_ok_packet(create_ok_r1(true));
+    throw_on_error(err, diag);
+    proc.on_row_batch_finish();
+    BOOST_TEST(proc.is_reading_first_subseq());
+
+    // Resultset r2, empty
+    err = proc.on_head_ok_packet(create_ok_r2(true), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(proc.is_reading_first_subseq());
+
+    // Resultset r3, with rows
+    add_meta(proc, create_meta_r3());
+    proc.on_row_batch_start();
+    row(create_text_row_body(4.2f, 5.0, 8));
+    row(create_text_row_body(4.3f, 6.0, 9));
+    err = proc.on_row_ok_packet(create_ok_r3());
+    throw_on_error(err, diag);
+    proc.on_row_batch_finish();
+    BOOST_TEST(proc.is_complete());
+
+    // Check
+    BOOST_TEST_REQUIRE(visitor.resultsets.size() == 3u);
+    const auto& r1 = visitor.resultsets[0];
+    check_meta_r1(r1.meta);
+    BOOST_TEST_REQUIRE(r1.batches.size() == 1u);
+    BOOST_TEST((r1.batches[0] == makerows(2, 10, "abc")));
+    BOOST_TEST(r1.info == "Information");
+
+    const auto& r2 = visitor.resultsets[1];
+    check_meta_empty(r2.meta);
+    BOOST_TEST(r2.batches.size() == 0u);
+    BOOST_TEST(r2.info == "more_info");
+
+    const auto& r3 = visitor.resultsets[2];
+    check_meta_r3(r3.meta);
+    BOOST_TEST_REQUIRE(r3.batches.size() == 1u);
+    BOOST_TEST((r3.batches[0] == makerows(3, 4.2f, 5.0, 8, 4.3f, 6.0, 9)));
+    BOOST_TEST(r3.affected_rows == 10u);
+    BOOST_TEST(r3.ended);
+}
+
+BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
+{
+    add_meta(proc, create_meta_r1());
+    proc.on_row_batch_start();
+    row(create_text_row_body(10, "abc"));
+
+    auto bad_row = create_text_row_body(42, "abc");
+    bad_row.push_back(0xff);
+    auto err = proc.on_row(bad_row, output_ref(), shared_fields);
+    BOOST_TEST(err == client_errc::extra_bytes);
+
+    // Resetting the processor discards any pending rows
+    proc.reset(resultset_encoding::text, metadata_mode::full);
+    visitor.resultsets.clear();
+    add_meta(proc, create_meta_r2());
+    proc.on_row_batch_start();
+    row(create_text_row_body(42));
+    proc.on_row_batch_finish();
+
+    BOOST_TEST_REQUIRE(visitor.resultsets.size() == 1u);
+    BOOST_TEST_REQUIRE(visitor.resultsets[0].batches.size() == 1u);
+    BOOST_TEST((visitor.resultsets[0].batches[0] == makerows(1, 42)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
@@ -11,11 +11,16 @@
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/typing/direct_field_parser.hpp>
+
+#include <boost/mysql/impl/internal/protocol/impl/span_string.hpp>
 
 #include <boost/core/span.hpp>
 #include <boost/test/unit_test.hpp>
@@ -26,10 +31,13 @@
 #include "test_unit/create_execution_processor.hpp"
 #include "test_unit/create_meta.hpp"
 #include "test_unit/create_row_message.hpp"
+#include "test_unit/create_session_state.hpp"
+#include "test_unit/custom_allocator.hpp"
 #include "test_unit/printing.hpp"
 
 using namespace boost::mysql;
 using namespace boost::mysql::test;
+using boost::mysql::detail::binary_cell;
 using boost::mysql::detail::execution_state_impl;
 using boost::mysql::detail::output_ref;
 using boost::mysql::detail::resultset_encoding;
@@ -339,6 +347,47 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(st.get_info() == "other info");
 }
 
+BOOST_FIXTURE_TEST_CASE(session_state_ownership, fixture)
+{
+    // OK packet received, doesn't own the session state
+    auto state = session_state_builder().system_variable("time_zone", "+01:00").build();
+    auto err = st.on_head_ok_packet(ok_builder().more_results(true).session_state(state).build(), diag);
+    throw_on_error(err, diag);
+
+    // st does, so changing the buffer doesn't affect
+    state = session_state_builder().entry(session_track_type::schema, "other").build();
+    auto view = st.get_session_state();
+    BOOST_TEST_REQUIRE(!view.empty());
+    BOOST_TEST(view.begin()->name == "time_zone");
+    BOOST_TEST(view.begin()->value == "+01:00");
+
+    // Repeat the process for row OK packet
+    st.on_num_meta(1);
+    err = st.on_meta(meta_builder().build_coldef(), diag);
+    throw_on_error(err, diag);
+    err = st.on_row_ok_packet(ok_builder().session_state(state).build());
+    throw_on_error(err, diag);
+    state.clear();
+    view = st.get_session_state();
+    BOOST_TEST_REQUIRE(!view.empty());
+    BOOST_TEST((view.begin()->type == session_track_type::schema));
+    BOOST_TEST(view.begin()->value == "other");
+}
+
+BOOST_FIXTURE_TEST_CASE(session_state_cleared, fixture)
+{
+    // A resultset with session state
+    auto state = session_state_builder().entry(session_track_type::schema, "mydb").build();
+    auto err = st.on_head_ok_packet(ok_builder().more_results(true).session_state(state).build(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(!st.get_session_state().empty());
+
+    // The next one doesn't have any, so it's empty
+    err = st.on_head_ok_packet(ok_builder().build(), diag);
+    throw_on_error(err, diag);
+    BOOST_TEST(st.get_session_state().empty());
+}
+
 BOOST_FIXTURE_TEST_CASE(error_deserializing_row, fixture)
 {
     add_meta(st, create_meta_r1());
@@ -364,6 +413,74 @@ BOOST_FIXTURE_TEST_CASE(meta_mode_full, fixture)
     BOOST_TEST(st.meta()[0].column_name() == "ftiny");
 }
 
+// Rows are split into cells, without decoding them, when the output ref has cells (lazy_row_batch)
+BOOST_FIXTURE_TEST_CASE(rows_split_into_cells_text, fixture)
+{
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(10, "abc");
+    auto r2 = create_text_row_body(nullptr, "cdef");
+    std::vector<binary_cell> cells;
+
+    auto err = st.on_row(r1, output_ref(cells), fields);
+    throw_on_error(err, diag);
+    err = st.on_row(r2, output_ref(cells), fields);
+    throw_on_error(err, diag);
+
+    BOOST_TEST(fields.empty());
+    BOOST_TEST_REQUIRE(cells.size() == 4u);
+    BOOST_TEST(!cells[0].is_null);
+    BOOST_TEST(detail::to_string(cells[0].data) == "10");
+    BOOST_TEST(!cells[1].is_null);
+    BOOST_TEST(detail::to_string(cells[1].data) == "abc");
+    BOOST_TEST(cells[2].is_null);
+    BOOST_TEST(detail::to_string(cells[3].data) == "cdef");
+}
+
+BOOST_FIXTURE_TEST_CASE(rows_split_into_cells_binary, fixture)
+{
+    st.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(st, create_meta_r1());
+    const std::uint8_t r1[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};  // tinyint, varchar
+    std::vector<binary_cell> cells;
+
+    auto err = st.on_row(r1, output_ref(cells), fields);
+    throw_on_error(err, diag);
+
+    BOOST_TEST(fields.empty());
+    BOOST_TEST_REQUIRE(cells.size() == 2u);
+    BOOST_TEST(!cells[0].is_null);
+    BOOST_TEST(cells[0].data.size() == 1u);
+    BOOST_TEST(cells[0].data[0] == 0x2a);
+    BOOST_TEST(detail::to_string(cells[1].data) == "abc");
+}
+
+BOOST_FIXTURE_TEST_CASE(rows_split_into_cells_error, fixture)
+{
+    add_meta(st, create_meta_r1());
+    const std::uint8_t r1[] = {0x02, 0x31};  // incomplete value
+    std::vector<binary_cell> cells;
+
+    auto err = st.on_row(r1, output_ref(cells), fields);
+    BOOST_TEST(err == client_errc::incomplete_message);
+}
+
+BOOST_AUTO_TEST_CASE(custom_allocator)
+{
+    allocation_counter counter;
+    {
+        execution_state_impl st{detail::erased_allocator<char>(counting_allocator<char>(counter))};
+        st.reset(resultset_encoding::text, metadata_mode::full);
+        add_meta(st, create_meta_r1());
+        auto err = st.on_row_ok_packet(ok_builder().info("some_info").build());
+        BOOST_TEST(err == error_code());
+
+        BOOST_TEST(st.meta()[0].column_name() == "ftiny");
+        BOOST_TEST(st.get_info() == "some_info");
+        BOOST_TEST(counter.num_allocations > 0u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
\ No newline at end of file
@@ -9,12 +9,15 @@
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata.hpp>
 #include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/row_view.hpp>
 #include <boost/mysql/rows_view.hpp>
+#include <boost/mysql/session_state.hpp>
 #include <boost/mysql/string_view.hpp>
 #include <boost/mysql/throw_on_error.hpp>
 
+#include <boost/mysql/detail/erased_allocator.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/execution_processor/results_impl.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
@@ -25,8 +28,11 @@
 #include "test_common/create_basic.hpp"
 #include "test_common/printing.hpp"
 #include "test_unit/create_execution_processor.hpp"
+#include "test_unit/create_meta.hpp"
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_row_message.hpp"
+#include "test_unit/create_session_state.hpp"
+#include "test_unit/custom_allocator.hpp"
 #include "test_unit/printing.hpp"
 
 using namespace boost::mysql;
@@ -502,6 +508,36 @@ BOOST_FIXTURE_TEST_CASE(info_string_ownserhip, fixture)
     BOOST_TEST(r.get_info(2) == "other info");
 }
 
+BOOST_FIXTURE_TEST_CASE(session_state_ownership, fixture)
+{
+    // Head OK packet
+    auto state = session_state_builder().system_variable("time_zone", "+01:00").build();
+    auto err = r.on_head_ok_packet(ok_builder().more_results(true).session_state(state).build(), diag);
+    throw_on_error(err, diag);
+
+    // OK packet without session state
+    err = r.on_head_ok_packet(ok_builder().more_results(true).build(), diag);
+    throw_on_error(err, diag);
+
+    // Row OK packet
+    state = session_state_builder().gtids("3e11fa47-71ca-11e1-9e33-c80aa9429562:23").build();
+    add_meta(r, create_meta_r2());
+    err = r.on_row_ok_packet(ok_builder().session_state(state).build());
+    throw_on_error(err, diag);
+    state.clear();
+
+    // Each resultset gets its own session state, owned by r
+    auto view0 = r.get_session_state(0);
+    BOOST_TEST_REQUIRE(!view0.empty());
+    BOOST_TEST(view0.begin()->name == "time_zone");
+    BOOST_TEST(view0.begin()->value == "+01:00");
+    BOOST_TEST(r.get_session_state(1).empty());
+    auto view2 = r.get_session_state(2);
+    BOOST_TEST_REQUIRE(!view2.empty());
+    BOOST_TEST((view2.begin()->type == session_track_type::gtids));
+    BOOST_TEST(view2.begin()->value == "3e11fa47-71ca-11e1-9e33-c80aa9429562:23");
+}
+
 BOOST_FIXTURE_TEST_CASE(multiple_row_batches, fixture)
 {
     // Initial
@@ -586,6 +622,61 @@ BOOST_FIXTURE_TEST_CASE(meta_mode_full, fixture)
     BOOST_TEST(r.get_meta(0)[0].column_name() == "ftiny");
 }
 
+// Metadata strings are kept in an arena, reused across executions.
+// Metadata objects copied by the user remain valid after the processor is reset
+BOOST_FIXTURE_TEST_CASE(meta_mode_full_copy_outlives_reset, fixture)
+{
+    exec_access(r)
+        .reset(resultset_encoding::text, metadata_mode::full)
+        .meta(create_meta_r1())
+        .ok(create_ok_r1());
+    metadata meta_copy = r.get_meta(0)[1];
+
+    exec_access(r)
+        .reset(resultset_encoding::text, metadata_mode::full)
+        .meta({meta_builder().type(column_type::bigint).name("other_name").build_coldef()})
+        .ok(create_ok_r1());
+
+    BOOST_TEST(meta_copy.column_name() == "fvarchar");
+    BOOST_TEST(r.get_meta(0)[0].column_name() == "other_name");
+}
+
+// All the memory, including metadata strings, is obtained from the supplied allocator
+BOOST_AUTO_TEST_CASE(custom_allocator)
+{
+    allocation_counter counter;
+    {
+        results_impl r{detail::erased_allocator<char>(counting_allocator<char>(counter))};
+        exec_access(r)
+            .reset(resultset_encoding::text, metadata_mode::full)
+            .meta(create_meta_r1())
+            .row(42, "abc")
+            .row(50, "def")
+            .ok(ok_builder().info("some_info").more_results(true).build())
+            .meta({column_type::varchar})
+            .row("ghi")
+            .ok(create_ok_r1());
+
+        BOOST_TEST(r.get_rows(0) == makerows(2, 42, "abc", 50, "def"));
+        BOOST_TEST(r.get_rows(1) == makerows(1, "ghi"));
+        BOOST_TEST(r.get_meta(0)[1].column_name() == "fvarchar");
+        BOOST_TEST(r.get_info(0) == "some_info");
+        BOOST_TEST(counter.num_allocations > 0u);
+
+        // Moving keeps the allocator
+        auto num_allocs = counter.num_allocations;
+        results_impl r2(std::move(r));
+        BOOST_TEST(r2.get_rows(0) == makerows(2, 42, "abc", 50, "def"));
+        BOOST_TEST(counter.num_allocations == num_allocs);
+
+        // Copies use the default allocator
+        results_impl r3(r2);
+        BOOST_TEST(r3.get_rows(1) == makerows(1, "ghi"));
+        BOOST_TEST(counter.num_allocations == num_allocs);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
\ No newline at end of file
@@ -10,8 +10,10 @@
 #ifdef BOOST_MYSQL_CXX14
 
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/column_buffers.hpp>
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/field_view.hpp>
+#include <boost/mysql/metadata_mode.hpp>
 #include <boost/mysql/throw_on_error.hpp>
 
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
@@ -19,8 +21,14 @@
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
 #include <boost/core/span.hpp>
+#include <boost/optional/optional.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "execution_processor_helpers.hpp"
 #include "static_execution_processor_helpers.hpp"
 #include "test_common/printing.hpp"
@@ -504,6 +512,209 @@ BOOST_FIXTURE_TEST_CASE(error_type_index_mismatch, fixture)
     BOOST_TEST(err == client_errc::row_type_mismatch);
 }
 
+// Binary rows are parsed directly into the output ref
+BOOST_FIXTURE_TEST_CASE(binary_rows, fixture)
+{
+    static_execst_t<row1> stp;
+    auto& st = stp.get_interface();
+    st.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(st, create_meta_r1());
+    const std::uint8_t r1[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};  // tinyint, varchar
+
+    row1 storage[2]{};
+    auto err = st.on_row(r1, stp.make_output_ref(span<row1>(storage), 1), fields);
+    throw_on_error(err, diag);
+
+    BOOST_TEST((storage[1] == row1{"abc", 42}));
+    BOOST_TEST(fields.empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(binary_error_type_index_mismatch, fixture)
+{
+    static_execst_t<row1, row2> stp;
+    auto& st = stp.get_interface();
+    st.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(st, create_meta_r1());
+    const std::uint8_t r1[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};
+
+    row2 storage[1]{};
+    auto err = st.on_row(r1, stp.make_output_ref(span<row2>(storage), 0), fields);
+    BOOST_TEST(err == client_errc::row_type_mismatch);
+}
+
+// Rows can be read into column buffers
+BOOST_FIXTURE_TEST_CASE(columns_text, fixture)
+{
+    static_execst_t<row1> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(10, "abc");
+    auto r2 = create_text_row_body(20, "cdef");
+
+    std::string varchars[2];
+    std::int16_t tinys[2]{};
+    column_buffers<row1> cols({varchars, tinys});
+
+    auto ref = stp.make_output_ref(cols);
+    ref.set_offset(0);
+    auto err = st.on_row(r1, ref, fields);
+    throw_on_error(err, diag);
+    ref.set_offset(1);
+    err = st.on_row(r2, ref, fields);
+    throw_on_error(err, diag);
+
+    BOOST_TEST(varchars[0] == "abc");
+    BOOST_TEST(varchars[1] == "cdef");
+    BOOST_TEST(tinys[0] == 10);
+    BOOST_TEST(tinys[1] == 20);
+}
+
+BOOST_FIXTURE_TEST_CASE(columns_binary, fixture)
+{
+    static_execst_t<row1> stp;
+    auto& st = stp.get_interface();
+    st.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(st, create_meta_r1());
+    const std::uint8_t r1[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};  // tinyint, varchar
+
+    std::string varchars[2];
+    std::int16_t tinys[2]{};
+    column_buffers<row1> cols({varchars, tinys});
+
+    auto ref = stp.make_output_ref(cols);
+    ref.set_offset(1);
+    auto err = st.on_row(r1, ref, fields);
+    throw_on_error(err, diag);
+
+    BOOST_TEST(varchars[1] == "abc");
+    BOOST_TEST(tinys[1] == 42);
+    BOOST_TEST(fields.empty());
+}
+
+// Optional members are written as their value type, and NULLs go into the bitmap
+BOOST_FIXTURE_TEST_CASE(columns_nullable, fixture)
+{
+    using row_t = std::tuple<boost::optional<std::int16_t>, std::string>;
+    for (auto enc : {resultset_encoding::text, resultset_encoding::binary})
+    {
+        BOOST_TEST_CONTEXT(enc)
+        {
+            static_execst_t<row_t> stp;
+            auto& st = stp.get_interface();
+            st.reset(enc, metadata_mode::minimal);
+            add_meta(st, create_meta_r1());
+            std::vector<std::uint8_t> r1, r2;
+            if (enc == resultset_encoding::text)
+            {
+                r1 = create_text_row_body(nullptr, "abc");
+                r2 = create_text_row_body(42, "");
+            }
+            else
+            {
+                r1 = {0x00, 0x04, 0x03, 0x61, 0x62, 0x63};  // NULL bitmap: 1st field is NULL
+                r2 = {0x00, 0x00, 0x2a, 0x00};
+            }
+
+            std::int16_t tinys[2]{-1, -1};
+            std::string varchars[2];
+            unsigned char bitmap[1]{0xff};
+            column_buffers<row_t> cols({tinys, varchars}, bitmap);
+            BOOST_TEST(cols.capacity() == 2u);
+
+            auto ref = stp.make_output_ref(cols);
+            ref.set_offset(0);
+            auto err = st.on_row(r1, ref, fields);
+            throw_on_error(err, diag);
+            ref.set_offset(1);
+            err = st.on_row(r2, ref, fields);
+            throw_on_error(err, diag);
+
+            BOOST_TEST(tinys[0] == 0);  // value-initialized
+            BOOST_TEST(tinys[1] == 42);
+            BOOST_TEST(varchars[0] == "abc");
+            BOOST_TEST(varchars[1] == "");
+            BOOST_TEST(cols.is_null(0, 0));
+            BOOST_TEST(!cols.is_null(0, 1));
+            BOOST_TEST(!cols.is_null(1, 0));
+            BOOST_TEST(!cols.is_null(1, 1));
+            BOOST_TEST(bitmap[0] == 0xf1);  // bits past the written rows are not touched
+        }
+    }
+}
+
+// Without a bitmap, there is no way to report NULLs, so reading one is an error
+BOOST_FIXTURE_TEST_CASE(columns_nullable_no_bitmap, fixture)
+{
+    using row_t = std::tuple<boost::optional<std::int16_t>, std::string>;
+    for (auto enc : {resultset_encoding::text, resultset_encoding::binary})
+    {
+        BOOST_TEST_CONTEXT(enc)
+        {
+            static_execst_t<row_t> stp;
+            auto& st = stp.get_interface();
+            st.reset(enc, metadata_mode::minimal);
+            add_meta(st, create_meta_r1());
+            std::vector<std::uint8_t> r1, r2;
+            if (enc == resultset_encoding::text)
+            {
+                r1 = create_text_row_body(42, "abc");
+                r2 = create_text_row_body(nullptr, "def");
+            }
+            else
+            {
+                r1 = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};
+                r2 = {0x00, 0x04, 0x03, 0x64, 0x65, 0x66};  // NULL bitmap: 1st field is NULL
+            }
+
+            std::int16_t tinys[2]{-1, -1};
+            std::string varchars[2];
+            column_buffers<row_t> cols({tinys, varchars});
+            BOOST_TEST(cols.capacity() == 2u);
+
+            // Non-NULL values can be read
+            auto ref = stp.make_output_ref(cols);
+            ref.set_offset(0);
+            auto err = st.on_row(r1, ref, fields);
+            throw_on_error(err, diag);
+            BOOST_TEST(tinys[0] == 42);
+            BOOST_TEST(varchars[0] == "abc");
+
+            // NULLs fail, and don't leave stale values
+            ref.set_offset(1);
+            err = st.on_row(r2, ref, fields);
+            BOOST_TEST(err == client_errc::static_row_parsing_error);
+            BOOST_TEST(tinys[1] == 0);
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(columns_error_parsing_row, fixture)
+{
+    static_execst_t<row1> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto bad_row = create_text_row_body(nullptr, "abc");  // should not be NULL
+
+    std::string varchars[1];
+    std::int16_t tinys[1]{};
+    column_buffers<row1> cols({varchars, tinys});
+    auto err = st.on_row(bad_row, stp.make_output_ref(cols), fields);
+    BOOST_TEST(err == client_errc::static_row_parsing_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(columns_error_type_index_mismatch, fixture)
+{
+    static_execst_t<row1, row2> stp;
+    auto& st = stp.get_interface();
+    add_meta(st, create_meta_r1());
+    auto r1 = create_text_row_body(42, "abc");
+
+    std::int64_t bigints[1]{};
+    column_buffers<row2> cols(std::make_tuple(span<std::int64_t>(bigints)));
+    auto err = st.on_row(r1, stp.make_output_ref(cols), fields);
+    BOOST_TEST(err == client_errc::row_type_mismatch);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_too_few_resultsets_empty, fixture)
 {
     static_execst_t<empty, row2> stp;
@@ -20,6 +20,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
+
 #include "execution_processor_helpers.hpp"
 #include "static_execution_processor_helpers.hpp"
 #include "test_common/printing.hpp"
@@ -568,6 +570,60 @@ BOOST_FIXTURE_TEST_CASE(error_parsing_row, fixture)
     BOOST_TEST(err == client_errc::static_row_parsing_error);
 }
 
+// Binary rows are parsed directly into the row type
+BOOST_FIXTURE_TEST_CASE(binary_rows, fixture)
+{
+    static_res_t<row1> rt;
+    auto& r = rt.get_interface();
+    r.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(r, create_meta_r1());
+
+    // Rows: tinyint, varchar
+    const std::uint8_t r1[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63};
+    const std::uint8_t r2[] = {0x00, 0x00, 0xfe, 0x00};
+    auto err = r.on_row(r1, output_ref(), fields);
+    throw_on_error(err, diag);
+    err = r.on_row(r2, output_ref(), fields);
+    throw_on_error(err, diag);
+    err = r.on_row_ok_packet(create_ok_r1());
+    throw_on_error(err, diag);
+
+    // Verify results. Shared fields are not used
+    std::vector<row1> expected_r1{
+        {"abc", 42},
+        {"",    -2},
+    };
+    BOOST_TEST(r.is_complete());
+    check_rows(rt.get_rows<0>(), expected_r1);
+    BOOST_TEST(fields.empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(binary_error_deserializing_row, fixture)
+{
+    static_res_t<row1> rt;
+    auto& r = rt.get_interface();
+    r.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(r, create_meta_r1());
+    const std::uint8_t bad_row[] = {0x00, 0x00, 0x2a, 0x03, 0x61, 0x62, 0x63, 0xff};
+
+    auto err = r.on_row(bad_row, output_ref(), fields);
+
+    BOOST_TEST(err == client_errc::extra_bytes);
+}
+
+BOOST_FIXTURE_TEST_CASE(binary_error_parsing_row, fixture)
+{
+    static_res_t<row1> rt;
+    auto& r = rt.get_interface();
+    r.reset(resultset_encoding::binary, metadata_mode::minimal);
+    add_meta(r, create_meta_r1());
+    const std::uint8_t bad_row[] = {0x00, 0x04, 0x03, 0x61, 0x62, 0x63};  // ftiny should not be NULL
+
+    auto err = r.on_row(bad_row, output_ref(), fields);
+
+    BOOST_TEST(err == client_errc::static_row_parsing_error);
+}
+
 BOOST_FIXTURE_TEST_CASE(error_too_few_resultsets_empty, fixture)
 {
     static_res_t<empty, row2> rt;
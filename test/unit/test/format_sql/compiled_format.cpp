@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/compiled_format.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/with_params.hpp>
+
+#include <boost/mysql/detail/any_execution_request.hpp>
+
+#include <boost/system/system_error.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_common/printing.hpp"
+#include "test_unit/ff_charset.hpp"
+
+using namespace boost::mysql;
+using detail::count_compiled_format_steps;
+
+//
+// Compiled format strings: covers parsing format strings ahead of time
+// and checks that formatting with them is equivalent to format_sql
+//
+BOOST_AUTO_TEST_SUITE(test_compiled_format)
+
+constexpr format_options opts{utf8mb4_charset, true};
+
+// Parsing can happen at compile time
+static_assert(count_compiled_format_steps("") == 0u, "");
+static_assert(count_compiled_format_steps("SELECT 1") == 1u, "");
+static_assert(count_compiled_format_steps("SELECT {}, {}") == 4u, "");
+static_assert(count_compiled_format_steps("{}{}") == 2u, "");
+static_assert(count_compiled_format_steps("{{}}") == 2u, "");
+static_assert(BOOST_MYSQL_COMPILE_FORMAT("SELECT {name:i} FROM t").num_steps() == 3u, "");
+
+// Equivalent to the runtime version
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Empty string
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("")) == "");
+
+    // String without replacements
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT 1")) == "SELECT 1");
+
+    // Escaped curly braces
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT '{{}}'"), 42) == "SELECT '{}'");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT '{{'"), 42) == "SELECT '{'");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT '}}'"), 42) == "SELECT '}'");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT '}}}}{{'"), 42) == "SELECT '}}{'");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("{{{}}}"), 42) == "{42}");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT '{{0}}'"), 42) == "SELECT '{0}'");
+
+    // Automatic indexing
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("{}"), 42) == "42");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("{}{}"), 42, "abc") == "42'abc'");
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("WHERE a={} OR b={} OR 1=1"), 42, "abc") ==
+        "WHERE a=42 OR b='abc' OR 1=1"
+    );
+
+    // Explicit indexing
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {1}, {0}"), 42, "abc") == "SELECT 'abc', 42"
+    );
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {0}, {0}"), 42) == "SELECT 42, 42");
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {010}"), 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10) ==
+        "SELECT 10"
+    );
+
+    // Specifiers
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {1:i};"), 42, "abc") == "SELECT `abc`;");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {:r};"), "abc") == "SELECT abc;");
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {:};"), 42) == "SELECT 42;");
+
+    // Unused arguments are ignored
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {}"), 42, "abc", nullptr) == "SELECT 42");
+
+    // Format strings with non-ascii (but valid) characters
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT `e\xc3\xb1u` + {};"), 42) ==
+        "SELECT `e\xc3\xb1u` + 42;"
+    );
+}
+
+BOOST_AUTO_TEST_CASE(success_named_args)
+{
+    // clang-format off
+    BOOST_TEST(format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {val}"), {{"val", 42}}) == "SELECT 42");
+    BOOST_TEST(
+        format_sql(
+            opts,
+            BOOST_MYSQL_COMPILE_FORMAT("SELECT {val2}, {val}"),
+            {{"val", 42}, {"val2", "abc"}}
+        ) == "SELECT 'abc', 42"
+    );
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {val}"), {{"val", 42}, {"other", 50}}) ==
+        "SELECT 42, 42"
+    );
+    BOOST_TEST(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {name:i};"), {{"name", "value"}}) ==
+        "SELECT `value`;"
+    );
+    // clang-format on
+}
+
+BOOST_AUTO_TEST_CASE(format_sql_to_)
+{
+    format_context ctx(opts);
+    ctx.append_raw("SELECT ");
+    format_sql_to(ctx, BOOST_MYSQL_COMPILE_FORMAT("{}, {:i}"), 42, "abc");
+    format_sql_to(ctx, BOOST_MYSQL_COMPILE_FORMAT(" FROM {name:i}"), {{"name", "tab"}});
+    BOOST_TEST(std::move(ctx).get().value() == "SELECT 42, `abc` FROM `tab`");
+}
+
+// Non-ASCII format strings are parsed using the character set in use
+BOOST_AUTO_TEST_CASE(non_ascii_charset)
+{
+    format_options custom_opts{test::ff_charset, true};
+
+    constexpr auto query1 = BOOST_MYSQL_COMPILE_FORMAT("SELECT \xff{ + {};");
+    constexpr auto query2 = BOOST_MYSQL_COMPILE_FORMAT("SELECT \xff} + {};");
+    BOOST_TEST(format_sql(custom_opts, query1, 42) == "SELECT \xff{ + 42;");
+    BOOST_TEST(format_sql(custom_opts, query2, 42) == "SELECT \xff} + 42;");
+
+    // Such strings are validated when formatting
+    static_assert(count_compiled_format_steps("SELECT {e\xc3\xb1p}") == 0u, "");
+    format_context ctx(opts);
+    format_sql_to(ctx, BOOST_MYSQL_COMPILE_FORMAT("SELECT \xc3 bad {}"), 42);
+    BOOST_TEST(std::move(ctx).get().error() == client_errc::format_string_invalid_encoding);
+
+    format_context ctx2(opts);
+    format_sql_to(ctx2, BOOST_MYSQL_COMPILE_FORMAT("SELECT {e\xc3\xb1p}"), {{"a", 42}});
+    BOOST_TEST(std::move(ctx2).get().error() == client_errc::format_string_invalid_syntax);
+}
+
+// Arguments are checked when formatting
+BOOST_AUTO_TEST_CASE(error_args)
+{
+    format_context ctx(opts);
+    format_sql_to(ctx, BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}"), 42);
+    BOOST_TEST(std::move(ctx).get().error() == client_errc::format_arg_not_found);
+
+    format_context ctx2(opts);
+    format_sql_to(ctx2, BOOST_MYSQL_COMPILE_FORMAT("SELECT {2}"), 42);
+    BOOST_TEST(std::move(ctx2).get().error() == client_errc::format_arg_not_found);
+
+    format_context ctx3(opts);
+    format_sql_to(ctx3, BOOST_MYSQL_COMPILE_FORMAT("SELECT {name} {bad}"), {{"name", 42}});
+    BOOST_TEST(std::move(ctx3).get().error() == client_errc::format_arg_not_found);
+
+    format_context ctx4(opts);
+    format_sql_to(ctx4, BOOST_MYSQL_COMPILE_FORMAT("SELECT {:d}"), "abc");
+    BOOST_TEST(std::move(ctx4).get().error() == client_errc::format_string_invalid_specifier);
+
+    BOOST_CHECK_THROW(
+        format_sql(opts, BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}"), 1),
+        boost::system::system_error
+    );
+}
+
+// Invalid format strings are rejected when compiled. In a constant expression,
+// this is a compile error. Otherwise, an exception is thrown
+BOOST_AUTO_TEST_CASE(error_syntax)
+{
+    struct
+    {
+        string_view name;
+        string_view format_str;
+        error_code expected_ec;
+    } test_cases[] = {
+        {"unbalanced_{",             "SELECT { bad",       client_errc::format_string_invalid_syntax },
+        {"unbalanced_{_eof",         "SELECT {",           client_errc::format_string_invalid_syntax },
+        {"unbalanced_}",             "SELECT } bad",       client_errc::format_string_invalid_syntax },
+        {"unbalanced_}_after_field", "SELECT {}} bad",     client_errc::format_string_invalid_syntax },
+        {"unbalanced_}_eof",         "SELECT }",           client_errc::format_string_invalid_syntax },
+        {"name_starts_number",       "SELECT {0name}",     client_errc::format_string_invalid_syntax },
+        {"name_starts_invalid",      "SELECT {!name}",     client_errc::format_string_invalid_syntax },
+        {"name_spaces",              "SELECT { name }",    client_errc::format_string_invalid_syntax },
+        {"name_spec_{",              "SELECT {name:i{}",   client_errc::format_string_invalid_syntax },
+        {"index_hex",                "SELECT {0x10}",      client_errc::format_string_invalid_syntax },
+        {"index_eof",                "SELECT {0",          client_errc::format_string_invalid_syntax },
+        {"index_gt_max",             "SELECT {65536}",     client_errc::format_string_invalid_syntax },
+        {"index_negative",           "SELECT {-1}",        client_errc::format_string_invalid_syntax },
+        {"index_to_manual",          "SELECT {0}, {}",     client_errc::format_string_manual_auto_mix},
+        {"manual_to_index",          "SELECT {}, {0}",     client_errc::format_string_manual_auto_mix},
+        {"auto_spec_eof",            "SELECT {:i",         client_errc::format_string_invalid_syntax },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            error_code ec;
+            try
+            {
+                count_compiled_format_steps(tc.format_str);
+            }
+            catch (const boost::system::system_error& err)
+            {
+                ec = err.code();
+            }
+            BOOST_TEST(ec == tc.expected_ec);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(error_num_steps_mismatch)
+{
+    BOOST_CHECK_THROW(compiled_format<1>("SELECT {}"), boost::system::system_error);
+    BOOST_CHECK_THROW(compiled_format<3>("SELECT {}"), boost::system::system_error);
+}
+
+BOOST_AUTO_TEST_CASE(with_params_)
+{
+    static constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}");
+    std::string s = "abc";
+
+    // Arguments are decay-copied, unless std::ref is used
+    auto req = with_params(query, 42, s);
+    static_assert(std::is_same<decltype(req), with_compiled_params_t<4, int, std::string>>::value, "");
+    BOOST_TEST(req.query.format_string() == "SELECT {}, {}");
+    BOOST_TEST(std::get<1>(req.args) == "abc");
+
+    auto req_ref = with_params(query, 42, std::ref(s));
+    static_assert(std::is_same<decltype(req_ref), with_compiled_params_t<4, int, std::string&>>::value, "");
+
+    // Converts to an execution request
+    std::vector<field_view> shared_fields;
+    detail::any_execution_request any_req = detail::execution_request_traits<
+        decltype(req)>::make_request(req, shared_fields);
+    BOOST_TEST((any_req.type == detail::any_execution_request::type_t::query_with_compiled_params));
+    BOOST_TEST(any_req.data.query_with_compiled_params.query.format_str == "SELECT {}, {}");
+    BOOST_TEST(any_req.data.query_with_compiled_params.query.steps.size() == 4u);
+    BOOST_TEST(any_req.data.query_with_compiled_params.args.size() == 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
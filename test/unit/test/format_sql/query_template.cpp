@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/query_template.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/any_execution_request.hpp>
+
+#include <boost/system/system_error.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_common/printing.hpp"
+#include "test_unit/ff_charset.hpp"
+
+using namespace boost::mysql;
+
+//
+// Query templates: format strings parsed once at runtime.
+// Formatting with them should be equivalent to format_sql
+//
+BOOST_AUTO_TEST_SUITE(test_query_template)
+
+constexpr format_options opts{utf8mb4_charset, true};
+
+BOOST_AUTO_TEST_CASE(success)
+{
+    // Empty string and no replacements
+    BOOST_TEST(format_sql(opts, query_template("")) == "");
+    BOOST_TEST(format_sql(opts, query_template("SELECT 1")) == "SELECT 1");
+
+    // Escaped curly braces
+    BOOST_TEST(format_sql(opts, query_template("SELECT '{{}}'"), 42) == "SELECT '{}'");
+    BOOST_TEST(format_sql(opts, query_template("{{{}}}"), 42) == "{42}");
+
+    // Automatic, explicit and named arguments
+    BOOST_TEST(format_sql(opts, query_template("{} + {}"), 42, "abc") == "42 + 'abc'");
+    BOOST_TEST(format_sql(opts, query_template("SELECT {1}, {0}"), 42, "abc") == "SELECT 'abc', 42");
+    BOOST_TEST(
+        format_sql(opts, query_template("SELECT {val2}, {val}"), {{"val", 42}, {"val2", "abc"}}) ==
+        "SELECT 'abc', 42"
+    );
+
+    // Specifiers
+    BOOST_TEST(
+        format_sql(opts, query_template("SELECT {:i} FROM {:r}"), "abc", "t") == "SELECT `abc` FROM t"
+    );
+
+    // Non-ASCII format strings
+    query_template tmpl_utf8("SELECT `e\xc3\xb1u` + {};");
+    BOOST_TEST(format_sql(opts, tmpl_utf8, 42) == "SELECT `e\xc3\xb1u` + 42;");
+    query_template tmpl_ff("SELECT \xff{ + {};");
+    BOOST_TEST(format_sql({test::ff_charset, true}, tmpl_ff, 42) == "SELECT \xff{ + 42;");
+}
+
+// A template can be formatted many times, with different arguments
+BOOST_AUTO_TEST_CASE(reuse)
+{
+    query_template tmpl("INSERT INTO t VALUES ({}, {}), ({}, {})");
+    for (int i = 0; i < 3; ++i)
+    {
+        format_context ctx(opts);
+        format_sql_to(ctx, tmpl, i, "a", i + 1, "b");
+        BOOST_TEST(
+            std::move(ctx).get().value() == "INSERT INTO t VALUES (" + std::to_string(i) + ", 'a'), (" +
+                                                std::to_string(i + 1) + ", 'b')"
+        );
+    }
+}
+
+// Segments are stored as offsets, so copies and moves are independent of the original
+BOOST_AUTO_TEST_CASE(copy_move)
+{
+    std::unique_ptr<query_template> tmpl{new query_template("SELECT {}")};
+    query_template cpy(*tmpl);
+    query_template mv(std::move(*tmpl));
+    tmpl.reset();
+    BOOST_TEST(format_sql(opts, cpy, 42) == "SELECT 42");
+    BOOST_TEST(format_sql(opts, mv, 42) == "SELECT 42");
+    BOOST_TEST(cpy.format_string() == "SELECT {}");
+
+    cpy = query_template("SELECT {}, {}");
+    BOOST_TEST(format_sql(opts, cpy, 1, 2) == "SELECT 1, 2");
+}
+
+// Argument errors are reported when formatting
+BOOST_AUTO_TEST_CASE(error_args)
+{
+    query_template tmpl("SELECT {}, {name}");
+
+    format_context ctx(opts);
+    format_sql_to(ctx, tmpl, 42);
+    BOOST_TEST(std::move(ctx).get().error() == client_errc::format_arg_not_found);
+
+    format_context ctx2(opts);
+    format_sql_to(ctx2, tmpl, {{"other", 42}});
+    BOOST_TEST(std::move(ctx2).get().error() == client_errc::format_arg_not_found);
+}
+
+// Syntax errors are reported by the constructor
+BOOST_AUTO_TEST_CASE(error_syntax)
+{
+    struct
+    {
+        string_view name;
+        string_view format_str;
+        error_code expected_ec;
+    } test_cases[] = {
+        {"unbalanced_{", "SELECT { bad",   client_errc::format_string_invalid_syntax },
+        {"unbalanced_}", "SELECT } bad",   client_errc::format_string_invalid_syntax },
+        {"index_gt_max", "SELECT {65536}", client_errc::format_string_invalid_syntax },
+        {"auto_manual",  "SELECT {}, {0}", client_errc::format_string_manual_auto_mix},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            error_code ec;
+            try
+            {
+                query_template tmpl(runtime(tc.format_str));
+            }
+            catch (const boost::system::system_error& err)
+            {
+                ec = err.code();
+            }
+            BOOST_TEST(ec == tc.expected_ec);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(with_params_)
+{
+    query_template tmpl("SELECT {}, {}");
+    std::string s = "abc";
+
+    // Arguments are decay-copied, unless std::ref is used. The template is stored by reference
+    auto req = with_params(tmpl, 42, s);
+    static_assert(std::is_same<decltype(req), with_template_params_t<int, std::string>>::value, "");
+    BOOST_TEST(&req.query == &tmpl);
+    BOOST_TEST(std::get<1>(req.args) == "abc");
+
+    auto req_ref = with_params(tmpl, 42, std::ref(s));
+    static_assert(std::is_same<decltype(req_ref), with_template_params_t<int, std::string&>>::value, "");
+
+    // Converts to an execution request
+    std::vector<field_view> shared_fields;
+    detail::any_execution_request any_req = detail::execution_request_traits<
+        decltype(req)>::make_request(req, shared_fields);
+    BOOST_TEST((any_req.type == detail::any_execution_request::type_t::query_with_compiled_params));
+    BOOST_TEST(any_req.data.query_with_compiled_params.query.format_str == "SELECT {}, {}");
+    BOOST_TEST(any_req.data.query_with_compiled_params.query.steps.size() == 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
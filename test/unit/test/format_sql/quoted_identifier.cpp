@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/quoted_identifier.hpp>
+#include <boost/mysql/sequence.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/system/system_error.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+#include "format_common.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/ff_charset.hpp"
+
+using namespace boost::mysql;
+using test::format_single_error;
+
+//
+// quoted_identifier: identifiers escaped at construction.
+// Formatting them should be equivalent to formatting a string with {:i}
+//
+BOOST_AUTO_TEST_SUITE(test_quoted_identifier)
+
+constexpr format_options opts{utf8mb4_charset, true};
+constexpr format_options opts_ff{test::ff_charset, true};
+
+BOOST_AUTO_TEST_CASE(unqualified)
+{
+    // clang-format off
+    struct
+    {
+        string_view name;
+        string_view expected;
+    } test_cases[] = {
+        {"myident",            "`myident`"               },
+        {"",                   "``"                      },
+        {"my`ident",           "`my``ident`"             },
+        {"`",                  "````"                    },
+        {"my'ident\\",         "`my'ident\\`"            },
+        {"e\xc3\xb1u",         "`e\xc3\xb1u`"            },
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            quoted_identifier id(opts, tc.name);
+            BOOST_TEST(id.str() == tc.expected);
+            BOOST_TEST(format_sql(opts, "{}", id) == tc.expected);
+            BOOST_TEST(format_sql(opts, "{}", id) == format_sql(opts, "{:i}", tc.name));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(qualified)
+{
+    BOOST_TEST(quoted_identifier(opts, "db", "tab").str() == "`db`.`tab`");
+    BOOST_TEST(quoted_identifier(opts, "d`b", "t`ab").str() == "`d``b`.`t``ab`");
+    BOOST_TEST(quoted_identifier(opts, "", "").str() == "``.``");
+    BOOST_TEST(
+        format_sql(opts, "SELECT {} FROM t", quoted_identifier(opts, "t", "id")) == "SELECT `t`.`id` FROM t"
+    );
+}
+
+BOOST_AUTO_TEST_CASE(ff_charset)
+{
+    // Backticks within multi-byte characters are not escaped
+    BOOST_TEST(quoted_identifier(opts_ff, "a\xff`b`").str() == "`a\xff`b```");
+    BOOST_TEST(quoted_identifier(opts_ff, "\xff`", "\xff`").str() == "`\xff``.`\xff``");
+}
+
+// Invalid identifiers are rejected at construction
+BOOST_AUTO_TEST_CASE(error_invalid_encoding)
+{
+    BOOST_CHECK_THROW(quoted_identifier(opts, "abc\xc3"), boost::system::system_error);
+    BOOST_CHECK_THROW(quoted_identifier(opts, "abc\xc3", "tab"), boost::system::system_error);
+    BOOST_CHECK_THROW(quoted_identifier(opts, "db", "abc\xc3"), boost::system::system_error);
+    BOOST_CHECK_THROW(quoted_identifier(opts_ff, "abc\xff"), boost::system::system_error);
+}
+
+// Identifiers with non-ASCII characters depend on the character set
+BOOST_AUTO_TEST_CASE(charset_mismatch)
+{
+    quoted_identifier id(opts_ff, "a\xff`");
+    BOOST_TEST(format_sql(opts_ff, "{}", id) == "`a\xff``");
+
+    format_context ctx(opts);
+    format_sql_to(ctx, "SELECT {}", id);
+    BOOST_TEST(std::move(ctx).get().error() == client_errc::invalid_encoding);
+}
+
+// ASCII identifiers can be used with any character set
+BOOST_AUTO_TEST_CASE(ascii_any_charset)
+{
+    quoted_identifier id(opts, "my`id");
+    BOOST_TEST(format_sql(opts_ff, "{}", id) == "`my``id`");
+    BOOST_TEST(format_sql(format_options{ascii_charset, false}, "{}", id) == "`my``id`");
+}
+
+// Format specifiers are not supported
+BOOST_AUTO_TEST_CASE(error_specifiers)
+{
+    quoted_identifier id(opts, "abc");
+    BOOST_TEST(format_single_error("{:i}", id) == client_errc::format_string_invalid_specifier);
+    BOOST_TEST(format_single_error("{:r}", id) == client_errc::format_string_invalid_specifier);
+}
+
+// Can be used in ranges and sequences
+BOOST_AUTO_TEST_CASE(ranges)
+{
+    std::vector<quoted_identifier> ids{
+        {opts, "id"},
+        {opts, "t", "name"},
+        {opts, "a`b"}
+    };
+    BOOST_TEST(format_sql(opts, "SELECT {} FROM t", ids) == "SELECT `id`, `t`.`name`, `a``b` FROM t");
+
+    std::vector<std::string> names{"c1", "c2"};
+    auto fn = [](const std::string& name, format_context_base& ctx) {
+        ctx.append_value(quoted_identifier(ctx.format_opts(), name)).append_raw(" = 1");
+    };
+    BOOST_TEST(
+        format_sql(opts, "WHERE {}", sequence(names, fn, " AND ")) == "WHERE `c1` = 1 AND `c2` = 1"
+    );
+}
+
+// The size hint is exact for quoted identifiers
+BOOST_AUTO_TEST_CASE(size_hint)
+{
+    quoted_identifier id(opts, "db", "t`b");
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT * FROM {}", id) == 25u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
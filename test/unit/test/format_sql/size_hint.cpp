@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/query_template.hpp>
+#include <boost/mysql/sequence.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/mysql/detail/config.hpp>
+#include <boost/mysql/detail/format_sql.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "format_common.hpp"
+#include "test_common/printing.hpp"
+
+#ifdef BOOST_MYSQL_CXX14
+#include <boost/mysql/compiled_format.hpp>
+#endif
+
+using namespace boost::mysql;
+
+//
+// format_sql_size_hint: upper bounds for the size of formatted queries
+//
+BOOST_AUTO_TEST_SUITE(test_format_sql_size_hint)
+
+constexpr format_options opts{utf8mb4_charset, true};
+constexpr format_options opts_nobackslash{utf8mb4_charset, false};
+
+// Built-in types are measured without being formatted
+BOOST_AUTO_TEST_CASE(individual_values)
+{
+    const unsigned char blob_data[] = {0x00, 0xab, 0xff};
+
+    // clang-format off
+    struct
+    {
+        string_view name;
+        format_options opts;
+        constant_string_view format_str;
+        formattable_ref arg;
+        std::size_t expected;
+    } test_cases[] = {
+        {"null",               opts,             "{}",   nullptr,                                     4u},
+        {"int64_min",          opts,             "{}",   (std::numeric_limits<std::int64_t>::min)(),  20u},
+        {"int64_small",        opts,             "{}",   42,                                          20u},
+        {"uint64_max",         opts,             "{}",   (std::numeric_limits<std::uint64_t>::max)(), 20u},
+        {"double",             opts,             "{}",   -4.2e-120,                                   24u},
+        {"float",              opts,             "{}",   4.2f,                                        24u},
+        {"string_empty",       opts,             "{}",   "",                                          2u},
+        {"string_plain",       opts,             "{}",   "abc",                                       5u},
+        {"string_escapes",     opts,             "{}",   "a'b\"c\\d\ne\r\x1a",                        19u},
+        {"string_nobackslash", opts_nobackslash, "{}",   "a'b\"c\\d",                                 10u},
+        {"string_utf8",        opts,             "{}",   "\xc3\xb1'",                                 6u},
+        {"string_identifier",  opts,             "{:i}", "a`b'c",                                     8u},
+        {"string_raw",         opts,             "{:r}", "a'b",                                       3u},
+        {"blob_empty",         opts,             "{}",   blob_view(),                                 3u},
+        {"blob",               opts,             "{}",   blob_view(blob_data),                        9u},
+        {"date",               opts,             "{}",   date(2021, 1, 10),                           16u},
+        {"datetime",           opts,             "{}",   datetime(2021, 1, 10, 10, 1, 2, 1234),       39u},
+        {"time",               opts,             "{}",   (time::min)(),                               36u},
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto res = format_sql_size_hint(tc.opts, tc.format_str, tc.arg);
+            BOOST_TEST(res == tc.expected);
+            BOOST_TEST(res >= format_sql(tc.opts, tc.format_str, tc.arg).size());
+        }
+    }
+}
+
+// Literals are measured exactly
+BOOST_AUTO_TEST_CASE(format_strings)
+{
+    BOOST_TEST(format_sql_size_hint(opts, "") == 0u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT 1") == 8u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT '{{}}'") == 11u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT {}, {}", "abc", nullptr) == 18u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT {1}, {0}", "abc", nullptr) == 18u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT {val}, {val}", {{"val", "abc"}}) == 19u);
+    BOOST_TEST(format_sql_size_hint(opts, "SELECT `e\xc3\xb1u` + {}", nullptr) == 20u);
+}
+
+// Ranges and custom formatters are traversed, measuring the values they contain
+BOOST_AUTO_TEST_CASE(ranges_custom)
+{
+    std::vector<std::string> strs{"abc", "d'e"};
+    std::vector<custom::condition> conds{
+        {"id",  42},
+        {"f`x", 1 }
+    };
+    custom::condition cond{"id", 42};
+
+    // clang-format off
+    struct
+    {
+        string_view name;
+        constant_string_view format_str;
+        formattable_ref arg;
+        std::size_t expected;
+    } test_cases[] = {
+        {"range",        "IN ({})",      strs,  18u},
+        {"range_id",     "SELECT {::i}", strs,  19u},
+        {"custom",       "WHERE {}",     cond,  31u},
+        {"range_custom", "VALUES {}",    conds, 61u},
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto res = format_sql_size_hint(opts, tc.format_str, tc.arg);
+            BOOST_TEST(res == tc.expected);
+            BOOST_TEST(res >= format_sql(opts, tc.format_str, tc.arg).size());
+        }
+    }
+
+    // Sequences invoke their formatter function for each element
+    auto seq = sequence(conds, [](const custom::condition& c, format_context_base& ctx) {
+        format_sql_to(ctx, "({}, {})", c.name, c.value);
+    });
+    auto res = format_sql_size_hint(opts, "INSERT INTO t VALUES {}", seq);
+    BOOST_TEST(res == 21u + (1u + 4u + 2u + 20u + 1u) + 2u + (1u + 5u + 2u + 20u + 1u));
+    BOOST_TEST(res >= format_sql(opts, "INSERT INTO t VALUES {}", seq).size());
+}
+
+// Using the hint to reserve space
+BOOST_AUTO_TEST_CASE(reserve)
+{
+    std::vector<int> values(1000, 42);
+    auto fn = [](int v, format_context_base& ctx) { format_sql_to(ctx, "({}, 'abc')", v); };
+    auto hint = format_sql_size_hint(opts, "INSERT INTO t VALUES {}", sequence(values, fn));
+
+    std::string storage;
+    storage.reserve(hint);
+    const char* original_data = storage.data();
+
+    format_context ctx(opts, std::move(storage));
+    format_sql_to(ctx, "INSERT INTO t VALUES {}", sequence(values, fn));
+    auto res = std::move(ctx).get().value();
+    BOOST_TEST(res.size() <= hint);
+    BOOST_TEST(res.data() == original_data);
+}
+
+// If formatting would fail, the hint is unspecified, but computing it doesn't fail
+BOOST_AUTO_TEST_CASE(errors)
+{
+    BOOST_CHECK_NO_THROW(format_sql_size_hint(opts, "SELECT {} {}", 42));
+    BOOST_CHECK_NO_THROW(format_sql_size_hint(opts, "SELECT {", 42));
+    BOOST_CHECK_NO_THROW(format_sql_size_hint(opts, "SELECT {:z}", 42));
+    BOOST_CHECK_NO_THROW(format_sql_size_hint(opts, "SELECT {}", "bad\xff"));
+    BOOST_CHECK_NO_THROW(format_sql_size_hint(opts, "SELECT {}", std::numeric_limits<double>::quiet_NaN()));
+}
+
+// The estimate used by the connection doesn't parse the format string or invoke custom formatters
+BOOST_AUTO_TEST_CASE(estimate_formatted_size)
+{
+    std::vector<int> values{1, 2, 3};
+    std::initializer_list<format_arg> args{
+        {"",  "abc" },
+        {"",  42    },
+        {"",  values},
+    };
+    BOOST_TEST(detail::estimate_formatted_size(opts, "SELECT {}, {}, {}", args) == 17u + 5u + 20u);
+    BOOST_TEST(detail::estimate_formatted_size(opts, "", {}) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_template_)
+{
+    query_template tmpl("SELECT {}, {name}");
+    BOOST_TEST(format_sql_size_hint(opts, tmpl, {{"", 42}, {"name", "abc"}}) == 34u);
+
+    query_template tmpl2("SELECT {}, {}");
+    BOOST_TEST(format_sql_size_hint(opts, tmpl2, 42, "abc") == 34u);
+}
+
+#ifdef BOOST_MYSQL_CXX14
+BOOST_AUTO_TEST_CASE(compiled_format_)
+{
+    constexpr auto fmt = BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}");
+    BOOST_TEST(format_sql_size_hint(opts, fmt, 42, "abc") == 34u);
+
+    constexpr auto fmt_named = BOOST_MYSQL_COMPILE_FORMAT("SELECT {a}, {b}");
+    BOOST_TEST(format_sql_size_hint(opts, fmt_named, {{"a", 42}, {"b", "abc"}}) == 34u);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
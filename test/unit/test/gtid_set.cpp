@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "test_common/printing.hpp"
+
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_gtid_set)
+
+namespace {
+
+const gtid_source_id id1{
+    {0x3e, 0x11, 0xfa, 0x47, 0x71, 0xca, 0x11, 0xe1, 0x9e, 0x33, 0xc8, 0x0a, 0xa9, 0x42, 0x95, 0x62}
+};
+const gtid_source_id id2{
+    {0x4e, 0x11, 0xfa, 0x47, 0x71, 0xca, 0x11, 0xe1, 0x9e, 0x33, 0xc8, 0x0a, 0xa9, 0x42, 0x95, 0x62}
+};
+
+constexpr const char* id1_str = "3e11fa47-71ca-11e1-9e33-c80aa9429562";
+constexpr const char* id2_str = "4e11fa47-71ca-11e1-9e33-c80aa9429562";
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(default_ctor)
+{
+    gtid_set s;
+    BOOST_TEST(s.empty());
+    BOOST_TEST(!s.contains(id1, 1u));
+    BOOST_TEST(s.to_string() == "");
+}
+
+BOOST_AUTO_TEST_CASE(add)
+{
+    struct
+    {
+        string_view name;
+        std::uint64_t first;
+        std::uint64_t last;
+        const char* expected;
+    } test_cases[] = {
+        {"before",          1,  2,  ":1-2:5-10:20-30"  },
+        {"adjacent_before", 1,  4,  ":1-10:20-30"      },
+        {"overlap_before",  1,  6,  ":1-10:20-30"      },
+        {"contained",       6,  8,  ":5-10:20-30"      },
+        {"same",            5,  10, ":5-10:20-30"      },
+        {"overlap_after",   9,  12, ":5-12:20-30"      },
+        {"adjacent_after",  11, 11, ":5-11:20-30"      },
+        {"between",         13, 15, ":5-10:13-15:20-30"},
+        {"join_adjacent",   11, 19, ":5-30"            },
+        {"join_overlap",    7,  25, ":5-30"            },
+        {"cover_all",       1,  40, ":1-40"            },
+        {"after",           35, 35, ":5-10:20-30:35"   },
+        {"adjacent_last",   31, 31, ":5-10:20-31"      },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            gtid_set s;
+            s.add(id1, 5u, 10u);
+            s.add(id1, 20u, 30u);
+            s.add(id1, tc.first, tc.last);
+            BOOST_TEST(s.to_string() == std::string(id1_str) + tc.expected);
+        }
+    }
+}
+
+// The binlog protocol encodes intervals as [first, last + 1), so the maximum ID is rejected
+BOOST_AUTO_TEST_CASE(add_max_transaction_id)
+{
+    constexpr auto max_id = UINT64_MAX;
+    const std::string expected = std::string(id1_str) + ":18446744073709551613-18446744073709551614";
+    gtid_set s;
+    s.add(id1, max_id - 2u);
+    s.add(id1, max_id - 1u);
+    BOOST_TEST(s.contains(id1, max_id - 1u));
+    BOOST_TEST(s.to_string() == expected);
+
+    BOOST_CHECK_THROW(s.add(id1, max_id), std::invalid_argument);
+    BOOST_CHECK_THROW(s.add(id1, 1u, max_id), std::invalid_argument);
+    BOOST_CHECK_THROW(s.add(id2, max_id), std::invalid_argument);
+    BOOST_TEST(s.to_string() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(add_several_sources)
+{
+    // Sources are kept sorted, regardless of insertion order
+    gtid_set s;
+    s.add(id2, 3u);
+    s.add(id1, 1u);
+    s.add(id1, 2u);
+    BOOST_TEST(!s.empty());
+    BOOST_TEST(s.to_string() == std::string(id1_str) + ":1-2," + id2_str + ":3");
+}
+
+BOOST_AUTO_TEST_CASE(contains)
+{
+    gtid_set s;
+    s.add(id1, 5u, 10u);
+    s.add(id1, 20u);
+
+    BOOST_TEST(!s.contains(id1, 4u));
+    BOOST_TEST(s.contains(id1, 5u));
+    BOOST_TEST(s.contains(id1, 7u));
+    BOOST_TEST(s.contains(id1, 10u));
+    BOOST_TEST(!s.contains(id1, 11u));
+    BOOST_TEST(!s.contains(id1, 19u));
+    BOOST_TEST(s.contains(id1, 20u));
+    BOOST_TEST(!s.contains(id1, 21u));
+    BOOST_TEST(!s.contains(id2, 5u));
+}
+
+BOOST_AUTO_TEST_CASE(clear)
+{
+    gtid_set s;
+    s.add(id1, 5u, 10u);
+    s.clear();
+    BOOST_TEST(s.empty());
+    BOOST_TEST(!s.contains(id1, 5u));
+}
+
+BOOST_AUTO_TEST_CASE(parse_success)
+{
+    struct
+    {
+        string_view name;
+        string_view input;
+        const char* expected;
+    } test_cases[] = {
+        {"empty",             "",                                                 ""           },
+        {"whitespace",        "  \n ",                                            ""           },
+        {"single",            "3e11fa47-71ca-11e1-9e33-c80aa9429562:23",          ":23"        },
+        {"range",             "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5",         ":1-5"       },
+        {"several_intervals", "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5:7:9-10",  ":1-5:7:9-10"},
+        {"unsorted",          "3e11fa47-71ca-11e1-9e33-c80aa9429562:9-10:1-5",    ":1-5:9-10"  },
+        {"merged",            "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5:6-10",    ":1-10"      },
+        {"uppercase",         "3E11FA47-71CA-11E1-9E33-C80AA9429562:1",           ":1"         },
+        {"no_dashes",         "3e11fa4771ca11e19e33c80aa9429562:1",               ":1"         },
+        {"spaces",            " 3e11fa47-71ca-11e1-9e33-c80aa9429562 : 1 - 5 \n", ":1-5"       },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto res = gtid_set::parse(tc.input);
+            BOOST_TEST_REQUIRE(res.has_value());
+            std::string expected = *tc.expected ? std::string(id1_str) + tc.expected : std::string();
+            BOOST_TEST(res->to_string() == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parse_several_sources)
+{
+    // Output of SELECT @@gtid_executed contains newlines after commas
+    auto res = gtid_set::parse(
+        "4e11fa47-71ca-11e1-9e33-c80aa9429562:3,\n"
+        "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-2"
+    );
+    BOOST_TEST_REQUIRE(res.has_value());
+    BOOST_TEST(res->to_string() == std::string(id1_str) + ":1-2," + id2_str + ":3");
+}
+
+BOOST_AUTO_TEST_CASE(parse_error)
+{
+    struct
+    {
+        string_view name;
+        string_view input;
+    } test_cases[] = {
+        {"no_intervals",     "3e11fa47-71ca-11e1-9e33-c80aa9429562"                     },
+        {"empty_interval",   "3e11fa47-71ca-11e1-9e33-c80aa9429562:"                    },
+        {"zero",             "3e11fa47-71ca-11e1-9e33-c80aa9429562:0"                   },
+        {"reversed_range",   "3e11fa47-71ca-11e1-9e33-c80aa9429562:5-1"                 },
+        {"incomplete_range", "3e11fa47-71ca-11e1-9e33-c80aa9429562:5-"                  },
+        {"overflow",         "3e11fa47-71ca-11e1-9e33-c80aa9429562:18446744073709551616"},
+        {"short_uuid",       "3e11fa47-71ca-11e1-9e33-c80aa942956:1"                    },
+        {"bad_hex",          "3e11fa47-71ca-11e1-9e33-c80aa942956g:1"                   },
+        {"misplaced_dash",   "3e11fa4-771ca-11e1-9e33-c80aa9429562:1"                   },
+        {"double_dash",      "3e11fa47--71ca-11e1-9e33-c80aa9429562:1"                  },
+        {"trailing_comma",   "3e11fa47-71ca-11e1-9e33-c80aa9429562:1,"                  },
+        {"trailing_chars",   "3e11fa47-71ca-11e1-9e33-c80aa9429562:1 abc"               },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto res = gtid_set::parse(tc.input);
+            BOOST_TEST(res.error() == client_errc::invalid_gtid_set);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parse_max_transaction_id)
+{
+    // The maximum ID minus one is the greatest representable ID
+    auto res = gtid_set::parse("3e11fa47-71ca-11e1-9e33-c80aa9429562:18446744073709551614");
+    BOOST_TEST_REQUIRE(res.has_value());
+    BOOST_TEST(res->to_string() == std::string(id1_str) + ":18446744073709551614");
+
+    // The maximum ID is rejected, both as a single ID and as a range's end
+    res = gtid_set::parse("3e11fa47-71ca-11e1-9e33-c80aa9429562:18446744073709551615");
+    BOOST_TEST(res.error() == client_errc::invalid_gtid_set);
+    res = gtid_set::parse("3e11fa47-71ca-11e1-9e33-c80aa9429562:1-18446744073709551615");
+    BOOST_TEST(res.error() == client_errc::invalid_gtid_set);
+}
+
+BOOST_AUTO_TEST_CASE(parse_to_string_roundtrip)
+{
+    const char* input = "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5:7,4e11fa47-71ca-11e1-9e33-c80aa9429562:3";
+    auto res = gtid_set::parse(input);
+    BOOST_TEST_REQUIRE(res.has_value());
+    BOOST_TEST(res->to_string() == input);
+    BOOST_TEST((gtid_set::parse(res->to_string()).value() == *res));
+}
+
+BOOST_AUTO_TEST_CASE(operator_equals)
+{
+    gtid_set s1, s2, s3, s4;
+    s1.add(id1, 1u, 5u);
+    s2.add(id1, 1u, 3u);
+    s2.add(id1, 4u, 5u);
+    s3.add(id1, 1u, 6u);
+    s4.add(id1, 1u, 5u);
+    s4.add(id2, 1u);
+
+    BOOST_TEST((s1 == s2));
+    BOOST_TEST((!(s1 != s2)));
+    BOOST_TEST((s1 != s3));
+    BOOST_TEST((s1 != s4));
+    BOOST_TEST((s1 != gtid_set()));
+    BOOST_TEST((gtid_set() == gtid_set()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
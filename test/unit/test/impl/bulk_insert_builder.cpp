@@ -0,0 +1,355 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/detail/config.hpp>
+
+#ifdef BOOST_MYSQL_CXX14
+
+#include <boost/mysql/character_set.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/format_sql.hpp>
+#include <boost/mysql/pipeline.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/bulk_insert.hpp>
+#include <boost/mysql/detail/pipeline.hpp>
+#include <boost/mysql/detail/resultset_encoding.hpp>
+
+#include <boost/mysql/impl/internal/bulk_insert.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/describe/class.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_common/assert_buffer_equals.hpp"
+#include "test_common/buffer_concat.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_query_frame.hpp"
+#include "test_unit/printing.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using detail::bulk_insert_builder;
+using detail::pipeline_request_stage;
+using detail::pipeline_stage_kind;
+using detail::resultset_encoding;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_bulk_insert_builder)
+
+constexpr format_options opts{utf8mb4_charset, true};
+constexpr string_view prefix = "INSERT INTO t VALUES ";
+constexpr std::size_t big_size = 0x100000;
+
+// Every statement is a text query, sent in a single frame
+const pipeline_request_stage stmt_stage{pipeline_stage_kind::execute, 1u, resultset_encoding::text};
+
+void check_pipeline(
+    const pipeline_request& req,
+    const std::vector<std::uint8_t>& expected_buffer,
+    std::size_t expected_num_stages
+)
+{
+    const auto& impl = detail::access::get_impl(req);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(impl.buffer_, expected_buffer);
+    std::vector<pipeline_request_stage> expected_stages(expected_num_stages, stmt_stage);
+    BOOST_TEST(impl.stages_ == expected_stages, boost::test_tools::per_element());
+}
+
+struct employee
+{
+    std::int64_t id;
+    std::string name;
+    double salary;
+};
+BOOST_DESCRIBE_STRUCT(employee, (), (id, name, salary))
+
+// All rows fit in a single statement
+BOOST_AUTO_TEST_CASE(single_statement)
+{
+    std::vector<std::tuple<int, std::string>> rows{
+        {1, "abc"},
+        {2, "d'e"},
+    };
+    auto source = detail::make_bulk_insert_range_source(rows);
+    bulk_insert_builder builder(prefix, source, big_size, big_size);
+    pipeline_request req;
+
+    auto ec = builder.fill(req, opts);
+    BOOST_TEST(ec == error_code());
+    check_pipeline(req, create_query_frame(0, "INSERT INTO t VALUES (1, 'abc'), (2, 'd\\'e')"), 1u);
+    BOOST_TEST(builder.done());
+    BOOST_TEST(builder.rows_written() == 2u);
+}
+
+// Describe structs are formatted following member declaration order
+BOOST_AUTO_TEST_CASE(describe_structs)
+{
+    std::vector<employee> rows{
+        {1, "abc", 4.2},
+        {2, "def", 0.0},
+    };
+    auto source = detail::make_bulk_insert_range_source(rows);
+    bulk_insert_builder builder(prefix, source, big_size, big_size);
+    pipeline_request req;
+
+    auto ec = builder.fill(req, opts);
+    BOOST_TEST(ec == error_code());
+    check_pipeline(
+        req,
+        create_query_frame(0, "INSERT INTO t VALUES (1, 'abc', 4.2e+00), (2, 'def', 0e+00)"),
+        1u
+    );
+    BOOST_TEST(builder.done());
+}
+
+// The format options are used to escape strings
+BOOST_AUTO_TEST_CASE(format_options_)
+{
+    std::vector<std::tuple<std::string>> rows{{"d'e"}};
+    auto source = detail::make_bulk_insert_range_source(rows);
+    bulk_insert_builder builder(prefix, source, big_size, big_size);
+    pipeline_request req;
+
+    auto ec = builder.fill(req, {utf8mb4_charset, false});
+    BOOST_TEST(ec == error_code());
+    check_pipeline(req, create_query_frame(0, "INSERT INTO t VALUES ('d''e')"), 1u);
+}
+
+// Rows are split into several statements when they don't fit in a single one.
+// The statement size includes the command byte
+BOOST_AUTO_TEST_CASE(several_statements)
+{
+    std::vector<std::tuple<int>> rows{{1}, {2}, {3}, {4}, {5}};
+
+    // clang-format off
+    struct
+    {
+        string_view name;
+        std::size_t max_statement_size;
+        std::vector<std::uint8_t> expected;
+        std::size_t expected_num_stages;
+    } test_cases[] = {
+        {
+            "exact_fit",
+            30u,
+            buffer_builder()
+                .add(create_query_frame(0, "INSERT INTO t VALUES (1), (2)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (3), (4)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (5)"))
+                .build(),
+            3u,
+        },
+        {
+            "one_byte_less",
+            29u,
+            buffer_builder()
+                .add(create_query_frame(0, "INSERT INTO t VALUES (1)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (2)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (3)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (4)"))
+                .add(create_query_frame(0, "INSERT INTO t VALUES (5)"))
+                .build(),
+            5u,
+        },
+        {
+            "three_rows",
+            35u,
+            concat(
+                create_query_frame(0, "INSERT INTO t VALUES (1), (2), (3)"),
+                create_query_frame(0, "INSERT INTO t VALUES (4), (5)")
+            ),
+            2u,
+        },
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto source = detail::make_bulk_insert_range_source(rows);
+            bulk_insert_builder builder(prefix, source, tc.max_statement_size, big_size);
+            pipeline_request req;
+
+            auto ec = builder.fill(req, opts);
+            BOOST_TEST(ec == error_code());
+            check_pipeline(req, tc.expected, tc.expected_num_stages);
+            BOOST_TEST(builder.done());
+            BOOST_TEST(builder.rows_written() == 5u);
+        }
+    }
+}
+
+// Statements are added to a pipeline until it reaches max_pipeline_size.
+// Every statement here takes 34 bytes
+BOOST_AUTO_TEST_CASE(pipeline_size)
+{
+    std::vector<std::tuple<int>> rows{{1}, {2}, {3}, {4}, {5}};
+    auto stmt1 = create_query_frame(0, "INSERT INTO t VALUES (1), (2)");
+    auto stmt2 = create_query_frame(0, "INSERT INTO t VALUES (3), (4)");
+    auto stmt3 = create_query_frame(0, "INSERT INTO t VALUES (5)");
+
+    // The pipeline is smaller than a statement: a statement is always added
+    {
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 30u, 1u);
+        pipeline_request req;
+
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, stmt1, 1u);
+        BOOST_TEST(!builder.done());
+        BOOST_TEST(builder.rows_written() == 2u);
+
+        // Filling again clears the request
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, stmt2, 1u);
+        BOOST_TEST(!builder.done());
+
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, stmt3, 1u);
+        BOOST_TEST(builder.done());
+        BOOST_TEST(builder.rows_written() == 5u);
+    }
+
+    // Statements are added while the pipeline is below the limit
+    {
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 30u, 35u);
+        pipeline_request req;
+
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, concat(stmt1, stmt2), 2u);
+        BOOST_TEST(!builder.done());
+
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, stmt3, 1u);
+        BOOST_TEST(builder.done());
+    }
+
+    // A limit equal to the current size stops adding statements
+    {
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 30u, 34u);
+        pipeline_request req;
+
+        BOOST_TEST(builder.fill(req, opts) == error_code());
+        check_pipeline(req, stmt1, 1u);
+    }
+}
+
+// An empty range doesn't generate any statement
+BOOST_AUTO_TEST_CASE(empty_range)
+{
+    std::vector<std::tuple<int>> rows;
+    auto source = detail::make_bulk_insert_range_source(rows);
+    bulk_insert_builder builder(prefix, source, big_size, big_size);
+    pipeline_request req;
+
+    BOOST_TEST(builder.fill(req, opts) == error_code());
+    check_pipeline(req, {}, 0u);
+    BOOST_TEST(builder.done());
+    BOOST_TEST(builder.rows_written() == 0u);
+}
+
+// A row that doesn't fit in a statement by itself is an error
+BOOST_AUTO_TEST_CASE(row_too_large)
+{
+    // First row
+    {
+        std::vector<std::tuple<int>> rows{{1}};
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 24u, big_size);
+        pipeline_request req;
+        BOOST_TEST(builder.fill(req, opts) == client_errc::bulk_insert_row_too_large);
+    }
+
+    // A subsequent row
+    {
+        std::vector<std::tuple<int>> rows{{1}, {12345678}};
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 30u, big_size);
+        pipeline_request req;
+        BOOST_TEST(builder.fill(req, opts) == client_errc::bulk_insert_row_too_large);
+        BOOST_TEST(builder.rows_written() == 1u);
+    }
+
+    // The prefix alone exceeds the limit
+    {
+        std::vector<std::tuple<int>> rows{{1}};
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, 10u, big_size);
+        pipeline_request req;
+        BOOST_TEST(builder.fill(req, opts) == client_errc::bulk_insert_row_too_large);
+    }
+}
+
+// Statements never exceed a single frame, regardless of the configured size
+BOOST_AUTO_TEST_CASE(max_statement_size_capped)
+{
+    // The payload for the first statement (command byte, prefix, parens and quotes) is exactly 0xfffffe bytes
+    std::string value(0xfffffeu - 1u - prefix.size() - 4u, 'a');
+    std::vector<std::tuple<std::string>> rows{{value}, {"b"}};
+    auto source = detail::make_bulk_insert_range_source(rows);
+    bulk_insert_builder builder(prefix, source, 0x2000000, 1u);
+    pipeline_request req;
+
+    BOOST_TEST(builder.fill(req, opts) == error_code());
+    const auto& impl = detail::access::get_impl(req);
+    BOOST_TEST_REQUIRE(impl.stages_.size() == 1u);
+    BOOST_TEST(impl.buffer_.size() == 4u + 0xfffffeu);
+    BOOST_TEST(impl.buffer_[0] == 0xfe);
+    BOOST_TEST(impl.buffer_[1] == 0xff);
+    BOOST_TEST(impl.buffer_[2] == 0xff);
+    BOOST_TEST(impl.buffer_[3] == 0x00);
+
+    BOOST_TEST(builder.fill(req, opts) == error_code());
+    check_pipeline(req, create_query_frame(0, "INSERT INTO t VALUES ('b')"), 1u);
+    BOOST_TEST(builder.done());
+}
+
+// Errors formatting rows are reported
+BOOST_AUTO_TEST_CASE(format_error)
+{
+    // First row
+    {
+        std::vector<std::tuple<int, std::string>> rows{
+            {1, "bad\xff"},
+        };
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, big_size, big_size);
+        pipeline_request req;
+        BOOST_TEST(builder.fill(req, opts) == client_errc::invalid_encoding);
+    }
+
+    // A subsequent row
+    {
+        std::vector<std::tuple<int, std::string>> rows{
+            {1, "abc"   },
+            {2, "bad\xff"},
+        };
+        auto source = detail::make_bulk_insert_range_source(rows);
+        bulk_insert_builder builder(prefix, source, big_size, big_size);
+        pipeline_request req;
+        BOOST_TEST(builder.fill(req, opts) == client_errc::invalid_encoding);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+
+#endif
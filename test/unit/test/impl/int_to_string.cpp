@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/impl/internal/int_to_string.hpp>
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace boost::mysql;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_int_to_string)
+
+// Using heap-allocated buffers of the exact maximum size helps asan detect overflows
+template <class T>
+std::string invoke_write_int(T value)
+{
+    std::string res(20, '\0');
+    char* end = detail::write_int(&res[0], value);
+    res.resize(end - res.data());
+    return res;
+}
+
+template <class T>
+std::string call_to_chars(T value)
+{
+    char buff[32];
+    auto res = boost::charconv::to_chars(buff, buff + sizeof(buff), value);
+    return std::string(buff, res.ptr);
+}
+
+BOOST_AUTO_TEST_CASE(write_int_unsigned)
+{
+    // clang-format off
+    struct
+    {
+        std::uint64_t value;
+        string_view expected;
+    } test_cases[] = {
+        {0u,                                            "0"                   },
+        {1u,                                            "1"                   },
+        {9u,                                            "9"                   },
+        {10u,                                           "10"                  },
+        {99u,                                           "99"                  },
+        {100u,                                          "100"                 },
+        {101u,                                          "101"                 },
+        {999u,                                          "999"                 },
+        {1000u,                                         "1000"                },
+        {9999u,                                         "9999"                },
+        {10000u,                                        "10000"               },
+        {12345u,                                        "12345"               },
+        {4294967295u,                                   "4294967295"          },
+        {4294967296u,                                   "4294967296"          },
+        {9999999999999999999u,                          "9999999999999999999" },
+        {10000000000000000000u,                         "10000000000000000000"},
+        {(std::numeric_limits<std::uint64_t>::max)(),   "18446744073709551615"},
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.value)
+        {
+            BOOST_TEST(detail::count_digits(tc.value) == tc.expected.size());
+            BOOST_TEST(invoke_write_int(tc.value) == tc.expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(write_int_signed)
+{
+    // clang-format off
+    struct
+    {
+        std::int64_t value;
+        string_view expected;
+    } test_cases[] = {
+        {0,                                            "0"                   },
+        {-1,                                           "-1"                  },
+        {5,                                            "5"                   },
+        {-10,                                          "-10"                 },
+        {-99,                                          "-99"                 },
+        {-100,                                         "-100"                },
+        {42000,                                        "42000"               },
+        {-42000,                                       "-42000"              },
+        {(std::numeric_limits<std::int64_t>::max)(),   "9223372036854775807" },
+        {(std::numeric_limits<std::int64_t>::min)(),   "-9223372036854775808"},
+    };
+    // clang-format on
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.value) { BOOST_TEST(invoke_write_int(tc.value) == tc.expected); }
+    }
+}
+
+// Every power of 10 and its neighbors, compared against charconv
+BOOST_AUTO_TEST_CASE(write_int_powers_of_10)
+{
+    std::uint64_t power = 1u;
+    for (int i = 0; i < 20; ++i)
+    {
+        for (std::uint64_t value : {power - 1u, power, power + 1u})
+        {
+            BOOST_TEST_CONTEXT(value)
+            {
+                BOOST_TEST(invoke_write_int(value) == call_to_chars(value));
+                auto signed_value = static_cast<std::int64_t>(value);
+                if (signed_value >= 0)
+                {
+                    BOOST_TEST(invoke_write_int(signed_value) == call_to_chars(signed_value));
+                    BOOST_TEST(invoke_write_int(-signed_value) == call_to_chars(-signed_value));
+                }
+            }
+        }
+        power *= 10u;
+    }
+}
+
+// Random values, compared against charconv
+BOOST_AUTO_TEST_CASE(write_int_random)
+{
+    std::mt19937_64 gen{std::random_device{}()};
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Shift to get values with all possible number of digits
+        std::uint64_t value = gen() >> (i % 64);
+        auto signed_value = static_cast<std::int64_t>(value);
+        BOOST_TEST_CONTEXT(value)
+        {
+            BOOST_TEST(invoke_write_int(value) == call_to_chars(value));
+            BOOST_TEST(invoke_write_int(signed_value) == call_to_chars(signed_value));
+        }
+    }
+}
+
+// Fixed-width writers pad with zeros
+BOOST_AUTO_TEST_CASE(fixed_width)
+{
+    std::string buff(6, '\0');
+
+    detail::write_2digits(&buff[0], 0u);
+    BOOST_TEST(buff.substr(0, 2) == "00");
+    detail::write_2digits(&buff[0], 7u);
+    BOOST_TEST(buff.substr(0, 2) == "07");
+    detail::write_2digits(&buff[0], 99u);
+    BOOST_TEST(buff.substr(0, 2) == "99");
+
+    detail::write_4digits(&buff[0], 0u);
+    BOOST_TEST(buff.substr(0, 4) == "0000");
+    detail::write_4digits(&buff[0], 305u);
+    BOOST_TEST(buff.substr(0, 4) == "0305");
+    detail::write_4digits(&buff[0], 9999u);
+    BOOST_TEST(buff.substr(0, 4) == "9999");
+
+    detail::write_6digits(&buff[0], 0u);
+    BOOST_TEST(buff == "000000");
+    detail::write_6digits(&buff[0], 1020u);
+    BOOST_TEST(buff == "001020");
+    detail::write_6digits(&buff[0], 999999u);
+    BOOST_TEST(buff == "999999");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
@@ -14,13 +14,20 @@
 #include <boost/asio/generic/stream_protocol.hpp>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/connect_pair.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/core/span.hpp>
 #include <boost/test/tools/detail/per_element_manip.hpp>
 #include <boost/test/tools/detail/print_helper.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <ostream>
+#include <thread>
+#include <utility>
 
 #include "test_common/io_context_fixture.hpp"
 #include "test_common/printing.hpp"
@@ -203,6 +210,105 @@ BOOST_FIXTURE_TEST_CASE(unix_unsupported, fixture)
 }
 #endif
 
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+// busy_poll_read_some
+struct busy_poll_fixture : io_context_fixture
+{
+    asio::generic::stream_protocol::socket sock{ctx};
+    asio::local::stream_protocol::socket peer{ctx};
+    std::array<std::uint8_t, 16> buff{};
+    const std::uint8_t msg[3]{0x01, 0x02, 0x03};
+    const std::chrono::microseconds duration{std::chrono::seconds(10)};
+
+    void write_msg_later()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        asio::write(peer, asio::buffer(msg));
+    }
+
+    busy_poll_fixture()
+    {
+        asio::local::stream_protocol::socket s(ctx);
+        asio::local::connect_pair(s, peer);
+        sock = asio::generic::stream_protocol::socket(std::move(s));
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_data_available, busy_poll_fixture)
+{
+    // Setup
+    asio::write(peer, asio::buffer(msg));
+
+    // Read
+    error_code ec;
+    auto bytes = detail::busy_poll_read_some(sock, asio::buffer(buff), duration, ec);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(bytes == 3u);
+    BOOST_TEST(span<const std::uint8_t>(buff.data(), bytes) == msg, per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_data_later, busy_poll_fixture)
+{
+    // Data is written while we're polling
+    std::thread writer([this] { write_msg_later(); });
+
+    // Read
+    error_code ec;
+    auto bytes = detail::busy_poll_read_some(sock, asio::buffer(buff), duration, ec);
+    writer.join();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(bytes == 3u);
+    BOOST_TEST(span<const std::uint8_t>(buff.data(), bytes) == msg, per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_duration_exceeded, busy_poll_fixture)
+{
+    // Data is written after we stop polling. We block until it arrives
+    std::thread writer([this] { write_msg_later(); });
+
+    // Read
+    error_code ec;
+    auto bytes = detail::busy_poll_read_some(sock, asio::buffer(buff), std::chrono::microseconds(1), ec);
+    writer.join();
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(bytes == 3u);
+    BOOST_TEST(span<const std::uint8_t>(buff.data(), bytes) == msg, per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_eof, busy_poll_fixture)
+{
+    // Setup
+    peer.close();
+
+    // Read
+    error_code ec;
+    auto bytes = detail::busy_poll_read_some(sock, asio::buffer(buff), duration, ec);
+    BOOST_TEST(ec == error_code(asio::error::eof));
+    BOOST_TEST(bytes == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_error, busy_poll_fixture)
+{
+    // Setup: reading from a closed socket fails
+    asio::generic::stream_protocol::socket closed_sock{ctx};
+
+    // Read
+    error_code ec;
+    auto bytes = detail::busy_poll_read_some(closed_sock, asio::buffer(buff), duration, ec);
+    BOOST_TEST(ec == error_code(asio::error::bad_descriptor));
+    BOOST_TEST(bytes == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(busy_poll_read_some_empty_buffer, busy_poll_fixture)
+{
+    // Doesn't block, even if no data is available
+    error_code ec = asio::error::already_open;
+    auto bytes = detail::busy_poll_read_some(sock, asio::mutable_buffer(), duration, ec);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(bytes == 0u);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
\ No newline at end of file
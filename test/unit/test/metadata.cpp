@@ -11,11 +11,14 @@
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/coldef_view.hpp>
+#include <boost/mysql/detail/metadata_arena.hpp>
 
 #include <boost/test/unit_test.hpp>
 
 #include "test_unit/create_meta.hpp"
 
+#include <string>
+
 using namespace boost::mysql;
 using namespace boost::mysql::test;
 namespace collations = boost::mysql::mysql_collations;
@@ -169,15 +172,77 @@ BOOST_AUTO_TEST_CASE(dont_copy_strings)
 BOOST_AUTO_TEST_CASE(string_ownership)
 {
     // Create the meta object
-    std::string colname = "col1";
-    auto msg = meta_builder().name(colname).build_coldef();
+    std::string db = "db", table = "table", org_table = "org_table", colname = "col1", org_colname = "org";
+    auto msg = meta_builder()
+                   .database(db)
+                   .table(table)
+                   .org_table(org_table)
+                   .name(colname)
+                   .org_name(org_colname)
+                   .build_coldef();
     auto meta = detail::access::construct<metadata>(msg, true);
 
     // Check that we actually copy the data
+    db = "abcd";
+    table = "abcd";
+    org_table = "abcd";
     colname = "abcd";
+    org_colname = "abcd";
+    BOOST_TEST(meta.database() == "db");
+    BOOST_TEST(meta.table() == "table");
+    BOOST_TEST(meta.original_table() == "org_table");
     BOOST_TEST(meta.column_name() == "col1");
+    BOOST_TEST(meta.original_column_name() == "org");
+}
+
+BOOST_AUTO_TEST_CASE(arena_shared)
+{
+    // Strings for several columns are placed contiguously in the same block
+    detail::metadata_arena arena;
+    auto meta1 = detail::access::construct<metadata>(
+        meta_builder().database("db").name("col1").build_coldef(),
+        true,
+        arena
+    );
+    auto meta2 = detail::access::construct<metadata>(meta_builder().name("col2").build_coldef(), true, arena);
+
+    BOOST_TEST(meta1.database() == "db");
+    BOOST_TEST(meta1.column_name() == "col1");
+    BOOST_TEST(meta2.column_name() == "col2");
+    BOOST_TEST(static_cast<const void*>(meta2.column_name().data()) == meta1.column_name().data() + 4);
+}
 
-    // TODO: the other strings
+BOOST_AUTO_TEST_CASE(arena_copies_outlive_arena)
+{
+    metadata meta;
+    {
+        detail::metadata_arena arena;
+        meta = detail::access::construct<metadata>(meta_builder().name("col1").build_coldef(), true, arena);
+    }
+    metadata meta2 = meta;
+    meta = metadata();
+    BOOST_TEST(meta2.column_name() == "col1");
+}
+
+BOOST_AUTO_TEST_CASE(arena_reset)
+{
+    detail::metadata_arena arena;
+    auto meta = detail::access::construct<metadata>(meta_builder().name("col1").build_coldef(), true, arena);
+
+    // The block is still referenced by meta, so reset doesn't reuse it
+    arena.reset();
+    auto meta2 = detail::access::construct<metadata>(meta_builder().name("col2").build_coldef(), true, arena);
+    BOOST_TEST(meta.column_name() == "col1");
+    BOOST_TEST(meta2.column_name() == "col2");
+    const char* block_data = meta2.column_name().data();
+
+    // Once all references are gone, the block is reused
+    meta = metadata();
+    meta2 = metadata();
+    arena.reset();
+    auto meta3 = detail::access::construct<metadata>(meta_builder().name("col3").build_coldef(), true, arena);
+    BOOST_TEST(meta3.column_name() == "col3");
+    BOOST_TEST(static_cast<const void*>(meta3.column_name().data()) == block_data);
 }
 
 BOOST_AUTO_TEST_SUITE_END()  // test_metadata
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/blob_view.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/field_kind.hpp>
+#include <boost/mysql/param_column.hpp>
+#include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common/printing.hpp"
+
+using namespace boost::mysql;
+
+BOOST_AUTO_TEST_SUITE(test_param_column)
+
+BOOST_AUTO_TEST_CASE(kind)
+{
+    const std::int64_t ints[] = {1, 2};
+    const std::uint64_t uints[] = {1};
+    const float floats[] = {1.0f};
+    const double doubles[] = {1.0};
+    const string_view strs[] = {"abc"};
+    const blob_view blobs[] = {blob_view()};
+    const date dates[] = {date()};
+    const datetime datetimes[] = {datetime()};
+    const boost::mysql::time times[] = {boost::mysql::time()};
+
+    BOOST_TEST(param_column(ints).kind() == field_kind::int64);
+    BOOST_TEST(param_column(uints).kind() == field_kind::uint64);
+    BOOST_TEST(param_column(floats).kind() == field_kind::float_);
+    BOOST_TEST(param_column(doubles).kind() == field_kind::double_);
+    BOOST_TEST(param_column(strs).kind() == field_kind::string);
+    BOOST_TEST(param_column(blobs).kind() == field_kind::blob);
+    BOOST_TEST(param_column(dates).kind() == field_kind::date);
+    BOOST_TEST(param_column(datetimes).kind() == field_kind::datetime);
+    BOOST_TEST(param_column(times).kind() == field_kind::time);
+}
+
+BOOST_AUTO_TEST_CASE(size)
+{
+    std::vector<double> values{1.0, 2.0, 3.0};
+    BOOST_TEST(param_column(values).size() == 3u);
+    BOOST_TEST(param_column(std::vector<double>()).size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(is_null)
+{
+    std::vector<std::int64_t> values(10, 42);
+
+    // Without bitmap, no value is NULL
+    param_column col1(values);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        BOOST_TEST(!col1.is_null(i));
+
+    // With bitmap, bits are read starting at the least significant one
+    const unsigned char null_bitmap[] = {0x82, 0x01};
+    param_column col2(values, null_bitmap);
+    const bool expected[] = {false, true, false, false, false, false, false, true, true, false};
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        BOOST_TEST_CONTEXT(i) { BOOST_TEST(col2.is_null(i) == expected[i]); }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
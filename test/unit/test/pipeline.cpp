@@ -5,14 +5,19 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/mysql/blob_view.hpp>
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/date.hpp>
+#include <boost/mysql/datetime.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/error_with_diagnostics.hpp>
+#include <boost/mysql/param_column.hpp>
 #include <boost/mysql/pipeline.hpp>
 #include <boost/mysql/results.hpp>
 #include <boost/mysql/string_view.hpp>
+#include <boost/mysql/time.hpp>
 
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
@@ -23,6 +28,8 @@
 #include <boost/optional/optional.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <type_traits>
@@ -330,6 +337,186 @@ BOOST_AUTO_TEST_CASE(add_execute_statement_range_too_many_params)
     check_pipeline(req, {}, {});  // Request unmodified
 }
 
+// Statement, passing parameters as columns.
+// This should be equivalent to calling add_execute_range once per row
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns)
+{
+    // Setup
+    const std::int64_t ints[] = {42, -1, 0};
+    const string_view strs[] = {"abc", "", "def"};
+    const double doubles[] = {4.2, 0.0, -1.5};
+    const unsigned char double_nulls[] = {0x02};  // the second one is NULL
+    const std::array<param_column, 3> columns{
+        {param_column(ints), param_column(strs), param_column(doubles, double_nulls)}
+    };
+    auto stmt = statement_builder().id(2).num_params(3).build();
+    pipeline_request req;
+
+    // Run
+    req.add_execute_columns(stmt, columns);
+
+    // Check
+    pipeline_request expected;
+    expected.add_execute(stmt, 42, "abc", 4.2)
+        .add_execute(stmt, -1, "", nullptr)
+        .add_execute(stmt, 0, "def", -1.5);
+    check_pipeline(
+        req,
+        detail::access::get_impl(expected).buffer_,
+        detail::access::get_impl(expected).stages_
+    );
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns_all_types)
+{
+    // Setup
+    const std::uint8_t blob_buff[] = {0x00, 0xff};
+    const std::int64_t ints[] = {-42};
+    const std::uint64_t uints[] = {0xffffffffffffffff};
+    const float floats[] = {4.2f};
+    const double doubles[] = {4.2};
+    const string_view strs[] = {"abc"};
+    const blob_view blobs[] = {blob_buff};
+    const date dates[] = {date(2020u, 1u, 2u)};
+    const datetime datetimes[] = {datetime(2020u, 1u, 2u, 10u, 11u, 12u, 999u)};
+    const boost::mysql::time times[] = {maket(20, 1, 2, 3)};
+    const std::array<param_column, 9> columns{
+        {param_column(ints),
+         param_column(uints),
+         param_column(floats),
+         param_column(doubles),
+         param_column(strs),
+         param_column(blobs),
+         param_column(dates),
+         param_column(datetimes),
+         param_column(times)}
+    };
+    auto stmt = statement_builder().id(2).num_params(9).build();
+    pipeline_request req;
+
+    // Run
+    req.add_execute_columns(stmt, columns);
+
+    // Check
+    pipeline_request expected;
+    expected.add_execute_range(
+        stmt,
+        make_fv_arr(
+            ints[0],
+            uints[0],
+            floats[0],
+            doubles[0],
+            strs[0],
+            blobs[0],
+            dates[0],
+            datetimes[0],
+            times[0]
+        )
+    );
+    check_pipeline(
+        req,
+        detail::access::get_impl(expected).buffer_,
+        detail::access::get_impl(expected).stages_
+    );
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns_nulls)
+{
+    // More than 8 params and rows, to check bitmaps spanning several bytes
+    std::vector<std::int64_t> values(10, 5);
+    const unsigned char null_bitmap[] = {0x81, 0x02};  // rows 0, 7 and 9 are NULL
+    std::vector<param_column> columns(9, param_column(values));
+    columns.push_back(param_column(values, null_bitmap));
+    auto stmt = statement_builder().id(2).num_params(10).build();
+    pipeline_request req;
+
+    // Run
+    req.add_execute_columns(stmt, columns);
+
+    // Check
+    pipeline_request expected;
+    for (std::size_t row = 0; row < 10u; ++row)
+    {
+        auto params = make_fv_vector(5, 5, 5, 5, 5, 5, 5, 5, 5, 5);
+        if (row == 0u || row == 7u || row == 9u)
+            params.back() = field_view();
+        expected.add_execute_range(stmt, params);
+    }
+    check_pipeline(
+        req,
+        detail::access::get_impl(expected).buffer_,
+        detail::access::get_impl(expected).stages_
+    );
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns_empty)
+{
+    // Columns without rows don't add any stage
+    std::vector<std::int64_t> values;
+    const std::array<param_column, 2> columns{
+        {param_column(values), param_column(values)}
+    };
+    pipeline_request req;
+    req.add_execute_columns(statement_builder().num_params(2).build(), columns);
+    check_pipeline(req, {}, {});
+
+    // Same for statements without parameters
+    req.add_execute_columns(statement_builder().num_params(0).build(), {});
+    check_pipeline(req, {}, {});
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns_error_num_params)
+{
+    // Add a stage, to check that the request is unmodified
+    pipeline_request req;
+    req.add_execute("SELECT 1");
+
+    std::vector<std::int64_t> values{1, 2};
+    const std::array<param_column, 2> columns{
+        {param_column(values), param_column(values)}
+    };
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_columns(statement_builder().num_params(3).build(), columns),
+        std::invalid_argument,
+        stmt_exc_validator
+    );
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_columns(statement_builder().num_params(1).build(), columns),
+        std::invalid_argument,
+        stmt_exc_validator
+    );
+    check_pipeline_single(
+        req,
+        create_query_frame(0, "SELECT 1"),
+        {pipeline_stage_kind::execute, 1u, resultset_encoding::text}
+    );
+}
+
+BOOST_AUTO_TEST_CASE(add_execute_statement_columns_error_sizes)
+{
+    // Add a stage, to check that the request is unmodified
+    pipeline_request req;
+    req.add_execute("SELECT 1");
+
+    std::vector<std::int64_t> values1{1, 2}, values2{1, 2, 3};
+    const std::array<param_column, 2> columns{
+        {param_column(values1), param_column(values2)}
+    };
+    BOOST_CHECK_EXCEPTION(
+        req.add_execute_columns(statement_builder().num_params(2).build(), columns),
+        std::invalid_argument,
+        [](const std::invalid_argument& exc) {
+            BOOST_TEST(string_view(exc.what()) == "All param_column objects should have the same size");
+            return true;
+        }
+    );
+    check_pipeline_single(
+        req,
+        create_query_frame(0, "SELECT 1"),
+        {pipeline_stage_kind::execute, 1u, resultset_encoding::text}
+    );
+}
+
 // prepare statement
 BOOST_AUTO_TEST_CASE(add_prepare_statement)
 {
@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/any_connection.hpp>
+#include <boost/mysql/blob.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/pipeline_batcher.hpp>
+#include <boost/mysql/results.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "test_common/assert_buffer_equals.hpp"
+#include "test_common/buffer_concat.hpp"
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/io_context_fixture.hpp"
+#include "test_common/network_result.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_query_frame.hpp"
+#include "test_unit/fail_count.hpp"
+#include "test_unit/test_any_connection.hpp"
+#include "test_unit/test_stream.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+namespace asio = boost::asio;
+
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_pipeline_batcher)
+
+// Requests submitted while the batcher is idle are sent in a single pipeline
+BOOST_FIXTURE_TEST_CASE(requests_coalesced, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    get_stream(conn)
+        .add_bytes(create_ok_frame(1, ok_builder().affected_rows(10u).build()))
+        .add_bytes(create_ok_frame(1, ok_builder().affected_rows(20u).build()));
+    pipeline_batcher batcher(conn);
+    results r1, r2;
+    diagnostics diag1, diag2;
+
+    // Launch the batcher and submit the requests
+    auto run_result = batcher.async_run(as_netresult);
+    auto exec1_result = batcher.async_execute("SELECT 1", r1, diag1, as_netresult);
+    auto exec2_result = batcher.async_execute("SELECT 2", r2, diag2, as_netresult);
+
+    // Both requests succeed and get their own results
+    std::move(exec1_result).validate_no_error();
+    std::move(exec2_result).validate_no_error();
+    BOOST_TEST(r1.affected_rows() == 10u);
+    BOOST_TEST(r2.affected_rows() == 20u);
+
+    // Both were sent in a single write
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        get_stream(conn).bytes_written(),
+        concat(create_query_frame(0, "SELECT 1"), create_query_frame(0, "SELECT 2"))
+    );
+
+    // Cancelling makes run exit successfully
+    batcher.cancel();
+    std::move(run_result).validate_no_error();
+}
+
+// A request failing doesn't affect the others in the same batch
+BOOST_FIXTURE_TEST_CASE(request_error, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    get_stream(conn)
+        .add_bytes(err_builder()
+                       .seqnum(1)
+                       .code(common_server_errc::er_bad_field_error)
+                       .message("my_message")
+                       .build_frame())
+        .add_bytes(create_ok_frame(1, ok_builder().affected_rows(20u).build()));
+    pipeline_batcher batcher(conn);
+    results r1, r2;
+    diagnostics diag1, diag2;
+
+    // Run
+    auto run_result = batcher.async_run(as_netresult);
+    auto exec1_result = batcher.async_execute("SELECT bad", r1, diag1, as_netresult);
+    auto exec2_result = batcher.async_execute("SELECT 2", r2, diag2, as_netresult);
+
+    // Check
+    std::move(exec1_result)
+        .validate_error(common_server_errc::er_bad_field_error, create_server_diag("my_message"));
+    std::move(exec2_result).validate_no_error();
+    BOOST_TEST(r2.affected_rows() == 20u);
+
+    // The batcher is still running
+    batcher.cancel();
+    std::move(run_result).validate_no_error();
+}
+
+// max_batch_size splits requests in several pipelines. A fatal error
+// makes the batcher exit, failing the requests that weren't sent
+BOOST_FIXTURE_TEST_CASE(max_batch_size_fatal_error, io_context_fixture)
+{
+    // Setup. The first read will fail
+    auto conn = create_test_any_connection(ctx);
+    get_stream(conn).set_fail_count(fail_count(1, asio::error::network_reset));
+    pipeline_batcher_params params;
+    params.max_batch_size = 1u;
+    pipeline_batcher batcher(conn, params);
+    results r1, r2;
+    diagnostics diag1, diag2;
+
+    // Run
+    auto run_result = batcher.async_run(as_netresult);
+    auto exec1_result = batcher.async_execute("SELECT 1", r1, diag1, as_netresult);
+    auto exec2_result = batcher.async_execute("SELECT 2", r2, diag2, as_netresult);
+
+    // Both requests fail, and run exits with the error
+    std::move(exec1_result).validate_error(asio::error::network_reset);
+    std::move(exec2_result).validate_error(asio::error::network_reset);
+    std::move(run_result).validate_error(asio::error::network_reset);
+
+    // Only the first batch was sent
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), create_query_frame(0, "SELECT 1"));
+}
+
+// Cancelling a batcher that isn't running fails queued requests
+BOOST_FIXTURE_TEST_CASE(cancel_not_running, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    pipeline_batcher batcher(conn);
+    results r;
+    diagnostics diag;
+
+    // Submit and cancel
+    auto exec_result = batcher.async_execute("SELECT 1", r, diag, as_netresult);
+    batcher.cancel();
+
+    // Check
+    std::move(exec_result).validate_error(asio::error::operation_aborted);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), blob{});
+}
+
+// Cancelling an idle batcher makes run exit
+BOOST_FIXTURE_TEST_CASE(cancel_idle, io_context_fixture)
+{
+    // Setup
+    auto conn = create_test_any_connection(ctx);
+    pipeline_batcher batcher(conn);
+
+    // Run and cancel
+    auto run_result = batcher.async_run(as_netresult);
+    batcher.cancel();
+
+    // Check
+    std::move(run_result).validate_no_error();
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(get_stream(conn).bytes_written(), blob{});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
@@ -0,0 +1,631 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/datetime.hpp>
+#include <boost/mysql/error_code.hpp>
+#include <boost/mysql/field_view.hpp>
+#include <boost/mysql/gtid_set.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/binlog_stream_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/binlog.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "serialization_test.hpp"
+#include "test_common/create_basic.hpp"
+#include "test_common/printing.hpp"
+
+using namespace boost::mysql::detail;
+using namespace boost::mysql::test;
+using boost::span;
+using boost::mysql::binlog_event;
+using boost::mysql::binlog_event_type;
+using boost::mysql::client_errc;
+using boost::mysql::datetime;
+using boost::mysql::error_code;
+using boost::mysql::field_view;
+using boost::mysql::gtid_set;
+using boost::mysql::gtid_source_id;
+using boost::mysql::string_view;
+
+BOOST_AUTO_TEST_SUITE(test_binlog)
+
+namespace {
+
+const gtid_source_id source_id{
+    {0x3e, 0x11, 0xfa, 0x47, 0x71, 0xca, 0x11, 0xe1, 0x9e, 0x33, 0xc8, 0x0a, 0xa9, 0x42, 0x95, 0x62}
+};
+
+void add_int(std::vector<std::uint8_t>& to, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        to.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+void add_bytes(std::vector<std::uint8_t>& to, span<const std::uint8_t> bytes)
+{
+    to.insert(to.end(), bytes.begin(), bytes.end());
+}
+
+void add_string(std::vector<std::uint8_t>& to, string_view s) { to.insert(to.end(), s.begin(), s.end()); }
+
+// Composes a complete event, with header and optional checksum
+std::vector<std::uint8_t> create_event(
+    binlog_event_type type,
+    const std::vector<std::uint8_t>& body,
+    std::uint32_t log_pos,
+    bool checksum = false,
+    std::uint16_t flags = 0
+)
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, 1600000000u, 4);  // timestamp
+    res.push_back(static_cast<std::uint8_t>(type));
+    add_int(res, 1u, 4);  // server ID
+    add_int(res, binlog_event_header_size + body.size() + (checksum ? binlog_checksum_size : 0u), 4);
+    add_int(res, log_pos, 4);
+    add_int(res, flags, 2);
+    add_bytes(res, body);
+    if (checksum)
+        add_int(res, binlog_crc32(res.data(), res.size()), 4);
+    return res;
+}
+
+std::vector<std::uint8_t> create_fde_body(bool checksum)
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, 4u, 2);                                      // binlog version
+    res.resize(res.size() + 50u);                             // server version
+    add_int(res, 0u, 4);                                      // create timestamp
+    res.push_back(19u);                                       // header length
+    add_bytes(res, std::vector<std::uint8_t>{56, 13, 0, 8});  // post-header lengths (truncated)
+    res.push_back(checksum ? 1u : 0u);                        // checksum algorithm
+    return res;
+}
+
+std::vector<std::uint8_t> create_rotate_body(std::uint64_t pos, string_view file)
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, pos, 8);
+    add_string(res, file);
+    return res;
+}
+
+std::vector<std::uint8_t> create_gtid_body(const gtid_source_id& sid, std::uint64_t gno)
+{
+    std::vector<std::uint8_t> res;
+    res.push_back(0x01);  // flags
+    add_bytes(res, sid);
+    add_int(res, gno, 8);
+    res.push_back(0x02);  // logical timestamp type code
+    add_int(res, 0u, 8);  // last committed
+    add_int(res, 0u, 8);  // sequence number
+    return res;
+}
+
+std::vector<std::uint8_t> create_query_body(string_view db, string_view query)
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, 10u, 4);  // thread ID
+    add_int(res, 0u, 4);   // exec time
+    res.push_back(static_cast<std::uint8_t>(db.size()));
+    add_int(res, 0u, 2);  // error code
+    add_int(res, 0u, 2);  // status variables length
+    add_string(res, db);
+    res.push_back(0);
+    add_string(res, query);
+    return res;
+}
+
+// Table 42: test.t1 (TINYINT UNSIGNED, INT, VARCHAR(64), DECIMAL(14,4), DATETIME(3))
+std::vector<std::uint8_t> create_table_map_body()
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, 42u, 6);  // table ID
+    add_int(res, 1u, 2);   // flags
+    res.push_back(4);
+    add_string(res, "test");
+    res.push_back(0);
+    res.push_back(2);
+    add_string(res, "t1");
+    res.push_back(0);
+    res.push_back(5);                                                         // number of columns
+    add_bytes(res, std::vector<std::uint8_t>{0x01, 0x03, 0x0f, 0xf6, 0x12});  // column types
+    res.push_back(5);                                                         // metadata length
+    add_bytes(res, std::vector<std::uint8_t>{0x40, 0x00, 0x0e, 0x04, 0x03});  // metadata
+    res.push_back(0x1f);                                                      // nullability
+    add_bytes(res, std::vector<std::uint8_t>{0x01, 0x01, 0x80});              // signedness
+    return res;
+}
+
+std::vector<std::uint8_t> create_rows_header(std::size_t num_bitmaps)
+{
+    std::vector<std::uint8_t> res;
+    add_int(res, 42u, 6);  // table ID
+    add_int(res, 1u, 2);   // flags
+    add_int(res, 2u, 2);   // extra data length
+    res.push_back(5);      // number of columns
+    for (std::size_t i = 0; i < num_bitmaps; ++i)
+        res.push_back(0x1f);  // columns present
+    return res;
+}
+
+const std::vector<std::uint8_t> row1{
+    0x00,                                      // NULL bitmap
+    0xfa,                                      // TINYINT UNSIGNED
+    0xfe, 0xff, 0xff, 0xff,                    // INT
+    0x03, 0x61, 0x62, 0x63,                    // VARCHAR
+    0x81, 0x0d, 0xfb, 0x38, 0xd2, 0x04, 0xd2,  // DECIMAL
+    0x99, 0xa5, 0x42, 0xa5, 0x1e, 0x04, 0xce,  // DATETIME(3)
+};
+
+const std::vector<std::uint8_t> row2{
+    0x04,                                      // NULL bitmap
+    0x01,                                      // TINYINT UNSIGNED
+    0x0a, 0x00, 0x00, 0x00,                    // INT
+    0x7e, 0xf2, 0x04, 0xc7, 0x2d, 0xfb, 0x2d,  // DECIMAL
+    0x99, 0xa5, 0x42, 0xa5, 0x1e, 0x00, 0x00,  // DATETIME(3)
+};
+
+const std::vector<std::uint8_t> xid_body{1, 0, 0, 0, 0, 0, 0, 0};
+
+// Events point into the buffer they were deserialized from. Keep a copy of the last one,
+// so tests can pass temporaries and still inspect the output
+error_code process(binlog_stream_impl& st, const std::vector<std::uint8_t>& event, binlog_event& output)
+{
+    static std::vector<std::uint8_t> last_event;
+    last_event = event;
+    return deserialize_binlog_event(last_event, st, output);
+}
+
+void process_fde(binlog_stream_impl& st, bool checksum)
+{
+    binlog_event ev;
+    auto event = create_event(binlog_event_type::format_description, create_fde_body(checksum), 120u, true);
+    BOOST_TEST_REQUIRE(process(st, event, ev) == error_code());
+}
+
+void process_table_map(binlog_stream_impl& st)
+{
+    binlog_event ev;
+    auto event = create_event(binlog_event_type::table_map, create_table_map_body(), 200u);
+    BOOST_TEST_REQUIRE(process(st, event, ev) == error_code());
+}
+
+}  // namespace
+
+//
+// Commands
+//
+BOOST_AUTO_TEST_CASE(register_replica)
+{
+    register_replica_command cmd{10u};
+    const std::uint8_t serialized[] = {
+        0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    do_serialize_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_gtid_empty_set)
+{
+    gtid_set gtids;
+    binlog_dump_gtid_command cmd{binlog_through_position, 10u, "binlog.000001", 1234u, &gtids};
+    const std::uint8_t serialized[] = {
+        0x1e, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x6c,
+        0x6f, 0x67, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xd2, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    do_serialize_test(cmd, serialized);
+}
+
+BOOST_AUTO_TEST_CASE(binlog_dump_gtid_with_set)
+{
+    gtid_set gtids;
+    gtids.add(source_id, 1u, 5u);
+    gtids.add(source_id, 10u);
+    binlog_dump_gtid_command cmd{binlog_through_gtid | binlog_dump_non_block, 10u, "", 4u, &gtids};
+    const std::uint8_t serialized[] = {
+        0x1e, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+        0x11, 0xfa, 0x47, 0x71, 0xca, 0x11, 0xe1, 0x9e, 0x33, 0xc8, 0x0a, 0xa9, 0x42, 0x95, 0x62, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+    do_serialize_test(cmd, serialized);
+}
+
+//
+// Checksums
+//
+BOOST_AUTO_TEST_CASE(crc32)
+{
+    const std::uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    BOOST_TEST(binlog_crc32(data, sizeof(data)) == 0xcbf43926u);
+}
+
+BOOST_AUTO_TEST_CASE(format_description_checksum)
+{
+    for (bool checksum : {false, true})
+    {
+        BOOST_TEST_CONTEXT(checksum)
+        {
+            binlog_stream_impl st;
+            binlog_event ev;
+            auto body = create_fde_body(checksum);
+            auto event = create_event(binlog_event_type::format_description, body, 120u, true);
+
+            auto ec = process(st, event, ev);
+            BOOST_TEST(ec == error_code());
+            BOOST_TEST(ev.type() == binlog_event_type::format_description);
+            BOOST_TEST(ev.raw_type() == 15u);
+            BOOST_TEST(ev.timestamp() == 1600000000u);
+            BOOST_TEST(ev.server_id() == 1u);
+            BOOST_TEST(ev.log_position() == 120u);
+            BOOST_MYSQL_ASSERT_BUFFER_EQUALS(ev.data(), body);
+            BOOST_TEST(st.checksum_known);
+            BOOST_TEST(st.has_checksum == checksum);
+            BOOST_TEST(st.log_position == 120u);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(events_before_format_description)
+{
+    // The server may send an artificial rotate event before the first format description.
+    // Checksums are detected heuristically
+    for (bool checksum : {false, true})
+    {
+        BOOST_TEST_CONTEXT(checksum)
+        {
+            binlog_stream_impl st;
+            binlog_event ev;
+            auto event = create_event(
+                binlog_event_type::rotate,
+                create_rotate_body(4u, "binlog.000002"),
+                0u,
+                checksum,
+                binlog_artificial_event_flag
+            );
+
+            auto ec = process(st, event, ev);
+            BOOST_TEST(ec == error_code());
+            BOOST_TEST(ev.type() == binlog_event_type::rotate);
+            BOOST_TEST(ev.next_log_file() == "binlog.000002");
+            BOOST_TEST(ev.next_log_position() == 4u);
+            BOOST_TEST(!st.checksum_known);
+            BOOST_TEST(st.log_file == "binlog.000002");
+            BOOST_TEST(st.log_position == 4u);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(events_after_format_description)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_fde(st, true);
+
+    // Checksums are stripped
+    auto ec = process(st, create_event(binlog_event_type::xid, xid_body, 151u, true), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::xid);
+    BOOST_TEST(ev.data().size() == 8u);
+    BOOST_TEST(st.log_position == 151u);
+}
+
+//
+// Position and GTID tracking
+//
+BOOST_AUTO_TEST_CASE(gtid_tracking)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_fde(st, false);
+
+    // GTID
+    auto ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 21u), 199u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::gtid);
+    BOOST_TEST((ev.gtid_source() == source_id));
+    BOOST_TEST(ev.gtid_transaction_id() == 21u);
+    BOOST_TEST(st.executed_gtids.empty());
+
+    // BEGIN doesn't end the transaction
+    ec = process(st, create_event(binlog_event_type::query, create_query_body("test", "BEGIN"), 270u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::query);
+    BOOST_TEST(ev.database() == "test");
+    BOOST_TEST(ev.query() == "BEGIN");
+    BOOST_TEST(st.executed_gtids.empty());
+
+    // XID does
+    ec = process(st, create_event(binlog_event_type::xid, xid_body, 301u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(st.executed_gtids.contains(source_id, 21u));
+    BOOST_TEST(st.log_position == 301u);
+
+    // DDL statements are transactions on their own
+    ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 22u), 380u), ev);
+    BOOST_TEST(ec == error_code());
+    auto body = create_query_body("test", "CREATE TABLE t2 (id INT)");
+    ec = process(st, create_event(binlog_event_type::query, body, 500u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(st.executed_gtids.to_string() == "3e11fa47-71ca-11e1-9e33-c80aa9429562:21-22");
+    BOOST_TEST(st.log_position == 500u);
+}
+
+// Statement-based replication: transactions contain several DML QUERY events
+BOOST_AUTO_TEST_CASE(gtid_tracking_statement_format)
+{
+    struct
+    {
+        const char* name;
+        const char* end_query;  // nullptr means XID
+    } test_cases[] = {
+        {"commit",   "COMMIT"  },
+        {"rollback", "ROLLBACK"},
+        {"xid",      nullptr   },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            binlog_stream_impl st;
+            binlog_event ev;
+            process_fde(st, false);
+
+            auto process_query = [&](string_view q, std::uint32_t pos) {
+                auto ec = process(st, create_event(binlog_event_type::query, create_query_body("test", q), pos), ev);
+                BOOST_TEST(ec == error_code());
+                BOOST_TEST(ev.query() == q);
+            };
+
+            // GTID, BEGIN
+            auto ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 21u), 199u), ev);
+            BOOST_TEST(ec == error_code());
+            process_query("BEGIN", 270u);
+
+            // DML statements, savepoints and table maps don't end the transaction
+            process_query("INSERT INTO t1 VALUES (1)", 350u);
+            BOOST_TEST(st.executed_gtids.empty());
+            ec = process(st, create_event(binlog_event_type::table_map, create_table_map_body(), 400u), ev);
+            BOOST_TEST(ec == error_code());
+            process_query("SAVEPOINT sp1", 450u);
+            process_query("UPDATE t1 SET id = 2", 500u);
+            process_query("ROLLBACK TO sp1", 550u);
+            process_query("DELETE FROM t1", 600u);
+            BOOST_TEST(st.executed_gtids.empty());
+            BOOST_TEST(st.num_table_maps == 1u);
+            BOOST_TEST(st.in_transaction);
+
+            // The end marker does
+            if (tc.end_query)
+            {
+                process_query(tc.end_query, 650u);
+            }
+            else
+            {
+                ec = process(st, create_event(binlog_event_type::xid, xid_body, 650u), ev);
+                BOOST_TEST(ec == error_code());
+            }
+            BOOST_TEST(st.executed_gtids.to_string() == "3e11fa47-71ca-11e1-9e33-c80aa9429562:21");
+            BOOST_TEST(st.num_table_maps == 0u);
+            BOOST_TEST(!st.in_transaction);
+
+            // A statement without BEGIN is a transaction on its own
+            ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 22u), 700u), ev);
+            BOOST_TEST(ec == error_code());
+            process_query("CREATE TABLE t2 (id INT)", 800u);
+            BOOST_TEST(st.executed_gtids.to_string() == "3e11fa47-71ca-11e1-9e33-c80aa9429562:21-22");
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gtid_tracking_xa)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_fde(st, false);
+
+    auto process_query = [&](string_view q, std::uint32_t pos) {
+        auto ec = process(st, create_event(binlog_event_type::query, create_query_body("test", q), pos), ev);
+        BOOST_TEST(ec == error_code());
+    };
+
+    // XA START, DML and XA END belong to the same transaction, ended by XA_PREPARE
+    auto ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 21u), 199u), ev);
+    BOOST_TEST(ec == error_code());
+    process_query("XA START X'78',X'',1", 270u);
+    process_query("INSERT INTO t1 VALUES (1)", 350u);
+    process_query("XA END X'78',X'',1", 400u);
+    BOOST_TEST(st.executed_gtids.empty());
+    ec = process(st, create_event(static_cast<binlog_event_type>(38), {0, 1, 2}, 450u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(st.executed_gtids.to_string() == "3e11fa47-71ca-11e1-9e33-c80aa9429562:21");
+
+    // XA COMMIT is a transaction on its own
+    ec = process(st, create_event(binlog_event_type::gtid, create_gtid_body(source_id, 22u), 500u), ev);
+    BOOST_TEST(ec == error_code());
+    process_query("XA COMMIT X'78',X'',1", 600u);
+    BOOST_TEST(st.executed_gtids.to_string() == "3e11fa47-71ca-11e1-9e33-c80aa9429562:21-22");
+}
+
+BOOST_AUTO_TEST_CASE(anonymous_gtid)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    auto body = create_gtid_body(gtid_source_id{}, 0u);
+    auto ec = process(st, create_event(binlog_event_type::anonymous_gtid, body, 199u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::anonymous_gtid);
+    ec = process(st, create_event(binlog_event_type::xid, xid_body, 301u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(st.executed_gtids.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unknown_event)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    auto ec = process(st, create_event(static_cast<binlog_event_type>(29), {1, 2, 3}, 199u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::unknown);
+    BOOST_TEST(ev.raw_type() == 29u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(ev.data(), (std::vector<std::uint8_t>{1, 2, 3}));
+}
+
+//
+// Row events
+//
+BOOST_AUTO_TEST_CASE(write_rows)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+
+    // Table map
+    auto ec = process(st, create_event(binlog_event_type::table_map, create_table_map_body(), 200u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::table_map);
+    BOOST_TEST(ev.database() == "test");
+    BOOST_TEST(ev.table() == "t1");
+
+    // Rows
+    auto body = create_rows_header(1u);
+    add_bytes(body, row1);
+    add_bytes(body, row2);
+    ec = process(st, create_event(binlog_event_type::write_rows, body, 300u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::write_rows);
+    BOOST_TEST(ev.database() == "test");
+    BOOST_TEST(ev.table() == "t1");
+    BOOST_TEST(ev.rows_before().empty());
+    BOOST_TEST(
+        ev.rows_after() == makerows(
+                               5,
+                               std::uint64_t(250),
+                               -2,
+                               "abc",
+                               "1234567890.1234",
+                               datetime(2020, 1, 1, 10, 20, 30, 123000),
+                               std::uint64_t(1),
+                               10,
+                               nullptr,
+                               "-1234567890.1234",
+                               datetime(2020, 1, 1, 10, 20, 30)
+                           )
+    );
+}
+
+BOOST_AUTO_TEST_CASE(update_rows)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_table_map(st);
+
+    auto body = create_rows_header(2u);
+    add_bytes(body, row1);
+    add_bytes(body, row2);
+    auto ec = process(st, create_event(binlog_event_type::update_rows, body, 300u), ev);
+    BOOST_TEST(ec == error_code());
+    BOOST_TEST(ev.type() == binlog_event_type::update_rows);
+    BOOST_TEST(ev.rows_before().size() == 1u);
+    BOOST_TEST(ev.rows_after().size() == 1u);
+    BOOST_TEST(ev.rows_before().at(0).at(2) == field_view("abc"));
+    BOOST_TEST(ev.rows_after().at(0).at(2).is_null());
+    BOOST_TEST(ev.rows_after().at(0).at(3) == field_view("-1234567890.1234"));
+}
+
+BOOST_AUTO_TEST_CASE(rows_error_unknown_table)
+{
+    // Table maps are discarded when a transaction ends
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_table_map(st);
+    BOOST_TEST(process(st, create_event(binlog_event_type::xid, xid_body, 250u), ev) == error_code());
+
+    auto body = create_rows_header(1u);
+    add_bytes(body, row1);
+    auto ec = process(st, create_event(binlog_event_type::write_rows, body, 300u), ev);
+    BOOST_TEST(ec == client_errc::protocol_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(rows_error_truncated)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_table_map(st);
+
+    auto body = create_rows_header(1u);
+    add_bytes(body, span<const std::uint8_t>(row1.data(), row1.size() - 1u));
+    auto ec = process(st, create_event(binlog_event_type::write_rows, body, 300u), ev);
+    BOOST_TEST(ec == client_errc::incomplete_message);
+}
+
+BOOST_AUTO_TEST_CASE(error_size_mismatch)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    auto event = create_event(binlog_event_type::xid, xid_body, 250u);
+    event.push_back(0);
+    BOOST_TEST(process(st, event, ev) == client_errc::protocol_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(error_gtid_max_transaction_id)
+{
+    binlog_stream_impl st;
+    binlog_event ev;
+    process_fde(st, false);
+    auto event = create_event(binlog_event_type::gtid, create_gtid_body(source_id, UINT64_MAX), 199u);
+    BOOST_TEST(process(st, event, ev) == client_errc::protocol_value_error);
+    BOOST_TEST(!st.has_pending_gtid);
+}
+
+// Events shorter than the header are rejected, with and without checksums
+BOOST_AUTO_TEST_CASE(error_truncated_header)
+{
+    for (bool checksum : {false, true})
+    {
+        BOOST_TEST_CONTEXT(checksum)
+        {
+            binlog_stream_impl st;
+            binlog_event ev;
+            process_fde(st, checksum);
+            auto event = create_event(binlog_event_type::xid, xid_body, 250u);
+            event.resize(binlog_event_header_size - 1u);
+            BOOST_TEST(process(st, event, ev) == client_errc::incomplete_message);
+        }
+    }
+}
+
+// With checksums enabled, events without space for the checksum are rejected
+BOOST_AUTO_TEST_CASE(error_truncated_checksum)
+{
+    for (std::size_t body_size : {0u, 3u})
+    {
+        BOOST_TEST_CONTEXT(body_size)
+        {
+            binlog_stream_impl st;
+            binlog_event ev;
+            process_fde(st, true);
+            auto event = create_event(binlog_event_type::xid, std::vector<std::uint8_t>(body_size), 250u);
+            BOOST_TEST(process(st, event, ev) == client_errc::incomplete_message);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -23,7 +23,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "operators.hpp"
 #include "serialization_test.hpp"
@@ -131,6 +133,41 @@ BOOST_AUTO_TEST_CASE(ok_view_success)
     }
 }
 
+BOOST_AUTO_TEST_CASE(ok_view_session_state)
+{
+    // SET NAMES utf8mb4, with CLIENT_SESSION_TRACK and character_set_client being tracked
+    const std::uint8_t serialized[] = {
+        0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1d, 0x14, 0x63, 0x68, 0x61, 0x72, 0x61,
+        0x63, 0x74, 0x65, 0x72, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x07,
+        0x75, 0x74, 0x66, 0x38, 0x6d, 0x62, 0x34,
+    };
+
+    ok_view actual{};
+    error_code err = deserialize_ok_packet(serialized, actual);
+
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(actual.affected_rows == 0u);
+    BOOST_TEST(actual.last_insert_id == 0u);
+    BOOST_TEST(actual.status_flags == 0x4002u);
+    BOOST_TEST(actual.warnings == 0u);
+    BOOST_TEST(actual.info == "");
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(actual.session_state, span<const std::uint8_t>(serialized).subspan(8));
+}
+
+BOOST_AUTO_TEST_CASE(ok_view_session_state_flag_only)
+{
+    // The server may set the session state flag without sending the session state,
+    // if CLIENT_SESSION_TRACK wasn't negotiated
+    const std::uint8_t serialized[] = {0x00, 0x00, 0x02, 0x40, 0x00, 0x00};
+
+    ok_view actual{};
+    error_code err = deserialize_ok_packet(serialized, actual);
+
+    BOOST_TEST(err == error_code());
+    BOOST_TEST(actual.info == "");
+    BOOST_TEST(actual.session_state.empty());
+}
+
 BOOST_AUTO_TEST_CASE(ok_view_error)
 {
     struct
@@ -159,6 +196,36 @@ BOOST_AUTO_TEST_CASE(ok_view_error)
     }
 }
 
+BOOST_AUTO_TEST_CASE(ok_view_session_state_error)
+{
+    struct
+    {
+        const char* name;
+        client_errc expected_err;
+        deserialization_buffer session_state;
+    } test_cases[] = {
+        {"incomplete",        client_errc::incomplete_message,   {0x05, 0x00, 0x01}      },
+        {"entry_incomplete",  client_errc::protocol_value_error, {0x02, 0x00, 0x05}      },
+        {"payload_too_short", client_errc::protocol_value_error, {0x03, 0x00, 0x01, 0x05}},
+        {"gtids_incomplete",  client_errc::protocol_value_error, {0x03, 0x03, 0x01, 0x00}},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            // OK packet with the session state flag set and an empty info string
+            std::vector<std::uint8_t> serialized{0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00};
+            auto session_state = tc.session_state.to_span();
+            serialized.insert(serialized.end(), session_state.begin(), session_state.end());
+
+            ok_view value{};
+            error_code err = deserialize_ok_packet(serialized, value);
+            BOOST_TEST(err == tc.expected_err);
+        }
+    }
+}
+
 //
 // error packets
 //
@@ -1237,6 +1304,81 @@ BOOST_AUTO_TEST_CASE(deserialize_row_error)
     }
 }
 
+//
+// split_binary_row
+//
+BOOST_AUTO_TEST_CASE(split_binary_row_success)
+{
+    // tinyint, varchar, NULL int, float, date, bigint, blob
+    deserialization_buffer serialized{
+        0x00, 0x10, 0x00, 0xfd, 0x03, 0x61, 0x62, 0x63, 0xc3, 0xf5, 0x48, 0x40, 0x04, 0xe2, 0x07, 0x0a,
+        0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x02, 0x00, 0xff,
+    };
+    auto meta = create_metas({
+        column_type::tinyint,
+        column_type::varchar,
+        column_type::int_,
+        column_type::float_,
+        column_type::date,
+        column_type::bigint,
+        column_type::blob,
+    });
+    std::vector<binary_cell> cells(meta.size());
+
+    auto err = split_binary_row(serialized, meta, cells.data());
+
+    // Length-encoded values don't include their length, dates do
+    BOOST_TEST_REQUIRE(err == error_code());
+    BOOST_TEST(!cells[0].is_null);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(cells[0].data, (std::vector<std::uint8_t>{0xfd}));
+    BOOST_TEST(!cells[1].is_null);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(cells[1].data, (std::vector<std::uint8_t>{0x61, 0x62, 0x63}));
+    BOOST_TEST(cells[2].is_null);
+    BOOST_TEST(cells[2].data.size() == 0u);
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(cells[3].data, (std::vector<std::uint8_t>{0xc3, 0xf5, 0x48, 0x40}));
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(cells[4].data, (std::vector<std::uint8_t>{0x04, 0xe2, 0x07, 0x0a, 0x05}));
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        cells[5].data,
+        (std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08})
+    );
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(cells[6].data, (std::vector<std::uint8_t>{0x00, 0xff}));
+}
+
+BOOST_AUTO_TEST_CASE(split_binary_row_error)
+{
+    struct
+    {
+        const char* name;
+        deserialization_buffer serialized;
+        error_code expected;
+        std::vector<metadata> meta;
+    } test_cases[] = {
+        // clang-format off
+        {"empty",                  {},                       client_errc::incomplete_message, create_metas({ column_type::tinyint })},
+        {"no_space_null_bitmap",   {0x00, 0xfc},             client_errc::incomplete_message, std::vector<metadata>(7, create_meta(column_type::tinyint))},
+        {"no_space_fixed",         {0x00, 0x00, 0x01, 0x02}, client_errc::incomplete_message, create_metas({ column_type::int_ })},
+        {"no_space_date_length",   {0x00, 0x00},             client_errc::incomplete_message, create_metas({ column_type::date })},
+        {"no_space_date",          {0x00, 0x00, 0x04, 0xe2}, client_errc::incomplete_message, create_metas({ column_type::date })},
+        {"no_space_string",        {0x00, 0x00, 0x03, 0x61}, client_errc::incomplete_message, create_metas({ column_type::varchar })},
+        {"no_space_value_last",    {0x00, 0x00, 0x01},       client_errc::incomplete_message, create_metas({ column_type::tinyint, column_type::tinyint })},
+        {"extra_bytes",            {0x00, 0x00, 0x01, 0x02}, client_errc::extra_bytes,        create_metas({ column_type::tinyint })},
+        {"row_for_empty_meta",     {0xfb, 0x01, 0x00, 0xfb}, client_errc::extra_bytes,        {}},
+        // clang-format on
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            std::unique_ptr<binary_cell[]> actual{new binary_cell[tc.meta.size()]};
+
+            auto err = split_binary_row(tc.serialized, tc.meta, actual.get());
+
+            BOOST_TEST(err == tc.expected);
+        }
+    }
+}
+
 //
 // server hello
 //
@@ -319,6 +319,39 @@ BOOST_AUTO_TEST_CASE(subsequent_header_exceeds_maxsize)
     BOOST_TEST(ctx.error() == client_errc::max_buffer_size_exceeded);
 }
 
+BOOST_AUTO_TEST_CASE(reserve)
+{
+    // Setup
+    std::vector<std::uint8_t> buff;
+    detail::serialization_context ctx(buff, 1024u, 8u);
+
+    // Space for the contents and the frame headers is reserved
+    ctx.reserve(20u);
+    BOOST_TEST(buff.capacity() >= 4u + 20u + 2u * 4u);
+    BOOST_TEST(buff.size() == 4u);  // initial header
+
+    // Doesn't reserve past the max buffer size
+    ctx.reserve(2000u);
+    BOOST_TEST(buff.capacity() >= 4u + 20u + 2u * 4u);
+    BOOST_TEST(buff.capacity() < 2000u);
+
+    // Doesn't modify the contents or the error state
+    BOOST_TEST(buff.size() == 4u);
+    BOOST_TEST(ctx.error() == error_code());
+}
+
+BOOST_AUTO_TEST_CASE(reserve_framing_disabled)
+{
+    // Setup
+    std::vector<std::uint8_t> buff{1, 2, 3};
+    detail::serialization_context ctx(buff, static_cast<std::size_t>(-1), detail::disable_framing);
+
+    // No space is reserved for headers
+    ctx.reserve(20u);
+    BOOST_TEST(buff.capacity() >= 23u);
+    BOOST_TEST(buff.size() == 3u);
+}
+
 BOOST_AUTO_TEST_CASE(maxsize_zero)
 {
     // Setup
@@ -17,6 +17,7 @@
 
 #include "test_common/assert_buffer_equals.hpp"
 #include "test_common/create_basic.hpp"
+#include "test_unit/custom_allocator.hpp"
 
 using namespace boost::mysql;
 using namespace boost::mysql::test;
@@ -449,4 +450,62 @@ BOOST_AUTO_TEST_CASE(row_rowview)
 }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(allocator)
+BOOST_AUTO_TEST_CASE(ctor_from_view)
+{
+    allocation_counter counter;
+    {
+        std::string s1("test");
+        auto fields = make_fv_arr(42, s1, makebv("\0\3\2"));
+        row r(makerowv(fields.data(), fields.size()), counting_allocator<char>(counter));
+        s1 = "abcd";
+
+        // Memory for both the fields and the strings was obtained from the allocator
+        BOOST_TEST(r == makerow(42, "test", makebv("\0\3\2")));
+        BOOST_TEST(counter.num_allocations == 2u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(assign_from_view)
+{
+    allocation_counter counter;
+    {
+        counting_allocator<char> alloc(counter);
+        row r(alloc);
+        BOOST_TEST(counter.num_allocations == 0u);
+        auto fields = make_fv_arr("abc", 10);
+        r = makerowv(fields.data(), fields.size());
+        BOOST_TEST(r == makerow("abc", 10));
+        BOOST_TEST(counter.num_allocations == 2u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(copy_uses_default_allocator)
+{
+    allocation_counter counter;
+    auto fields = make_fv_arr("abc", 10);
+    row r1(makerowv(fields.data(), fields.size()), counting_allocator<char>(counter));
+    row r2(r1);
+    BOOST_TEST(r2 == r1);
+    BOOST_TEST(counter.num_allocations == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(move_propagates_allocator)
+{
+    allocation_counter counter;
+    {
+        auto fields = make_fv_arr("abc", 10);
+        row r1(makerowv(fields.data(), fields.size()), counting_allocator<char>(counter));
+        row r2(std::move(r1));
+        row r3;
+        r3 = std::move(r2);
+        BOOST_TEST(r3 == makerow("abc", 10));
+        BOOST_TEST(counter.num_allocations == 2u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()  // test_row
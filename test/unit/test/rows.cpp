@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include "test_common/create_basic.hpp"
+#include "test_unit/custom_allocator.hpp"
 
 using namespace boost::mysql;
 using namespace boost::mysql::test;
@@ -442,4 +443,29 @@ BOOST_AUTO_TEST_CASE(cleared)
 }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(allocator)
+BOOST_AUTO_TEST_CASE(ctor_from_view)
+{
+    allocation_counter counter;
+    {
+        auto fields = make_fv_arr(42u, "abc", 50u, "defg");
+        rows r(makerowsv(fields.data(), fields.size(), 2), counting_allocator<char>(counter));
+        BOOST_TEST(r.size() == 2u);
+        BOOST_TEST(r[0] == makerow(42u, "abc"));
+        BOOST_TEST(r[1] == makerow(50u, "defg"));
+        BOOST_TEST(counter.num_allocations == 2u);
+    }
+    BOOST_TEST(counter.bytes_outstanding == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+    allocation_counter counter;
+    counting_allocator<char> alloc(counter);
+    rows r(alloc);
+    BOOST_TEST(r.empty());
+    BOOST_TEST(counter.num_allocations == 0u);
+}
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,344 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/binlog_event.hpp>
+#include <boost/mysql/binlog_stream.hpp>
+#include <boost/mysql/client_errc.hpp>
+#include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_code.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+#include <boost/mysql/detail/binlog_stream_impl.hpp>
+
+#include <boost/mysql/impl/internal/protocol/db_flavor.hpp>
+#include <boost/mysql/impl/internal/sansio/binlog.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
+#include "test_unit/algo_test.hpp"
+#include "test_unit/create_err.hpp"
+#include "test_unit/create_frame.hpp"
+#include "test_unit/create_ok.hpp"
+#include "test_unit/create_ok_frame.hpp"
+#include "test_unit/create_query_frame.hpp"
+
+using namespace boost::mysql::test;
+using namespace boost::mysql;
+using detail::binlog_checksum_query;
+
+BOOST_AUTO_TEST_SUITE(test_binlog)
+
+namespace {
+
+const std::vector<std::uint8_t> register_frame = create_frame(
+    0,
+    std::vector<std::uint8_t>{0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+);
+
+// GTID-based dump, with an empty GTID set
+const std::vector<std::uint8_t> dump_frame = create_frame(
+    0,
+    std::vector<std::uint8_t>{0x1e, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+);
+
+// An XID event with no checksum, prefixed by the 0x00 byte
+std::vector<std::uint8_t> create_xid_event_frame(std::uint8_t seqnum, std::uint32_t log_pos)
+{
+    const auto pos = static_cast<std::uint8_t>(log_pos);
+    return create_frame(
+        seqnum,
+        std::vector<std::uint8_t>{
+            0x00,                                            // OK marker
+            0x00, 0xf1, 0x5e, 0x5f,                          // timestamp
+            0x10,                                            // type
+            0x01, 0x00, 0x00, 0x00,                          // server ID
+            0x1b, 0x00, 0x00, 0x00,                          // event size
+            pos,  0x00, 0x00, 0x00,                          // log position
+            0x00, 0x00,                                      // flags
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // XID
+        }
+    );
+}
+
+}  // namespace
+
+//
+// binlog_dump_algo
+//
+struct dump_fixture : algo_fixture_base
+{
+    binlog_dump_params params;
+    binlog_stream stream;
+    detail::binlog_dump_algo algo{diag, {&params, &detail::access::get_impl(stream)}};
+
+    dump_fixture() { params.server_id = 10u; }
+};
+
+BOOST_AUTO_TEST_CASE(dump_success)
+{
+    // Setup
+    dump_fixture fix;
+
+    // Run the test
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check(fix);
+
+    // The stream is ready to read events
+    BOOST_TEST(fix.stream.started());
+    BOOST_TEST(!fix.stream.complete());
+    BOOST_TEST(fix.stream.executed_gtids().empty());
+    BOOST_TEST(detail::access::get_impl(fix.stream).seqnum == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(dump_position)
+{
+    // Setup
+    dump_fixture fix;
+    fix.params.log_file = "bin.01";
+    fix.params.log_position = 300u;
+    fix.params.non_blocking = true;
+
+    // Run the test
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(create_frame(
+            0,
+            std::vector<std::uint8_t>{0x1e, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+                                      0x62, 0x69, 0x6e, 0x2e, 0x30, 0x31, 0x2c, 0x01, 0x00, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                      0x00, 0x00, 0x00, 0x00}
+        ))
+        .check(fix);
+
+    // The initial position was stored
+    BOOST_TEST(fix.stream.started());
+    BOOST_TEST(fix.stream.log_file() == "bin.01");
+    BOOST_TEST(fix.stream.log_position() == 300u);
+}
+
+BOOST_AUTO_TEST_CASE(dump_resets_stream)
+{
+    // Setup
+    dump_fixture fix;
+    auto& impl = detail::access::get_impl(fix.stream);
+    impl.started = true;
+    impl.complete = true;
+    impl.checksum_known = true;
+    impl.has_checksum = true;
+    impl.seqnum = 42u;
+
+    // Run the test
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check(fix);
+
+    // State from the previous dump was discarded
+    BOOST_TEST(fix.stream.started());
+    BOOST_TEST(!fix.stream.complete());
+    BOOST_TEST(!impl.checksum_known);
+    BOOST_TEST(impl.seqnum == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(dump_error_network)
+{
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(dump_frame)
+        .check_network_errors<dump_fixture>();
+}
+
+BOOST_AUTO_TEST_CASE(dump_error_checksum_query)
+{
+    // Setup
+    dump_fixture fix;
+
+    // Run the test
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_specific_access_denied_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_specific_access_denied_error, create_server_diag("my_message"));
+    BOOST_TEST(!fix.stream.started());
+}
+
+BOOST_AUTO_TEST_CASE(dump_error_register)
+{
+    // Setup
+    dump_fixture fix;
+
+    // Run the test
+    algo_test()
+        .expect_write(create_query_frame(0, binlog_checksum_query))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .expect_write(register_frame)
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_specific_access_denied_error)
+                         .message("my_message")
+                         .build_frame())
+        .check(fix, common_server_errc::er_specific_access_denied_error, create_server_diag("my_message"));
+    BOOST_TEST(!fix.stream.started());
+}
+
+BOOST_AUTO_TEST_CASE(dump_error_mariadb)
+{
+    // Setup
+    dump_fixture fix;
+    fix.st.flavor = detail::db_flavor::mariadb;
+
+    // Run the test
+    algo_test().check(fix, client_errc::server_unsupported);
+    BOOST_TEST(!fix.stream.started());
+}
+
+//
+// read_binlog_event_algo
+//
+struct read_event_fixture : algo_fixture_base
+{
+    binlog_stream stream;
+    detail::read_binlog_event_algo algo{diag, {&detail::access::get_impl(stream)}};
+
+    read_event_fixture()
+    {
+        auto& impl = detail::access::get_impl(stream);
+        impl.started = true;
+        impl.seqnum = 1u;
+    }
+
+    detail::binlog_stream_impl& impl() { return detail::access::get_impl(stream); }
+};
+
+BOOST_AUTO_TEST_CASE(read_event_success)
+{
+    // Setup
+    read_event_fixture fix;
+
+    // Run the test
+    algo_test().expect_read(create_xid_event_frame(1, 200)).check(fix);
+
+    // Check
+    auto ev = fix.algo.result(fix.st);
+    BOOST_TEST(ev.type() == binlog_event_type::xid);
+    BOOST_TEST(ev.log_position() == 200u);
+    BOOST_TEST(fix.stream.log_position() == 200u);
+    BOOST_TEST(fix.impl().seqnum == 2u);
+    BOOST_TEST(!fix.stream.complete());
+}
+
+BOOST_AUTO_TEST_CASE(read_event_seqnum)
+{
+    // Sequence numbers are kept between reads
+    read_event_fixture fix;
+    fix.impl().seqnum = 20u;
+
+    algo_test().expect_read(create_xid_event_frame(20, 200)).check(fix);
+    BOOST_TEST(fix.impl().seqnum == 21u);
+}
+
+BOOST_AUTO_TEST_CASE(read_event_eof)
+{
+    // Setup
+    read_event_fixture fix;
+
+    // Run the test
+    algo_test().expect_read(create_eof_frame(1, ok_builder().build())).check(fix);
+
+    // The stream is complete
+    BOOST_TEST(fix.algo.result(fix.st).type() == binlog_event_type::unknown);
+    BOOST_TEST(fix.stream.complete());
+}
+
+BOOST_AUTO_TEST_CASE(read_event_complete)
+{
+    // Setup
+    read_event_fixture fix;
+    fix.impl().complete = true;
+
+    // No I/O is performed, and an empty event is returned
+    algo_test().check(fix);
+    BOOST_TEST(fix.algo.result(fix.st).type() == binlog_event_type::unknown);
+}
+
+BOOST_AUTO_TEST_CASE(read_event_not_started)
+{
+    // Setup
+    read_event_fixture fix;
+    fix.impl().started = false;
+
+    // No I/O is performed
+    algo_test().check(fix, client_errc::binlog_stream_not_started);
+}
+
+BOOST_AUTO_TEST_CASE(read_event_error_network)
+{
+    algo_test().expect_read(create_xid_event_frame(1, 200)).check_network_errors<read_event_fixture>();
+}
+
+BOOST_AUTO_TEST_CASE(read_event_error_packet)
+{
+    // Setup
+    read_event_fixture fix;
+
+    // Run the test
+    algo_test()
+        .expect_read(err_builder()
+                         .seqnum(1)
+                         .code(common_server_errc::er_master_fatal_error_reading_binlog)
+                         .message("my_message")
+                         .build_frame())
+        .check(
+            fix,
+            common_server_errc::er_master_fatal_error_reading_binlog,
+            create_server_diag("my_message")
+        );
+}
+
+BOOST_AUTO_TEST_CASE(read_event_error_bad_header)
+{
+    read_event_fixture fix;
+    algo_test()
+        .expect_read(create_frame(1, std::vector<std::uint8_t>{0x05, 0x00, 0x00}))
+        .check(fix, client_errc::protocol_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(read_event_error_truncated)
+{
+    read_event_fixture fix;
+    algo_test()
+        .expect_read(create_frame(1, std::vector<std::uint8_t>{0x00, 0x01, 0x02}))
+        .check(fix, client_errc::incomplete_message);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
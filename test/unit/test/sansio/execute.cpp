@@ -11,6 +11,7 @@
 #include <boost/mysql/detail/any_execution_request.hpp>
 #include <boost/mysql/detail/execution_processor/execution_processor.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
+#include <boost/mysql/detail/resultset_visitor_ref.hpp>
 
 #include <boost/mysql/impl/internal/sansio/execute.hpp>
 
@@ -18,6 +19,7 @@
 
 #include "test_common/buffer_concat.hpp"
 #include "test_common/check_meta.hpp"
+#include "test_common/create_basic.hpp"
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_coldef_frame.hpp"
 #include "test_unit/create_frame.hpp"
@@ -26,6 +28,7 @@
 #include "test_unit/create_ok_frame.hpp"
 #include "test_unit/create_row_message.hpp"
 #include "test_unit/mock_execution_processor.hpp"
+#include "test_unit/mock_resultset_visitor.hpp"
 #include "test_unit/printing.hpp"
 
 using namespace boost::mysql::test;
@@ -33,6 +36,7 @@ using namespace boost::mysql;
 using boost::mysql::detail::any_execution_request;
 using boost::mysql::detail::execution_processor;
 using boost::mysql::detail::resultset_encoding;
+using boost::mysql::detail::resultset_visitor_ref;
 
 BOOST_AUTO_TEST_SUITE(test_execute)
 
@@ -258,4 +262,129 @@ BOOST_AUTO_TEST_CASE(execute_error_network_error)
         .check_network_errors<execute_fixture>();
 }
 
+struct execute_each_fixture : algo_fixture_base
+{
+    mock_resultset_visitor visitor;
+    detail::execute_each_algo algo;
+
+    execute_each_fixture(any_execution_request req = {"SELECT 1"})
+        : algo(diag, {req, resultset_visitor_ref(visitor)})
+    {
+    }
+};
+
+BOOST_AUTO_TEST_CASE(execute_each_success_eof)
+{
+    // Setup
+    execute_each_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_frame(0, serialized_select_1))
+        .expect_read(create_ok_frame(1, ok_builder().affected_rows(60u).info("abc").build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST_REQUIRE(fix.visitor.resultsets.size() == 1u);
+    const auto& rs = fix.visitor.resultsets[0];
+    BOOST_TEST(rs.meta.size() == 0u);
+    BOOST_TEST(rs.batches.size() == 0u);
+    BOOST_TEST(rs.ended);
+    BOOST_TEST(rs.affected_rows == 60u);
+    BOOST_TEST(rs.info == "abc");
+}
+
+BOOST_AUTO_TEST_CASE(execute_each_success_multiple_resultsets)
+{
+    // Setup
+    execute_each_fixture fix;
+
+    // Run the algo. The first resultset's rows are received in two batches.
+    // The last row batch and the OK packet are received together
+    algo_test()
+        .expect_write(create_frame(0, serialized_select_1))
+        .expect_read(create_frame(1, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::bigint).build_coldef()))
+        .expect_read(create_text_row_message(3, 42))
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(4, 43))
+                         .add(create_text_row_message(5, 44))
+                         .add(create_eof_frame(6, ok_builder().info("1st").more_results(true).build()))
+                         .build())
+        .expect_read(create_ok_frame(7, ok_builder().affected_rows(5u).more_results(true).build()))
+        .expect_read(create_frame(8, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(9, meta_builder().type(column_type::varchar).build_coldef()))
+        .expect_read(create_eof_frame(10, ok_builder().info("3rd").build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST_REQUIRE(fix.visitor.resultsets.size() == 3u);
+
+    const auto& r1 = fix.visitor.resultsets[0];
+    check_meta(r1.meta, {column_type::bigint});
+    BOOST_TEST_REQUIRE(r1.batches.size() == 2u);
+    BOOST_TEST((r1.batches[0] == makerows(1, 42)));
+    BOOST_TEST((r1.batches[1] == makerows(1, 43, 44)));
+    BOOST_TEST(r1.info == "1st");
+
+    const auto& r2 = fix.visitor.resultsets[1];
+    BOOST_TEST(r2.meta.size() == 0u);
+    BOOST_TEST(r2.batches.size() == 0u);
+    BOOST_TEST(r2.affected_rows == 5u);
+
+    const auto& r3 = fix.visitor.resultsets[2];
+    check_meta(r3.meta, {column_type::varchar});
+    BOOST_TEST(r3.batches.size() == 0u);
+    BOOST_TEST(r3.ended);
+    BOOST_TEST(r3.info == "3rd");
+}
+
+// The algo may be moved after construction, since it's stored in a variant
+BOOST_AUTO_TEST_CASE(execute_each_moved)
+{
+    struct fixture : algo_fixture_base
+    {
+        mock_resultset_visitor visitor;
+        detail::execute_each_algo tmp{diag, {string_view("SELECT 1"), resultset_visitor_ref(visitor)}};
+        detail::execute_each_algo algo{std::move(tmp)};
+    } fix;
+
+    algo_test()
+        .expect_write(create_frame(0, serialized_select_1))
+        .expect_read(create_frame(1, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::bigint).build_coldef()))
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(3, 42))
+                         .add(create_eof_frame(4, ok_builder().info("1st").build()))
+                         .build())
+        .check(fix);
+
+    BOOST_TEST_REQUIRE(fix.visitor.resultsets.size() == 1u);
+    BOOST_TEST_REQUIRE(fix.visitor.resultsets[0].batches.size() == 1u);
+    BOOST_TEST((fix.visitor.resultsets[0].batches[0] == makerows(1, 42)));
+}
+
+BOOST_AUTO_TEST_CASE(execute_each_error_num_params)
+{
+    // Setup
+    const auto params = make_fv_arr("test", nullptr, 42);  // too many params
+    execute_each_fixture fix(any_execution_request({std::uint32_t(1), std::uint16_t(2), params}));
+
+    // Run the algo. Nothing should be written to the server
+    algo_test().check(fix, client_errc::wrong_num_params);
+    BOOST_TEST(fix.visitor.resultsets.size() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(execute_each_error_network_error)
+{
+    algo_test()
+        .expect_write(create_frame(0, serialized_select_1))
+        .expect_read(create_frame(1, {0x01}))  // OK, 1 column
+        .expect_read(create_coldef_frame(2, meta_builder().type(column_type::tinyint).build_coldef()))
+        .expect_read(create_text_row_message(3, 42))
+        .expect_read(create_text_row_message(4, 43))
+        .expect_read(create_eof_frame(5, ok_builder().affected_rows(10u).info("1st").build()))
+        .check_network_errors<execute_each_fixture>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -657,4 +657,57 @@ BOOST_AUTO_TEST_CASE(bytes_in_all_areas)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(detach_reserved)
+
+BOOST_AUTO_TEST_CASE(bytes_in_all_areas)
+{
+    read_buffer buff(16);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a});
+    buff.move_to_pending(10);
+    buff.move_to_current_message(6);
+    buff.move_to_reserved(3);
+    const std::uint8_t* old_first = buff.first();
+    std::vector<std::uint8_t> other;
+
+    buff.detach_reserved(other);
+
+    // The old storage is handed to other, without copying it
+    BOOST_TEST(other.data() == old_first);
+    BOOST_TEST(other.size() == 16u);
+
+    // The current message and pending bytes are copied to the new storage
+    BOOST_TEST(buff.first() != old_first);
+    check_buffer(buff, {}, {0x04, 0x05, 0x06}, {0x07, 0x08, 0x09, 0x0a}, 9);
+}
+
+BOOST_AUTO_TEST_CASE(only_reserved)
+{
+    read_buffer buff(16);
+    copy_to_free_area(buff, {0x01, 0x02, 0x03, 0x04});
+    buff.move_to_pending(4);
+    buff.move_to_current_message(4);
+    buff.move_to_reserved(4);
+    std::vector<std::uint8_t> other(8, 0xff);
+
+    buff.detach_reserved(other);
+
+    // other's storage is reused, and resized to the buffer size
+    BOOST_MYSQL_ASSERT_BUFFER_EQUALS(
+        boost::span<const std::uint8_t>(other.data(), 4),
+        std::vector<std::uint8_t>({0x01, 0x02, 0x03, 0x04})
+    );
+    check_buffer(buff, {}, {}, {}, 16);
+}
+
+BOOST_AUTO_TEST_CASE(zero_size_buffer)
+{
+    read_buffer buff(0);
+    std::vector<std::uint8_t> other;
+    buff.detach_reserved(other);
+    check_empty_buffer(buff);
+    BOOST_TEST(other.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
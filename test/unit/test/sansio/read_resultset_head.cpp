@@ -8,6 +8,7 @@
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/column_type.hpp>
 #include <boost/mysql/common_server_errc.hpp>
+#include <boost/mysql/character_set.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/field_view.hpp>
 #include <boost/mysql/string_view.hpp>
@@ -19,6 +20,7 @@
 
 #include "test_common/buffer_concat.hpp"
 #include "test_common/check_meta.hpp"
+#include "test_common/printing.hpp"
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_coldef_frame.hpp"
 #include "test_unit/create_err.hpp"
@@ -28,6 +30,7 @@
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
 #include "test_unit/create_row_message.hpp"
+#include "test_unit/create_session_state.hpp"
 #include "test_unit/mock_execution_processor.hpp"
 
 using namespace boost::mysql;
@@ -99,6 +102,41 @@ BOOST_AUTO_TEST_CASE(success_ok_packet_no_backslash_escapes)
     BOOST_TEST(!fix.st.backslash_escapes);
 }
 
+// If the server tracks character_set_client, the current character set is updated
+BOOST_AUTO_TEST_CASE(success_ok_packet_session_state_charset)
+{
+    struct
+    {
+        string_view name;
+        string_view variable;
+        string_view value;
+        character_set expected;
+    } test_cases[] = {
+        {"utf8mb4",        "character_set_client", "utf8mb4", utf8mb4_charset},
+        {"ascii",          "character_set_client", "ascii",   ascii_charset  },
+        {"unknown",        "character_set_client", "latin1",  character_set{}},
+        {"other_variable", "time_zone",            "+01:00",  ascii_charset  },
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            // Setup
+            fixture fix;
+            fix.st.current_charset = ascii_charset;
+            auto state = session_state_builder().system_variable(tc.variable, tc.value).build();
+
+            // Run the algorithm
+            algo_test().expect_read(create_ok_frame(1, ok_builder().session_state(state).build())).check(fix);
+
+            // Verify
+            fix.proc.num_calls().on_head_ok_packet(1).validate();
+            BOOST_TEST(fix.st.current_charset == tc.expected);
+        }
+    }
+}
+
 // Check that we don't attempt to read the rows even if they're available
 BOOST_AUTO_TEST_CASE(success_rows_available)
 {
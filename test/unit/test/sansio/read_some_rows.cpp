@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/common_server_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
@@ -19,6 +20,7 @@
 
 #include "test_common/buffer_concat.hpp"
 #include "test_common/create_diagnostics.hpp"
+#include "test_common/printing.hpp"
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_err.hpp"
 #include "test_unit/create_execution_processor.hpp"
@@ -26,6 +28,7 @@
 #include "test_unit/create_ok.hpp"
 #include "test_unit/create_ok_frame.hpp"
 #include "test_unit/create_row_message.hpp"
+#include "test_unit/create_session_state.hpp"
 #include "test_unit/mock_execution_processor.hpp"
 
 using namespace boost::mysql::test;
@@ -103,6 +106,22 @@ BOOST_AUTO_TEST_CASE(eof_no_backslash_escapes)
     BOOST_TEST(!fix.st.backslash_escapes);
 }
 
+BOOST_AUTO_TEST_CASE(eof_session_state_charset)
+{
+    // Setup
+    fixture fix;
+    auto state = session_state_builder().system_variable("character_set_client", "utf8mb4").build();
+
+    // Run the test
+    algo_test()
+        .expect_read(create_eof_frame(42, ok_builder().session_state(state).more_results(true).build()))
+        .check(fix);
+
+    // The current character set was updated
+    BOOST_TEST(fix.result() == 0u);  // num read rows
+    BOOST_TEST(fix.st.current_charset == utf8mb4_charset);
+}
+
 BOOST_AUTO_TEST_CASE(batch_with_rows)
 {
     // Setup
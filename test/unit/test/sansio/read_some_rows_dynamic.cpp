@@ -7,8 +7,13 @@
 
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/diagnostics.hpp>
+#include <boost/mysql/error_with_diagnostics.hpp>
+#include <boost/mysql/lazy_row_batch.hpp>
+#include <boost/mysql/metadata_mode.hpp>
+#include <boost/mysql/row_batch.hpp>
 #include <boost/mysql/rows_view.hpp>
 
+#include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/execution_processor/execution_state_impl.hpp>
 
 #include <boost/mysql/impl/internal/sansio/connection_state_data.hpp>
@@ -16,6 +21,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <thread>
+#include <vector>
+
 #include "test_common/buffer_concat.hpp"
 #include "test_unit/algo_test.hpp"
 #include "test_unit/create_execution_processor.hpp"
@@ -28,6 +36,7 @@
 using namespace boost::mysql::test;
 using namespace boost::mysql;
 using boost::mysql::detail::execution_state_impl;
+using boost::mysql::detail::resultset_encoding;
 
 BOOST_AUTO_TEST_SUITE(test_read_some_rows_dynamic)
 
@@ -114,4 +123,323 @@ BOOST_AUTO_TEST_CASE(error)
     algo_test().expect_read(client_errc::incomplete_message).check(fix, client_errc::incomplete_message);
 }
 
+// Reading into a row_batch
+struct batch_fixture : algo_fixture_base
+{
+    execution_state_impl exec_st;
+    row_batch batch;
+    detail::read_some_rows_batch_algo algo{diag, {&exec_st, &detail::access::get_impl(batch)}};
+
+    batch_fixture()
+    {
+        // Prepare the state, such that it's ready to read rows
+        add_meta(exec_st, {meta_builder().type(column_type::varchar).build_coldef()});
+        exec_st.sequence_number() = 42;
+
+        // Put something in shared_fields, simulating a previous read
+        st.shared_fields.push_back(field_view("prev"));
+    }
+
+    const std::vector<std::uint8_t>& batch_buffer() const { return detail::access::get_impl(batch).buffer; }
+};
+
+BOOST_AUTO_TEST_CASE(batch_rows)
+{
+    // Setup
+    batch_fixture fix;
+    const std::uint8_t* connection_buffer = fix.st.reader.internal_buffer().first();
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_text_row_message(43, "von"))
+                         .build())
+        .check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.rows() == makerows(1, "abc", "von"));
+    BOOST_TEST(fix.batch.size() == 2u);
+    BOOST_TEST(fix.exec_st.is_reading_rows());
+
+    // Strings point into the connection's old buffer, which is now owned by the batch
+    BOOST_TEST(fix.batch_buffer().data() == connection_buffer);
+    BOOST_TEST(fix.st.reader.internal_buffer().first() != connection_buffer);
+    auto str = fix.batch.rows().at(0).at(0).as_string();
+    const auto* str_first = reinterpret_cast<const std::uint8_t*>(str.data());
+    BOOST_TEST(str_first > fix.batch_buffer().data());
+    BOOST_TEST(str_first < fix.batch_buffer().data() + fix.batch_buffer().size());
+}
+
+BOOST_AUTO_TEST_CASE(batch_rows_eof)
+{
+    // Setup
+    batch_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc"))
+                         .add(create_eof_frame(43, ok_builder().affected_rows(1).info("1st").build()))
+                         .build())
+        .check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.rows() == makerows(1, "abc"));
+    BOOST_TEST_REQUIRE(fix.exec_st.is_complete());
+    BOOST_TEST(fix.exec_st.get_affected_rows() == 1u);
+    BOOST_TEST(fix.exec_st.get_info() == "1st");
+}
+
+// If no rows are read, the buffer is not handed to the batch
+BOOST_AUTO_TEST_CASE(batch_eof)
+{
+    // Setup
+    batch_fixture fix;
+    const std::uint8_t* connection_buffer = fix.st.reader.internal_buffer().first();
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_eof_frame(42, ok_builder().affected_rows(1).info("1st").build()))
+        .check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.empty());
+    BOOST_TEST(fix.batch.rows() == rows_view());
+    BOOST_TEST(fix.batch_buffer().empty());
+    BOOST_TEST(fix.st.reader.internal_buffer().first() == connection_buffer);
+    BOOST_TEST_REQUIRE(fix.exec_st.is_complete());
+}
+
+// Reading again into the same batch gives its buffer back to the connection
+BOOST_AUTO_TEST_CASE(batch_recycled)
+{
+    // Setup
+    batch_fixture fix;
+    const std::uint8_t* connection_buffer = fix.st.reader.internal_buffer().first();
+
+    // First read
+    algo_test().expect_read(create_text_row_message(42, "abc")).check(fix);
+    BOOST_TEST(fix.batch.rows() == makerows(1, "abc"));
+    const std::uint8_t* second_buffer = fix.st.reader.internal_buffer().first();
+
+    // Second read
+    fix.algo = detail::read_some_rows_batch_algo(
+        fix.diag,
+        {&fix.exec_st, &detail::access::get_impl(fix.batch)}
+    );
+    algo_test().expect_read(create_text_row_message(43, "def")).check(fix);
+    BOOST_TEST(fix.batch.rows() == makerows(1, "def"));
+
+    // The buffers were swapped again
+    BOOST_TEST(fix.st.reader.internal_buffer().first() == connection_buffer);
+    BOOST_TEST(fix.batch_buffer().data() == second_buffer);
+}
+
+// Rows are discarded if there is an error
+BOOST_AUTO_TEST_CASE(batch_error)
+{
+    // Setup
+    batch_fixture fix;
+    detail::access::get_impl(fix.batch).fields.push_back(field_view("prev"));
+    detail::access::get_impl(fix.batch).num_columns = 1u;
+
+    // Run the algo
+    algo_test().expect_read(client_errc::incomplete_message).check(fix, client_errc::incomplete_message);
+
+    // Check
+    BOOST_TEST(fix.batch.empty());
+}
+
+// Reading into a lazy_row_batch
+struct lazy_fixture : algo_fixture_base
+{
+    execution_state_impl exec_st;
+    lazy_row_batch batch;
+    detail::read_some_rows_lazy_algo algo{diag, {&exec_st, &detail::access::get_impl(batch)}};
+
+    lazy_fixture(resultset_encoding enc = resultset_encoding::text)
+    {
+        // Prepare the state, such that it's ready to read rows
+        exec_st.reset(enc, metadata_mode::minimal);
+        add_meta(
+            exec_st,
+            {meta_builder().type(column_type::varchar).build_coldef(),
+             meta_builder().type(column_type::bigint).build_coldef()}
+        );
+        exec_st.sequence_number() = 42;
+    }
+
+    const detail::lazy_row_batch_impl& impl() const { return detail::access::get_impl(batch); }
+};
+
+BOOST_AUTO_TEST_CASE(lazy_rows)
+{
+    // Setup
+    lazy_fixture fix;
+    const std::uint8_t* connection_buffer = fix.st.reader.internal_buffer().first();
+
+    // Run the algo
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc", 10))
+                         .add(create_text_row_message(43, "von", nullptr))
+                         .build())
+        .check(fix);
+
+    // Nothing has been decoded yet
+    BOOST_TEST(fix.batch.size() == 2u);
+    BOOST_TEST(fix.batch.num_columns() == 2u);
+    BOOST_TEST(!fix.batch.empty());
+    BOOST_TEST(fix.impl().decoded == std::vector<unsigned char>(4, 0));
+    BOOST_TEST(fix.exec_st.is_reading_rows());
+
+    // The buffer has been handed to the batch
+    BOOST_TEST(fix.impl().buffer.data() == connection_buffer);
+    BOOST_TEST(fix.st.reader.internal_buffer().first() != connection_buffer);
+
+    // Accessing a field decodes only that field
+    BOOST_TEST(fix.batch.at(0, 1) == field_view(10));
+    BOOST_TEST(fix.impl().decoded == (std::vector<unsigned char>{0, 1, 0, 0}));
+
+    // Accessing a row decodes all its fields
+    BOOST_TEST(fix.batch.row(1) == makerow("von", nullptr));
+    BOOST_TEST(fix.impl().decoded == (std::vector<unsigned char>{0, 1, 1, 1}));
+    BOOST_TEST(fix.batch.row(0) == makerow("abc", 10));
+}
+
+BOOST_AUTO_TEST_CASE(lazy_rows_binary)
+{
+    // Setup
+    lazy_fixture fix(resultset_encoding::binary);
+
+    // Run the algo
+    const std::uint8_t row[] = {0x00, 0x00, 0x03, 0x61, 0x62, 0x63, 0x2a, 0, 0, 0, 0, 0, 0, 0};
+    algo_test().expect_read(create_frame(42, row)).check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.size() == 1u);
+    BOOST_TEST(fix.batch.at(0, 1) == field_view(42));
+    BOOST_TEST(fix.batch.at(0, 0) == field_view("abc"));
+}
+
+BOOST_AUTO_TEST_CASE(lazy_decode_rows)
+{
+    // Setup
+    lazy_fixture fix;
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc", 10))
+                         .add(create_text_row_message(43, "def", 20))
+                         .add(create_text_row_message(44, "ghi", 30))
+                         .build())
+        .check(fix);
+
+    // Decode a range
+    fix.batch.decode_rows(1, 2);
+    BOOST_TEST(fix.impl().decoded == (std::vector<unsigned char>{0, 0, 1, 1, 1, 1}));
+
+    // Empty ranges are OK
+    fix.batch.decode_rows(3, 0);
+
+    // rows() decodes the remaining ones
+    BOOST_TEST(fix.batch.rows() == makerows(2, "abc", 10, "def", 20, "ghi", 30));
+    BOOST_TEST(fix.impl().decoded == std::vector<unsigned char>(6, 1));
+}
+
+// Disjoint row ranges can be decoded concurrently
+BOOST_AUTO_TEST_CASE(lazy_decode_rows_concurrent)
+{
+    // Setup
+    lazy_fixture fix;
+    buffer_builder builder;
+    std::vector<field_view> expected;
+    for (std::uint8_t i = 0; i < 60u; ++i)
+    {
+        builder.add(create_text_row_message(static_cast<std::uint8_t>(42u + i), "abc", i));
+        expected.push_back(field_view("abc"));
+        expected.push_back(field_view(static_cast<std::int64_t>(i)));
+    }
+    algo_test().expect_read(builder.build()).check(fix);
+    BOOST_TEST_REQUIRE(fix.batch.size() == 60u);
+
+    // Decode
+    std::thread t1([&fix] { fix.batch.decode_rows(0, 30); });
+    std::thread t2([&fix] { fix.batch.decode_rows(30, 30); });
+    t1.join();
+    t2.join();
+
+    // Check
+    BOOST_TEST(fix.impl().decoded == std::vector<unsigned char>(120, 1));
+    BOOST_TEST(fix.impl().fields == expected);
+}
+
+// Decoding errors are reported when fields are accessed
+BOOST_AUTO_TEST_CASE(lazy_decode_error)
+{
+    // Setup
+    lazy_fixture fix;
+
+    // Run the algo. Reading doesn't fail
+    algo_test().expect_read(create_frame(42, {0x03, 0x61, 0x62, 0x63, 0x03, 0x61, 0x62, 0x63})).check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.at(0, 0) == field_view("abc"));
+    BOOST_CHECK_THROW(fix.batch.at(0, 1), error_with_diagnostics);
+    BOOST_CHECK_THROW(fix.batch.row(0), error_with_diagnostics);
+    BOOST_TEST(fix.impl().decoded[1] == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(lazy_out_of_range)
+{
+    // Setup
+    lazy_fixture fix;
+
+    // Run the algo
+    algo_test().expect_read(create_text_row_message(42, "abc", 10)).check(fix);
+
+    // Check
+    BOOST_CHECK_THROW(fix.batch.at(1, 0), std::out_of_range);
+    BOOST_CHECK_THROW(fix.batch.at(0, 2), std::out_of_range);
+    BOOST_CHECK_THROW(fix.batch.row(1), std::out_of_range);
+    BOOST_CHECK_THROW(lazy_row_batch().at(0, 0), std::out_of_range);
+}
+
+// If no rows are read, the batch is left empty
+BOOST_AUTO_TEST_CASE(lazy_eof)
+{
+    // Setup
+    lazy_fixture fix;
+
+    // Run the algo
+    algo_test()
+        .expect_read(create_eof_frame(42, ok_builder().affected_rows(1).info("1st").build()))
+        .check(fix);
+
+    // Check
+    BOOST_TEST(fix.batch.empty());
+    BOOST_TEST(fix.batch.size() == 0u);
+    BOOST_TEST(fix.impl().buffer.empty());
+    BOOST_TEST_REQUIRE(fix.exec_st.is_complete());
+}
+
+// Rows are discarded if there is an error
+BOOST_AUTO_TEST_CASE(lazy_error)
+{
+    // Setup
+    lazy_fixture fix;
+
+    // Run the algo. The first row is processed, but the second one is malformed
+    algo_test()
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(42, "abc", 10))
+                         .add(create_frame(43, {0x03, 0x61}))
+                         .build())
+        .check(fix, client_errc::incomplete_message);
+
+    // Check
+    BOOST_TEST(fix.batch.empty());
+    BOOST_TEST(fix.batch.size() == 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
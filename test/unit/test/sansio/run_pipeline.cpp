@@ -16,6 +16,7 @@
 #include <boost/mysql/detail/access.hpp>
 #include <boost/mysql/detail/algo_params.hpp>
 #include <boost/mysql/detail/pipeline.hpp>
+#include <boost/mysql/detail/pipeline_visitor_ref.hpp>
 #include <boost/mysql/detail/resultset_encoding.hpp>
 
 #include <boost/mysql/impl/internal/sansio/run_pipeline.hpp>
@@ -44,6 +45,7 @@
 #include "test_unit/create_prepare_statement_response.hpp"
 #include "test_unit/create_row_message.hpp"
 #include "test_unit/create_statement.hpp"
+#include "test_unit/mock_resultset_visitor.hpp"
 #include "test_unit/printing.hpp"
 
 using namespace boost::mysql::test;
@@ -680,4 +682,138 @@ BOOST_AUTO_TEST_CASE(reusing_responses)
     BOOST_TEST(resp.at(1).as_results().info() == "msg");
 }
 
+// Streaming responses to a visitor
+struct each_fixture : algo_fixture_base
+{
+    mock_pipeline_visitor visitor;
+    detail::run_pipeline_algo algo;
+
+    each_fixture(span<const pipeline_request_stage> stages)
+        : algo(diag, {mock_request, stages, detail::pipeline_visitor_ref(visitor)})
+    {
+    }
+
+    // Verify that a stage finished with the given error
+    void check_stage_error(std::size_t i, error_code expected_ec, const diagnostics& expected_diag)
+    {
+        BOOST_TEST(visitor.stages.at(i).response.error() == expected_ec);
+        BOOST_TEST(visitor.stages.at(i).response.diag() == expected_diag);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(each_success)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 3> stages{
+        {
+         {pipeline_stage_kind::execute, 42u, resultset_encoding::text},
+         {pipeline_stage_kind::prepare_statement, 11u, {}},
+         {pipeline_stage_kind::execute, 20u, resultset_encoding::text},
+         }
+    };
+    each_fixture fix(stages);
+
+    // Run the test
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_frame(42, {0x01}))  // 1st op OK, 1 column
+        .expect_read(create_coldef_frame(43, meta_builder().type(column_type::tinyint).build_coldef()))
+        .expect_read(buffer_builder()
+                         .add(create_text_row_message(44, 42))
+                         .add(create_text_row_message(45, 43))
+                         .add(create_eof_frame(46, ok_builder().info("1st").build()))
+                         .build())
+        .expect_read(prepare_stmt_response_builder().seqnum(11).id(3).num_columns(0).num_params(0).build())
+        .expect_read(create_ok_frame(20, ok_builder().affected_rows(5u).info("3rd").build()))
+        .check(fix);
+
+    // Resultsets were passed to the visitor
+    BOOST_TEST_REQUIRE(fix.visitor.resultsets.size() == 2u);
+    const auto& rs0 = fix.visitor.resultsets[0];
+    BOOST_TEST_REQUIRE(rs0.batches.size() == 1u);
+    BOOST_TEST((rs0.batches[0] == makerows(1, 42, 43)));
+    BOOST_TEST(rs0.info == "1st");
+    const auto& rs1 = fix.visitor.resultsets[1];
+    BOOST_TEST(rs1.batches.size() == 0u);
+    BOOST_TEST(rs1.affected_rows == 5u);
+    BOOST_TEST(rs1.info == "3rd");
+
+    // Each stage was notified after its resultsets
+    BOOST_TEST_REQUIRE(fix.visitor.stages.size() == 3u);
+    fix.check_stage_error(0, {}, {});
+    BOOST_TEST(fix.visitor.stages[0].num_resultsets == 1u);
+    BOOST_TEST(!fix.visitor.stages[0].response.has_results());
+    BOOST_TEST(fix.visitor.stages[1].response.as_statement().id() == 3u);
+    BOOST_TEST(fix.visitor.stages[1].num_resultsets == 1u);
+    fix.check_stage_error(2, {}, {});
+    BOOST_TEST(fix.visitor.stages[2].num_resultsets == 2u);
+}
+
+BOOST_AUTO_TEST_CASE(each_nonfatal_errors)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 3> stages{
+        {
+         {pipeline_stage_kind::execute, 10u, resultset_encoding::text},
+         {pipeline_stage_kind::ping, 32u, {}},
+         {pipeline_stage_kind::prepare_statement, 16u, {}},
+         }
+    };
+    each_fixture fix(stages);
+
+    // Run the test. Steps 1 and 3 fail
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(err_builder()
+                         .seqnum(10)
+                         .code(common_server_errc::er_bad_field_error)
+                         .message("my_message")
+                         .build_frame())
+        .expect_read(create_ok_frame(32, ok_builder().build()))
+        .expect_read(err_builder()
+                         .seqnum(16)
+                         .code(common_server_errc::er_bad_db_error)
+                         .message("other_msg")
+                         .build_frame())
+        .check(fix, common_server_errc::er_bad_field_error, create_server_diag("my_message"));
+
+    // Stage errors
+    BOOST_TEST(fix.visitor.resultsets.size() == 0u);
+    BOOST_TEST_REQUIRE(fix.visitor.stages.size() == 3u);
+    fix.check_stage_error(0, common_server_errc::er_bad_field_error, create_server_diag("my_message"));
+    fix.check_stage_error(1, {}, {});
+    fix.check_stage_error(2, common_server_errc::er_bad_db_error, create_server_diag("other_msg"));
+}
+
+BOOST_AUTO_TEST_CASE(each_fatal_error)
+{
+    // Setup
+    const std::array<pipeline_request_stage, 3> stages{
+        {
+         {pipeline_stage_kind::execute, 10u, resultset_encoding::text},
+         {pipeline_stage_kind::execute, 20u, resultset_encoding::text},
+         {pipeline_stage_kind::reset_connection, 32u, {}},
+         }
+    };
+    each_fixture fix(stages);
+
+    // Run the test. The 2nd stage fails after its metadata has been read
+    algo_test()
+        .expect_write(mock_request)
+        .expect_read(create_ok_frame(10, ok_builder().build()))
+        .expect_read(create_frame(20, {0x01}))
+        .expect_read(create_coldef_frame(21, meta_builder().type(column_type::tinyint).build_coldef()))
+        .expect_read(asio::error::network_reset)
+        .check(fix, asio::error::network_reset);
+
+    // The visitor got the resultsets read before the error
+    BOOST_TEST(fix.visitor.resultsets.size() == 2u);
+
+    // Stages were notified even after the error
+    BOOST_TEST_REQUIRE(fix.visitor.stages.size() == 3u);
+    fix.check_stage_error(0, {}, {});
+    fix.check_stage_error(1, asio::error::network_reset, {});
+    fix.check_stage_error(2, asio::error::network_reset, {});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
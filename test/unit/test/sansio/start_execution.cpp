@@ -8,6 +8,7 @@
 #include <boost/mysql/character_set.hpp>
 #include <boost/mysql/client_errc.hpp>
 #include <boost/mysql/column_type.hpp>
+#include <boost/mysql/compiled_format.hpp>
 #include <boost/mysql/diagnostics.hpp>
 #include <boost/mysql/error_code.hpp>
 #include <boost/mysql/metadata_mode.hpp>
@@ -159,6 +160,55 @@ BOOST_AUTO_TEST_CASE(with_params_error_formatting)
     algo_test().check(fix, client_errc::format_arg_not_found);
 }
 
+#ifdef BOOST_MYSQL_CXX14
+BOOST_AUTO_TEST_CASE(with_compiled_params_success)
+{
+    // Setup
+    constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}");
+    const std::array<format_arg, 2> args{
+        {{"", "abc"}, {"", 42}}
+    };
+    fixture fix(any_execution_request({query.to_ref(), args}));
+    fix.st.current_charset = utf8mb4_charset;
+
+    // Run the algo
+    algo_test()
+        .expect_write(create_query_frame(0, "SELECT 'abc', 42"))
+        .expect_read(create_ok_frame(1, ok_builder().build()))
+        .check(fix);
+
+    // Verify
+    BOOST_TEST(fix.proc.encoding() == resultset_encoding::text);
+    BOOST_TEST(fix.proc.sequence_number() == 2u);
+    BOOST_TEST(fix.proc.is_complete());
+    fix.proc.num_calls().reset(1).on_head_ok_packet(1).validate();
+}
+
+BOOST_AUTO_TEST_CASE(with_compiled_params_error_unknown_charset)
+{
+    // Setup
+    constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT("SELECT {}");
+    const std::array<format_arg, 1> args{{{"", "abc"}}};
+    fixture fix(any_execution_request({query.to_ref(), args}));
+    fix.st.current_charset = {};
+
+    // The algo fails immediately
+    algo_test().check(fix, client_errc::unknown_character_set);
+}
+
+BOOST_AUTO_TEST_CASE(with_compiled_params_error_formatting)
+{
+    // Setup
+    constexpr auto query = BOOST_MYSQL_COMPILE_FORMAT("SELECT {}, {}");
+    const std::array<format_arg, 1> args{{{"", "abc"}}};
+    fixture fix(any_execution_request({query.to_ref(), args}));
+    fix.st.current_charset = utf8mb4_charset;
+
+    // The algo fails immediately
+    algo_test().check(fix, client_errc::format_arg_not_found);
+}
+#endif
+
 // This covers errors in both writing the request and calling read_resultset_head
 BOOST_AUTO_TEST_CASE(error_network_error)
 {
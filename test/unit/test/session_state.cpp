@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2019-2024 Ruben Perez Hidalgo (rubenperez038 at gmail dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/mysql/session_state.hpp>
+#include <boost/mysql/string_view.hpp>
+
+#include <boost/mysql/detail/access.hpp>
+
+#include <boost/core/span.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "test_unit/create_session_state.hpp"
+
+using namespace boost::mysql;
+using namespace boost::mysql::test;
+using boost::span;
+
+BOOST_AUTO_TEST_SUITE(test_session_state)
+
+namespace {
+
+session_state_view make_view(const std::vector<std::uint8_t>& data)
+{
+    return detail::access::construct<session_state_view>(span<const std::uint8_t>(data));
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(default_ctor)
+{
+    session_state_view v;
+    BOOST_TEST(v.empty());
+    BOOST_TEST((v.begin() == v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+    std::vector<std::uint8_t> data;
+    auto v = make_view(data);
+    BOOST_TEST(v.empty());
+    BOOST_TEST((v.begin() == v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(change_types)
+{
+    struct
+    {
+        string_view name;
+        std::vector<std::uint8_t> data;
+        session_track_type expected_type;
+        string_view expected_name;
+        string_view expected_value;
+    } test_cases[] = {
+        {"system_variable",
+         session_state_builder().system_variable("autocommit", "OFF").build(),
+         session_track_type::system_variable,
+         "autocommit",
+         "OFF"},
+        {"schema",
+         session_state_builder().entry(session_track_type::schema, "mydb").build(),
+         session_track_type::schema,
+         "",
+         "mydb"},
+        {"state_change",
+         session_state_builder().entry(session_track_type::state_change, "1").build(),
+         session_track_type::state_change,
+         "",
+         "1"},
+        {"gtids",
+         session_state_builder().gtids("3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5").build(),
+         session_track_type::gtids,
+         "",
+         "3e11fa47-71ca-11e1-9e33-c80aa9429562:1-5"},
+        {"transaction_characteristics",
+         session_state_builder()
+             .entry(session_track_type::transaction_characteristics, "START TRANSACTION READ ONLY;")
+             .build(),
+         session_track_type::transaction_characteristics,
+         "",
+         "START TRANSACTION READ ONLY;"},
+        {"transaction_state",
+         session_state_builder().entry(session_track_type::transaction_state, "T_______").build(),
+         session_track_type::transaction_state,
+         "",
+         "T_______"},
+        {"unknown_type",
+         session_state_builder().raw_entry(42, {0x01, 0x02}).build(),
+         static_cast<session_track_type>(42),
+         "",
+         "\1\2"},
+    };
+
+    for (const auto& tc : test_cases)
+    {
+        BOOST_TEST_CONTEXT(tc.name)
+        {
+            auto v = make_view(tc.data);
+            BOOST_TEST_REQUIRE(!v.empty());
+            BOOST_TEST_REQUIRE(std::distance(v.begin(), v.end()) == 1);
+            const auto& change = *v.begin();
+            BOOST_TEST((change.type == tc.expected_type));
+            BOOST_TEST(change.name == tc.expected_name);
+            BOOST_TEST(change.value == tc.expected_value);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(extra_payload_bytes)
+{
+    // Servers may add fields to the payload. They're ignored
+    auto data = session_state_builder().raw_entry(1, {0x02, 0x64, 0x62, 0x05, 0x06}).build();
+    auto v = make_view(data);
+    BOOST_TEST_REQUIRE(std::distance(v.begin(), v.end()) == 1);
+    BOOST_TEST((v.begin()->type == session_track_type::schema));
+    BOOST_TEST(v.begin()->value == "db");
+}
+
+BOOST_AUTO_TEST_CASE(several_changes)
+{
+    // Typical response to SET NAMES utf8mb4
+    auto data = session_state_builder()
+                    .system_variable("character_set_client", "utf8mb4")
+                    .system_variable("character_set_connection", "utf8mb4")
+                    .system_variable("character_set_results", "utf8mb4")
+                    .entry(session_track_type::state_change, "1")
+                    .build();
+    auto v = make_view(data);
+
+    auto it = v.begin();
+    BOOST_TEST((it->type == session_track_type::system_variable));
+    BOOST_TEST(it->name == "character_set_client");
+    BOOST_TEST(it->value == "utf8mb4");
+
+    ++it;
+    BOOST_TEST(it->name == "character_set_connection");
+    BOOST_TEST(it->value == "utf8mb4");
+
+    auto it2 = it++;
+    BOOST_TEST(it2->name == "character_set_connection");
+    BOOST_TEST(it->name == "character_set_results");
+
+    ++it;
+    BOOST_TEST((it->type == session_track_type::state_change));
+    BOOST_TEST(it->name == "");
+    BOOST_TEST(it->value == "1");
+
+    ++it;
+    BOOST_TEST((it == v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(iterate_several_times)
+{
+    auto data = session_state_builder()
+                    .entry(session_track_type::schema, "db1")
+                    .entry(session_track_type::schema, "db2")
+                    .build();
+    auto v = make_view(data);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        BOOST_TEST_CONTEXT(i)
+        {
+            std::vector<string_view> values;
+            for (const auto& change : v)
+                values.push_back(change.value);
+            BOOST_TEST_REQUIRE(values.size() == 2u);
+            BOOST_TEST(values[0] == "db1");
+            BOOST_TEST(values[1] == "db2");
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()